@@ -0,0 +1,211 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include <chrono>
+
+#include "OSystem.hxx"
+#include "Console.hxx"
+#include "EventHandler.hxx"
+#include "StateManager.hxx"
+#include "RunAheadManager.hxx"
+#include "TIA.hxx"
+
+#ifdef DEBUGGER_SUPPORT
+  #include "Debugger.hxx"
+#endif
+
+#include "EmulationWorker.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+EmulationWorker::EmulationWorker(OSystem& osystem)
+  : myOSystem(osystem),
+    myQuit(false),
+    myFrameReady(false)
+{
+  myDebugRequest.pending = false;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+EmulationWorker::~EmulationWorker()
+{
+  enable(false);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void EmulationWorker::enable(bool enable)
+{
+  if(enable == enabled())
+    return;
+
+  if(enable)
+  {
+    myQuit = false;
+    myThread = std::thread(&EmulationWorker::run, this);
+  }
+  else
+  {
+    {
+      std::lock_guard<std::mutex> lock(myMutex);
+      myQuit = true;
+    }
+    myWakeup.notify_one();
+    myThread.join();
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void EmulationWorker::update()
+{
+  if(myDebugRequest.pending)
+  {
+    myDebugRequest.pending = false;
+  #ifdef DEBUGGER_SUPPORT
+    if(myDebugRequest.fatal)
+      myOSystem.debugger().startWithFatalError(myDebugRequest.message);
+    else
+      myOSystem.debugger().start(myDebugRequest.message, myDebugRequest.address,
+                                 myDebugRequest.read);
+  #endif
+  }
+
+  if(runnable())
+    myWakeup.notify_one();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void EmulationWorker::waitForFrame(uInt64 timeout)
+{
+  std::unique_lock<std::mutex> lock(myFrameMutex);
+
+  myFrameDone.wait_for(lock, std::chrono::microseconds(timeout),
+                       [this] { return myFrameReady; });
+  myFrameReady = false;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool EmulationWorker::requestDebugger(const string& message, int address,
+                                      bool read, bool fatal)
+{
+  myDebugRequest.pending = true;
+  myDebugRequest.fatal   = fatal;
+  myDebugRequest.message = message;
+  myDebugRequest.address = address;
+  myDebugRequest.read    = read;
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void EmulationWorker::run()
+{
+  std::unique_lock<std::mutex> lock(myMutex);
+  uInt64 virt = myOSystem.getTicks();
+
+  while(!myQuit)
+  {
+    if(!runnable())
+    {
+      myWakeup.wait(lock);
+      virt = myOSystem.getTicks();
+      continue;
+    }
+
+    // When fast-forwarding, frames are emulated back to back, and only
+    // one per frame period is presented
+    const bool fastForward = myOSystem.eventHandler().fastForward();
+    const bool present = !fastForward || myOSystem.getTicks() >= virt;
+    runFrame(present);
+    const uInt64 timePerFrame = uInt64(1000000.0 / myOSystem.frameRate());
+    lock.unlock();
+
+    if(present)
+    {
+      {
+        std::lock_guard<std::mutex> frameLock(myFrameMutex);
+        myFrameReady = true;
+      }
+      myFrameDone.notify_one();
+
+      virt += timePerFrame;
+    }
+
+    // Same timing as the main loop when it runs the emulation itself;
+    // resync when the clocks get too far apart in either direction
+    uInt64 now = myOSystem.getTicks();
+    if(virt > now + (timePerFrame << 1) || now > virt + (timePerFrame << 3))
+      virt = now;
+
+    if(now < virt && !fastForward)
+      std::this_thread::sleep_for(std::chrono::microseconds(virt - now));
+    else
+      std::this_thread::yield();  // give the main thread a chance to lock
+
+    lock.lock();
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void EmulationWorker::runFrame(bool present)
+{
+  EventHandler& handler = myOSystem.eventHandler();
+  Console& console = myOSystem.console();
+  TIA& tia = console.tia();
+
+  handler.updateEmulation();
+  if(handler.fastForward())
+  {
+    tia.enableRendering(present);
+    tia.update();
+    tia.enableRendering(true);
+  }
+  else
+    myOSystem.state().runAheadManager().emulateFrame();
+
+  // A breakpoint interrupts the frame; it isn't shown
+  if(myDebugRequest.pending || !present)
+    return;
+
+  if(handler.frying())
+    console.fry();
+
+  Frame& frame = myFrames.back();
+  frame.height = tia.height();
+  frame.info.capture(myOSystem);
+  memcpy(frame.pixels, tia.frameBuffer(), tia.width() * frame.height);
+  myFrames.publish();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void EmulationWorker::FrameInfo::capture(OSystem& osystem)
+{
+  const Console& console = osystem.console();
+  const RunAheadManager& runAhead = osystem.state().runAheadManager();
+
+  scanlines        = console.tia().scanlinesLastFrame();
+  frameRate        = console.getFramerate();
+  displayFormat    = console.about().DisplayFormat;
+  bankSwitch       = console.about().BankSwitch;
+  runAheadFrames   = runAhead.frames();
+  runAheadOverhead = runAhead.overhead();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool EmulationWorker::runnable() const
+{
+  return !myDebugRequest.pending && myOSystem.hasConsole() &&
+         myOSystem.eventHandler().state() == EventHandlerState::EMULATION;
+}
@@ -0,0 +1,204 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef EMULATION_WORKER_HXX
+#define EMULATION_WORKER_HXX
+
+class OSystem;
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "TIAConstants.hxx"
+#include "TripleBuffer.hxx"
+#include "bspf.hxx"
+
+/**
+  This class runs the emulation on a thread of its own, decoupled from
+  polling the input devices and presenting the frames (which stay on the
+  main thread).
+
+  The emulation thread paces itself at the current framerate, and places
+  each finished frame into a triple buffer, from which the main thread
+  always presents the newest one.  Input reaches the emulation through
+  the lock-free queue in the EventHandler.
+
+  Everything else that touches the console (hotkeys, dialogs, loading a
+  new ROM, ...) happens on the main thread, which has to hold the lock
+  returned by lock() while doing so; the emulation thread holds it while
+  running a frame.  The emulation only runs in EMULATION state; a
+  breakpoint hit on the emulation thread is handed to the main thread,
+  which then starts the debugger.
+*/
+class EmulationWorker
+{
+  public:
+    // What the frame statistics show about a frame; taken on the thread
+    // running the emulation, since the console can't be accessed elsewhere
+    struct FrameInfo {
+      uInt32 scanlines;
+      float frameRate;
+      string displayFormat;
+      string bankSwitch;
+      uInt32 runAheadFrames;
+      uInt32 runAheadOverhead;
+
+      /**
+        Take the values from the current console.
+      */
+      void capture(OSystem& osystem);
+    };
+
+    // A frame produced by the emulation, plus what is needed to present it
+    struct Frame {
+      uInt8 pixels[160 * TIAConstants::frameBufferHeight];
+      uInt32 height;
+      FrameInfo info;
+    };
+
+  public:
+    EmulationWorker(OSystem& osystem);
+    ~EmulationWorker();
+
+    /**
+      Start or stop the emulation thread.  Must be called with the
+      lock *not* held.
+
+      @param enable  Whether the emulation runs on a separate thread
+    */
+    void enable(bool enable);
+
+    /**
+      Answers whether the emulation runs on a separate thread.
+    */
+    bool enabled() const { return myThread.joinable(); }
+
+    /**
+      Answers whether this is called from the emulation thread.
+    */
+    bool onThread() const { return std::this_thread::get_id() == myThread.get_id(); }
+
+    /**
+      Lock the emulation thread out of the console.
+    */
+    std::unique_lock<std::mutex> lock() { return std::unique_lock<std::mutex>(myMutex); }
+
+    /**
+      Start the debugger if the emulation thread asked for it, and let the
+      emulation continue if it should.  Called by the main thread once per
+      iteration of the main loop, with the lock held.
+    */
+    void update();
+
+    /**
+      Wait until the emulation thread finishes a frame, or the given time
+      passes.  Called by the main thread, with the lock *not* held.
+
+      @param timeout  The maximum time to wait, in microseconds
+    */
+    void waitForFrame(uInt64 timeout);
+
+    /**
+      Make the newest frame produced by the emulation thread the current one.
+
+      @return  False if no frame was finished since the last call
+    */
+    bool acquireFrame() { return myFrames.acquire(); }
+
+    /**
+      The current frame (see acquireFrame()).
+    */
+    const Frame& frame() const { return myFrames.front(); }
+
+    /**
+      Ask the main thread to start the debugger; the emulation pauses
+      until it did.  Called from the emulation thread (ie, a breakpoint).
+
+      @param message  Message to display when entering the debugger
+      @param address  Address which caused the debugger to start
+      @param read     True if read access
+      @param fatal    Whether the message is a fatal error
+
+      @return  Always true, since the debugger will be started
+    */
+    bool requestDebugger(const string& message, int address, bool read,
+                         bool fatal = false);
+
+    /**
+      Answers whether the emulation thread is waiting for the debugger.
+    */
+    bool debuggerRequested() const { return myDebugRequest.pending; }
+
+  private:
+    /**
+      The body of the emulation thread.
+    */
+    void run();
+
+    /**
+      Run the console for one frame, and publish the frame.
+      Called with the lock held.
+
+      @param present  Whether the frame is drawn and published; when
+                      fast-forwarding, most frames are not
+    */
+    void runFrame(bool present);
+
+    /**
+      Answers whether the emulation should proceed.
+      Called with the lock held.
+    */
+    bool runnable() const;
+
+  private:
+    OSystem& myOSystem;
+
+    std::thread myThread;
+
+    // Guards the console (and the members below)
+    std::mutex myMutex;
+    std::condition_variable myWakeup;
+    bool myQuit;
+
+    // Debugger request from the emulation thread
+    struct {
+      bool pending;
+      bool fatal;
+      string message;
+      int address;
+      bool read;
+    } myDebugRequest;
+
+    // The frames on their way to the main thread
+    Common::TripleBuffer<Frame> myFrames;
+
+    // Signals the main thread that a frame was finished
+    std::mutex myFrameMutex;
+    std::condition_variable myFrameDone;
+    bool myFrameReady;
+
+  private:
+    // Following constructors and assignment operators not supported
+    EmulationWorker() = delete;
+    EmulationWorker(const EmulationWorker&) = delete;
+    EmulationWorker(EmulationWorker&&) = delete;
+    EmulationWorker& operator=(const EmulationWorker&) = delete;
+    EmulationWorker& operator=(EmulationWorker&&) = delete;
+};
+
+#endif
@@ -207,4 +207,5 @@ AbstractFSNode* FilesystemNodeZIP::getParent() const
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-unique_ptr<ZipHandler> FilesystemNodeZIP::myZipHandler = make_unique<ZipHandler>();
+thread_local unique_ptr<ZipHandler> FilesystemNodeZIP::myZipHandler =
+  make_unique<ZipHandler>();
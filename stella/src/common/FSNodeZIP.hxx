@@ -65,6 +65,10 @@ class FilesystemNodeZIP : public AbstractFSNode
 
     uInt32 read(BytePtr& image) const;
 
+    // The archive as a whole is used to tell whether a file has changed
+    bool getStats(uInt64& size, uInt64& modtime) const
+      { return _realNode && _realNode->getStats(size, modtime); }
+
   private:
     FilesystemNodeZIP(const string& zipfile, const string& virtualpath,
         shared_ptr<AbstractFSNode> realnode, bool isdir);
@@ -100,7 +104,9 @@ class FilesystemNodeZIP : public AbstractFSNode
     bool _isDirectory, _isFile;
 
     // ZipHandler static reference variable responsible for accessing ZIP files
-    static unique_ptr<ZipHandler> myZipHandler;
+    // There is one per thread, so that ZIP files can be opened from each
+    // thread while keeping the benefit of the handler's cache of open files
+    static thread_local unique_ptr<ZipHandler> myZipHandler;
     inline static ZipHandler& open(const string& file)
     {
       myZipHandler->open(file);
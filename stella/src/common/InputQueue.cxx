@@ -0,0 +1,107 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "InputQueue.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+InputQueue::InputQueue()
+  : myHead(0),
+    myTail(0)
+{
+  reset();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void InputQueue::publish(const Event& event)
+{
+  for(uInt32 i = 0; i < Event::LastType; ++i)
+  {
+    Int32 value = event.get(Event::Type(i));
+    if(isRelative(i))
+    {
+      if(value != 0 && !push(i, value))
+        return;
+    }
+    else if(value != myValues[i])
+    {
+      if(!push(i, value))
+        return;
+      myValues[i] = value;
+    }
+  }
+
+  const bool* keys = event.getKeys();
+  for(uInt32 i = 0; i < KBDK_LAST; ++i)
+  {
+    if(keys[i] != myKeys[i])
+    {
+      if(!push(Event::LastType + i, keys[i]))
+        return;
+      myKeys[i] = keys[i];
+    }
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 InputQueue::apply(Event& event)
+{
+  uInt32 head = myHead.load(std::memory_order_relaxed);
+  const uInt32 tail = myTail.load(std::memory_order_acquire);
+  uInt32 count = 0;
+
+  for(; head != tail; ++head, ++count)
+  {
+    const Entry& entry = myEntries[head & (CAPACITY - 1)];
+    if(isRelative(entry.code))
+      event.set(Event::Type(entry.code),
+                event.get(Event::Type(entry.code)) + entry.value);
+    else if(entry.code < Event::LastType)
+      event.set(Event::Type(entry.code), entry.value);
+    else
+      event.setKey(StellaKey(entry.code - Event::LastType), entry.value != 0);
+  }
+  myHead.store(head, std::memory_order_release);
+
+  return count;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void InputQueue::reset()
+{
+  myHead.store(0);
+  myTail.store(0);
+
+  for(uInt32 i = 0; i < Event::LastType; ++i)
+    myValues[i] = Event::NoType;
+  for(uInt32 i = 0; i < KBDK_LAST; ++i)
+    myKeys[i] = false;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool InputQueue::push(uInt32 code, Int32 value)
+{
+  const uInt32 tail = myTail.load(std::memory_order_relaxed);
+  if(tail - myHead.load(std::memory_order_acquire) == CAPACITY)
+    return false;
+
+  Entry& entry = myEntries[tail & (CAPACITY - 1)];
+  entry.code  = code;
+  entry.value = value;
+  myTail.store(tail + 1, std::memory_order_release);
+
+  return true;
+}
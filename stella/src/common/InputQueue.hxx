@@ -0,0 +1,119 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef INPUT_QUEUE_HXX
+#define INPUT_QUEUE_HXX
+
+#include <atomic>
+
+#include "Event.hxx"
+#include "StellaKeys.hxx"
+#include "bspf.hxx"
+
+/**
+  This class carries the input from the thread which polls the host devices
+  to the thread which runs the emulation.  It is a lock-free ring buffer with
+  exactly one producer and one consumer, holding changes of single event
+  values.  The consumer applies everything queued before each frame; the
+  changes aren't tied to emulated time, which goes backwards whenever the
+  console is reset or a state is loaded.
+
+  The producer compares the event object the host input is written into
+  with the values it published last, and only queues the differences.
+  The consumer applies them to the event object the controllers read from.
+  When both sides run on the same thread, this is merely a deferred copy.
+
+  Relative values (mouse motion) are the exception: any non-zero value is
+  queued as a delta, and the consumer adds it to what it hasn't consumed
+  yet.  The producer may then start collecting anew from zero, and the
+  consumer zeroes the value once the controllers have read it, so no
+  motion is lost however the two sides are interleaved.
+*/
+class InputQueue
+{
+  public:
+    InputQueue();
+
+    /**
+      Queue all changes of the given event object since the last call.
+      Changes which don't fit into the queue are retried on the next call.
+      Must only be called by the producer.
+
+      @param event  The event object the host input is written into
+    */
+    void publish(const Event& event);
+
+    /**
+      Apply all queued changes.  Must only be called by the consumer.
+
+      @param event  The event object read by the emulation
+
+      @return  The number of changes applied
+    */
+    uInt32 apply(Event& event);
+
+    /**
+      Discard all queued changes, and forget the values published so far.
+      Only allowed while neither the producer nor the consumer is active.
+    */
+    void reset();
+
+  private:
+    // A change of an event value (codes beyond Event::LastType are keys)
+    struct Entry {
+      uInt32 code;
+      Int32 value;
+    };
+
+    /**
+      Answers whether the given event holds relative motion (see above).
+    */
+    static bool isRelative(uInt32 code) {
+      return code == Event::MouseAxisXValue || code == Event::MouseAxisYValue;
+    }
+
+    /**
+      Append an entry to the ring buffer.
+
+      @return  False if the buffer is full
+    */
+    bool push(uInt32 code, Int32 value);
+
+  private:
+    // Must be a power of two
+    static constexpr uInt32 CAPACITY = 1024;
+
+    Entry myEntries[CAPACITY];
+
+    // Read position (written by the consumer only) and write position
+    // (written by the producer only); both wrap around at 2^32
+    std::atomic<uInt32> myHead;
+    std::atomic<uInt32> myTail;
+
+    // The values published last (only accessed by the producer)
+    Int32 myValues[Event::LastType];
+    bool myKeys[KBDK_LAST];
+
+  private:
+    // Following constructors and assignment operators not supported
+    InputQueue(const InputQueue&) = delete;
+    InputQueue(InputQueue&&) = delete;
+    InputQueue& operator=(const InputQueue&) = delete;
+    InputQueue& operator=(InputQueue&&) = delete;
+};
+
+#endif
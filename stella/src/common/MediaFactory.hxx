@@ -42,12 +42,19 @@
   #error Unsupported platform!
 #endif
 
-#include "FrameBufferSDL2.hxx"
-#include "EventHandlerSDL2.hxx"
-#ifdef SOUND_SUPPORT
-  #include "SoundSDL2.hxx"
-#else
+#if defined(HEADLESS)
+  #include "OSystemHEADLESS.hxx"
+  #include "FrameBufferHEADLESS.hxx"
+  #include "EventHandlerHEADLESS.hxx"
   #include "SoundNull.hxx"
+#else
+  #include "FrameBufferSDL2.hxx"
+  #include "EventHandlerSDL2.hxx"
+  #ifdef SOUND_SUPPORT
+    #include "SoundSDL2.hxx"
+  #else
+    #include "SoundNull.hxx"
+  #endif
 #endif
 
 /**
@@ -66,7 +73,9 @@ class MediaFactory
   public:
     static unique_ptr<OSystem> createOSystem()
     {
-    #if defined(BSPF_UNIX)
+    #if defined(HEADLESS)
+      return make_unique<OSystemHEADLESS>();
+    #elif defined(BSPF_UNIX)
       return make_unique<OSystemUNIX>();
     #elif defined(BSPF_WINDOWS)
       return make_unique<OSystemWINDOWS>();
@@ -105,12 +114,16 @@ class MediaFactory
 
     static unique_ptr<FrameBuffer> createVideo(OSystem& osystem)
     {
+    #if defined(HEADLESS)
+      return make_unique<FrameBufferHEADLESS>(osystem);
+    #else
       return make_unique<FrameBufferSDL2>(osystem);
+    #endif
     }
 
     static unique_ptr<Sound> createAudio(OSystem& osystem)
     {
-    #ifdef SOUND_SUPPORT
+    #if defined(SOUND_SUPPORT) && !defined(HEADLESS)
       return make_unique<SoundSDL2>(osystem);
     #else
       return make_unique<SoundNull>(osystem);
@@ -119,7 +132,11 @@ class MediaFactory
 
     static unique_ptr<EventHandler> createEventHandler(OSystem& osystem)
     {
+    #if defined(HEADLESS)
+      return make_unique<EventHandlerHEADLESS>(osystem);
+    #else
       return make_unique<EventHandlerSDL2>(osystem);
+    #endif
     }
 
   private:
@@ -163,7 +163,9 @@ MouseControl::MouseControl(Console& console, const string& mode)
   int m_range = 100;
   if(!(m_axis >> m_range))
     m_range = 100;
-  Paddles::setPaddleRange(m_range);
+  for(Controller* controller: { &myLeftController, &myRightController })
+    if(controller->type() == Controller::Paddles)
+      static_cast<Paddles*>(controller)->setPaddleRange(m_range);
 
   // If the mouse isn't used at all, we still need one item in the list
   if(myModeList.size() == 0)
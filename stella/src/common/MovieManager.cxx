@@ -0,0 +1,305 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#include "OSystem.hxx"
+#include "Console.hxx"
+#include "Control.hxx"
+#include "EventHandler.hxx"
+#include "M6532.hxx"
+#include "Props.hxx"
+#include "Serializer.hxx"
+#include "StateManager.hxx"
+#include "TIA.hxx"
+
+#include "MovieManager.hxx"
+
+#define MOVIE_HEADER "05019000movie"
+
+namespace {
+  // The inputs of every frame are stored as the number of inputs which
+  // changed, followed by the index and new value of each; all numbers
+  // are stored as 7-bit varints (values zigzag encoded, as they can be
+  // negative)
+
+  inline void putVarint(ByteArray& out, uInt32 value)
+  {
+    while(value >= 0x80)
+    {
+      out.push_back(uInt8(value | 0x80));
+      value >>= 7;
+    }
+    out.push_back(uInt8(value));
+  }
+
+  inline bool getVarint(const ByteArray& in, uInt32& offset, uInt32& value)
+  {
+    value = 0;
+    for(uInt32 shift = 0; offset < in.size() && shift < 32; shift += 7)
+    {
+      value |= uInt32(in[offset] & 0x7f) << shift;
+      if(!(in[offset++] & 0x80))
+        return true;
+    }
+    return false;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+MovieManager::MovieManager(OSystem& system, StateManager& statemgr)
+  : myOSystem(system),
+    myStateManager(statemgr),
+    myNumFrames(0),
+    myFrame(0),
+    myOffset(0)
+{
+  clear();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool MovieManager::startRecording()
+{
+  clear();
+
+  const Console& console = myOSystem.console();
+  myMD5 = console.properties().get(Cartridge_MD5);
+  myLeftController = console.leftController().name();
+  myRightController = console.rightController().name();
+
+  return addKeyframe();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void MovieManager::recordFrame(const Event& event)
+{
+  if(myNumFrames > 0 && myNumFrames % KEYFRAME_INTERVAL == 0)
+    addKeyframe();
+
+  uInt32 count = 0;
+  for(uInt32 i = 0; i < NUM_INPUTS; ++i)
+    if(getInput(event, i) != myInputState[i])
+      ++count;
+
+  putVarint(myInputs, count);
+  for(uInt32 i = 0; count > 0; ++i)
+  {
+    const Int32 value = getInput(event, i);
+    if(value != myInputState[i])
+    {
+      putVarint(myInputs, i);
+      putVarint(myInputs, (uInt32(value) << 1) ^ uInt32(value >> 31));
+      myInputState[i] = value;
+      --count;
+    }
+  }
+  myFrame = ++myNumFrames;
+  myOffset = uInt32(myInputs.size());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool MovieManager::playFrame(Event& event)
+{
+  if(myFrame >= myNumFrames)
+    return false;
+
+  uInt32 count, input, value;
+  if(!getVarint(myInputs, myOffset, count))
+    return false;
+  while(count--)
+  {
+    if(!getVarint(myInputs, myOffset, input) || input >= NUM_INPUTS ||
+       !getVarint(myInputs, myOffset, value))
+      return false;
+    myInputState[input] = Int32(value >> 1) ^ -Int32(value & 1);
+  }
+
+  // Set all inputs, so that nothing else can interfere
+  for(uInt32 i = 0; i < NUM_INPUTS; ++i)
+    setInput(event, i, myInputState[i]);
+  ++myFrame;
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool MovieManager::seek(uInt32 frame)
+{
+  if(frame > myNumFrames || myKeyframes.empty())
+    return false;
+
+  // Start at the last keyframe at or before the frame
+  auto it = std::upper_bound(myKeyframes.begin(), myKeyframes.end(), frame,
+      [](uInt32 f, const Keyframe& k) { return f < k.frame; });
+  const Keyframe& keyframe = *(it - 1);
+
+  Serializer in(uInt32(keyframe.state.size()));
+  in.putByteArray(keyframe.state.data(), uInt32(keyframe.state.size()));
+  in.rewind();
+  if(!myStateManager.loadState(in))
+    return false;
+
+  myFrame = keyframe.frame;
+  myOffset = keyframe.offset;
+  myInputState = keyframe.inputs;
+
+  // Emulate the remaining frames, skipping everything else the frame loop
+  // does (rendering, sound, cheats)
+  Console& console = myOSystem.console();
+  Event& event = myOSystem.eventHandler().event();
+  while(myFrame < frame)
+  {
+    if(!playFrame(event))
+      return false;
+    console.riot().update();
+    console.tia().update();
+  }
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool MovieManager::save(const string& filename) const
+{
+  Serializer out(filename);
+  if(!out || myKeyframes.empty())
+    return false;
+
+  try
+  {
+    out.putString(MOVIE_HEADER);
+    out.putString(myMD5);
+    out.putString(myLeftController);
+    out.putString(myRightController);
+    out.putInt(myNumFrames);
+
+    out.putInt(uInt32(myKeyframes.size()));
+    for(const auto& keyframe: myKeyframes)
+    {
+      out.putInt(keyframe.frame);
+      out.putInt(keyframe.offset);
+      for(Int32 value: keyframe.inputs)
+        out.putInt(uInt32(value));
+      out.putInt(uInt32(keyframe.state.size()));
+      out.putByteArray(keyframe.state.data(), uInt32(keyframe.state.size()));
+    }
+
+    out.putInt(uInt32(myInputs.size()));
+    out.putByteArray(myInputs.data(), uInt32(myInputs.size()));
+  }
+  catch(...)
+  {
+    return false;
+  }
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool MovieManager::load(const string& filename)
+{
+  Serializer in(filename, true);
+  if(!in)
+    return false;
+
+  clear();
+  try
+  {
+    // The movie must be for the current ROM, with the same controllers,
+    // since some controllers save more state than others
+    const Console& console = myOSystem.console();
+    if(in.getString() != MOVIE_HEADER ||
+       (myMD5 = in.getString()) != console.properties().get(Cartridge_MD5) ||
+       (myLeftController = in.getString()) != console.leftController().name() ||
+       (myRightController = in.getString()) != console.rightController().name())
+    {
+      clear();
+      return false;
+    }
+    myNumFrames = in.getInt();
+
+    uInt32 numKeyframes = in.getInt();
+    myKeyframes.resize(numKeyframes);
+    for(auto& keyframe: myKeyframes)
+    {
+      keyframe.frame = in.getInt();
+      keyframe.offset = in.getInt();
+      keyframe.inputs.resize(NUM_INPUTS);
+      for(auto& value: keyframe.inputs)
+        value = Int32(in.getInt());
+      keyframe.state.resize(in.getInt());
+      in.getByteArray(keyframe.state.data(), uInt32(keyframe.state.size()));
+    }
+
+    myInputs.resize(in.getInt());
+    in.getByteArray(myInputs.data(), uInt32(myInputs.size()));
+  }
+  catch(...)
+  {
+    clear();
+    return false;
+  }
+
+  // Keyframes must start the movie, and be in order
+  bool valid = !myKeyframes.empty() && myKeyframes[0].frame == 0;
+  for(uInt32 i = 0; valid && i < myKeyframes.size(); ++i)
+    valid = myKeyframes[i].offset <= myInputs.size() &&
+            myKeyframes[i].frame <= myNumFrames &&
+            (i == 0 || myKeyframes[i].frame > myKeyframes[i - 1].frame);
+  if(!valid)
+  {
+    clear();
+    return false;
+  }
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void MovieManager::clear()
+{
+  myInputs.clear();
+  myKeyframes.clear();
+  myNumFrames = myFrame = myOffset = 0;
+  myInputState.assign(NUM_INPUTS, 0);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool MovieManager::addKeyframe()
+{
+  Serializer out;
+  if(!myStateManager.saveState(out))
+    return false;
+
+  myKeyframes.push_back({ myNumFrames, uInt32(myInputs.size()), myInputState,
+                          ByteArray(out.data(), out.data() + out.size()) });
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Int32 MovieManager::getInput(const Event& event, uInt32 input)
+{
+  return input < NUM_EVENTS ? event.get(Event::Type(input))
+                            : event.getKeys()[input - NUM_EVENTS];
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void MovieManager::setInput(Event& event, uInt32 input, Int32 value)
+{
+  if(input < NUM_EVENTS)
+    event.set(Event::Type(input), value);
+  else
+    event.setKey(StellaKey(input - NUM_EVENTS), value != 0);
+}
@@ -0,0 +1,159 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#ifndef MOVIE_MANAGER_HXX
+#define MOVIE_MANAGER_HXX
+
+class OSystem;
+class StateManager;
+
+#include "Event.hxx"
+#include "bspf.hxx"
+
+/**
+  This class records the inputs of an emulation session, so that it can
+  later be played back deterministically (a 'movie').
+
+  A movie consists of the state of the system at the start of recording,
+  followed by the changes to the controller and console switch events for
+  every frame.  Every KEYFRAME_INTERVAL frames, the complete state of the
+  system is stored as well, so that seeking to any frame only requires
+  loading the preceding keyframe and emulating the frames after it.
+
+  Movies are recorded and played back in memory, and saved to or loaded
+  from a file as a whole.
+*/
+class MovieManager
+{
+  public:
+    MovieManager(OSystem& system, StateManager& statemgr);
+
+  public:
+    /**
+      Start recording a new movie, from the current state of the system.
+
+      @return  False on any errors, else true
+    */
+    bool startRecording();
+
+    /**
+      Add the inputs of the frame about to be emulated to the movie.
+
+      @param event  The current values of all events
+    */
+    void recordFrame(const Event& event);
+
+    /**
+      Set the inputs of the frame about to be emulated from the movie.
+
+      @param event  The events to set
+
+      @return  False if the end of the movie was reached, else true
+    */
+    bool playFrame(Event& event);
+
+    /**
+      Restore the system to the state it was in before the given frame of
+      the movie, by loading the preceding keyframe and emulating the frames
+      after it (as fast as possible).
+
+      @param frame  The frame to seek to (0 is the start of the movie)
+
+      @return  False on any errors, else true
+    */
+    bool seek(uInt32 frame);
+
+    /**
+      Save the movie to/load the movie from the given file.  The ROM of the
+      movie must be the one currently loaded.  Loading a movie doesn't
+      change the state of the system; seek(0) starts its playback.
+
+      @param filename  The file to save to/load from
+
+      @return  False on any errors, else true
+    */
+    bool save(const string& filename) const;
+    bool load(const string& filename);
+
+    /**
+      Remove all data of the movie.
+    */
+    void clear();
+
+    /**
+      The current frame of the movie, and the total number of frames.
+    */
+    uInt32 frame() const     { return myFrame; }
+    uInt32 numFrames() const { return myNumFrames; }
+
+  private:
+    // Number of frames between keyframes (5 seconds, for NTSC)
+    static constexpr uInt32 KEYFRAME_INTERVAL = 300;
+
+    // The inputs recorded: all events related to controllers and console
+    // switches (which come before ChangeState), followed by the keyboard
+    // (for the CompuMate)
+    static constexpr uInt32 NUM_EVENTS = Event::ChangeState;
+    static constexpr uInt32 NUM_INPUTS = NUM_EVENTS + KBDK_LAST;
+
+    struct Keyframe {
+      uInt32 frame;          // the frame this keyframe precedes
+      uInt32 offset;         // the offset of the frame's inputs
+      vector<Int32> inputs;  // the values of all inputs before the frame
+      ByteArray state;       // the state of the system before the frame
+    };
+
+    OSystem& myOSystem;
+    StateManager& myStateManager;
+
+    // The ROM the movie is for, and its controllers
+    string myMD5, myLeftController, myRightController;
+
+    // The changes of the inputs for every frame
+    ByteArray myInputs;
+    vector<Keyframe> myKeyframes;
+    uInt32 myNumFrames;
+
+    // The current position in the movie, and the inputs at that position
+    uInt32 myFrame, myOffset;
+    vector<Int32> myInputState;
+
+  private:
+    /**
+      Add a keyframe for the current frame and state.
+
+      @return  False on any errors, else true
+    */
+    bool addKeyframe();
+
+    /**
+      Get/set the value of the given input from/to the events.
+    */
+    static Int32 getInput(const Event& event, uInt32 input);
+    static void setInput(Event& event, uInt32 input, Int32 value);
+
+  private:
+    // Following constructors and assignment operators not supported
+    MovieManager() = delete;
+    MovieManager(const MovieManager&) = delete;
+    MovieManager(MovieManager&&) = delete;
+    MovieManager& operator=(const MovieManager&) = delete;
+    MovieManager& operator=(MovieManager&&) = delete;
+};
+
+#endif
@@ -151,8 +151,11 @@ void PhysicalKeyboardHandler::setDefaultMapping(Event::Type event, EventMode mod
       setDefaultKey( KBDK_F9,        Event::SaveState         );
       setDefaultKey( KBDK_F10,       Event::ChangeState       );
       setDefaultKey( KBDK_F11,       Event::LoadState         );
+      setDefaultKey( KBDK_HOME,      Event::ToggleMovieRecord   );
+      setDefaultKey( KBDK_END,       Event::ToggleMoviePlayback );
       setDefaultKey( KBDK_F12,       Event::TakeSnapshot      );
       setDefaultKey( KBDK_BACKSPACE, Event::Fry               );
+      setDefaultKey( KBDK_INSERT,    Event::FastForward       );
       setDefaultKey( KBDK_PAUSE,     Event::PauseMode         );
       setDefaultKey( KBDK_TAB,       Event::OptionsMenuMode   );
       setDefaultKey( KBDK_BACKSLASH, Event::CmdMenuMode       );
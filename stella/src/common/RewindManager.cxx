@@ -25,10 +25,170 @@
 
 #include "RewindManager.hxx"
 
+namespace {
+  constexpr uInt32 NO_SLOT = ~0u;
+
+  // A delta is a sequence of tokens, each consisting of
+  //   - the number of unchanged bytes to skip
+  //   - (count << 1) | run
+  //   - either 'count' bytes to XOR, or one byte to XOR 'count' bytes with
+  // with the numbers stored as 7-bit varints; unchanged bytes at the end
+  // aren't stored at all
+
+  inline uInt8* putVarint(uInt8* out, uInt32 value)
+  {
+    while(value >= 0x80)
+    {
+      *out++ = uInt8(value | 0x80);
+      value >>= 7;
+    }
+    *out++ = uInt8(value);
+
+    return out;
+  }
+
+  inline const uInt8* getVarint(const uInt8* in, uInt32& value)
+  {
+    value = 0;
+    for(uInt32 shift = 0; ; shift += 7)
+    {
+      value |= uInt32(*in & 0x7f) << shift;
+      if(!(*in++ & 0x80))
+        return in;
+    }
+  }
+
+  // Encode the changes from 'from' to 'to' into 'out', which must have room
+  // for 'size' bytes; fails if the delta wouldn't be smaller than that
+  bool encodeDelta(const uInt8* from, const uInt8* to, uInt32 size,
+                   uInt8* out, uInt32& length)
+  {
+    // Runs (of unchanged bytes, or of bytes changed the same way) shorter
+    // than this are cheaper to include in the surrounding changes
+    constexpr uInt32 MIN_RUN = 4;
+
+    uInt8* const start = out;
+    uInt8* const end = out + size;
+    uInt32 pos = 0;
+
+    while(pos < size)
+    {
+      // Skip unchanged bytes, 8 at a time where possible
+      uInt32 skip = pos;
+      for(uInt64 a, b; pos + 8 <= size; pos += 8)
+      {
+        memcpy(&a, from + pos, 8);  memcpy(&b, to + pos, 8);
+        if(a != b)
+          break;
+      }
+      while(pos < size && from[pos] == to[pos])
+        ++pos;
+      if(pos == size)
+        break;
+      skip = pos - skip;
+
+      // Then either a run of equal changes ...
+      const uInt8 value = from[pos] ^ to[pos];
+      uInt32 count = 1;
+      while(pos + count < size && uInt8(from[pos + count] ^ to[pos + count]) == value)
+        ++count;
+
+      // A token takes at most 10 bytes, plus the changes themselves
+      if(count >= MIN_RUN)
+      {
+        if(end - out < 11)
+          return false;
+
+        out = putVarint(out, skip);
+        out = putVarint(out, (count << 1) | 1);
+        *out++ = value;
+        pos += count;
+        continue;
+      }
+
+      // ... or individual changes, up to the next run
+      uInt32 runStart = pos, i;
+      uInt8 runValue = value;
+      for(i = pos + 1; i < size; ++i)
+      {
+        const uInt8 x = from[i] ^ to[i];
+        if(x != runValue)
+        {
+          runStart = i;
+          runValue = x;
+        }
+        else if(i - runStart + 1 >= MIN_RUN)
+          break;
+      }
+      count = (i < size ? runStart : size) - pos;
+
+      if(end - out < 10 + Int64(count))
+        return false;
+
+      out = putVarint(out, skip);
+      out = putVarint(out, count << 1);
+      for(const uInt32 last = pos + count; pos < last; ++pos)
+        *out++ = from[pos] ^ to[pos];
+    }
+    length = uInt32(out - start);
+
+    return length < size;
+  }
+
+  // XOR 'count' bytes of 'state' with 'value', or with 'bytes'
+  inline void xorBytes(uInt8* state, uInt8 value, uInt32 count)
+  {
+    const uInt64 pattern = value * 0x0101010101010101ULL;
+    for(uInt64 word; count >= 8; state += 8, count -= 8)
+    {
+      memcpy(&word, state, 8);  word ^= pattern;  memcpy(state, &word, 8);
+    }
+    while(count--)
+      *state++ ^= value;
+  }
+
+  inline void xorBytes(uInt8* state, const uInt8* bytes, uInt32 count)
+  {
+    for(uInt64 word, x; count >= 8; state += 8, bytes += 8, count -= 8)
+    {
+      memcpy(&word, state, 8);  memcpy(&x, bytes, 8);
+      word ^= x;
+      memcpy(state, &word, 8);
+    }
+    while(count--)
+      *state++ ^= *bytes++;
+  }
+
+  // Apply a delta created by encodeDelta to 'state'
+  void decodeDelta(uInt8* state, const uInt8* delta, uInt32 length)
+  {
+    const uInt8* const end = delta + length;
+    uInt32 skip, count;
+
+    while(delta < end)
+    {
+      delta = getVarint(delta, skip);
+      delta = getVarint(delta, count);
+      state += skip;
+      if(count & 1)
+        xorBytes(state, *delta++, count >>= 1);
+      else
+      {
+        xorBytes(state, delta, count >>= 1);
+        delta += count;
+      }
+      state += count;
+    }
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 RewindManager::RewindManager(OSystem& system, StateManager& statemgr)
   : myOSystem(system),
-    myStateManager(statemgr)
+    myStateManager(statemgr),
+    myFreeChunk(0),
+    myNumFreeChunks(0),
+    myFullStateSlot(NO_SLOT)
 {
   setup();
 }
@@ -90,6 +250,30 @@ void RewindManager::setup()
   }
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RewindManager::resize(uInt32 size)
+{
+  if(size != myStateList.capacity())
+  {
+    myStateList.resize(size);
+    clear();
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RewindManager::clear()
+{
+  myStateList.clear();
+
+  // All chunks of the arena are free again
+  const uInt32 numChunks = uInt32(myNextChunk.size());
+  for(uInt32 i = 0; i < numChunks; ++i)
+    myNextChunk[i] = i + 1;
+  myFreeChunk = 0;
+  myNumFreeChunks = numChunks;
+  myFullStateSlot = NO_SLOT;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool RewindManager::addState(const string& message, bool timeMachine)
 {
@@ -113,24 +297,45 @@ bool RewindManager::addState(const string& message, bool timeMachine)
   }
 
   // Remove all future states
-  myStateList.removeToLast();
+  if(myStateList.currentIsValid())
+  {
+    for(uInt32 i = myStateList.currentIdx(); i < myStateList.size(); ++i)
+    {
+      if(myStateList.slot(i) == myFullStateSlot)
+        myFullStateSlot = NO_SLOT;
+      freeData(myStateList[i]);
+    }
+    myStateList.removeToLast();
+  }
 
   // Make sure we never run out of space
   if(myStateList.full())
     compressStates();
 
-  // Add new state at the end of the list (queue adds at end)
-  // This updates the 'current' iterator inside the list
-  myStateList.addLast();
-  RewindState& state = myStateList.current();
-  Serializer& s = state.data;
-
-  s.rewind();  // rewind Serializer internal buffers
-  if(myStateManager.saveState(s) && myOSystem.console().tia().saveDisplay(s))
+  myBuffer.rewind();  // rewind Serializer internal buffers
+  if(myStateManager.saveState(myBuffer) &&
+     myOSystem.console().tia().saveDisplay(myBuffer))
   {
+    // The new state is stored relative to the last one
+    const ByteArray* prev = nullptr;
+    if(!myStateList.empty())
+    {
+      decodeState(myStateList.size() - 1);
+      prev = &myFullState;
+    }
+
+    // Add new state at the end of the list (queue adds at end)
+    // This updates the 'current' position inside the list
+    RewindState& state = myStateList.addLast();
+    state.size = myBuffer.size();
     state.message = message;
     state.cycles = myOSystem.console().tia().cycles();
+    encodeState(myStateList.size() - 1, myBuffer.data(), prev);
     myLastTimeMachineAdd = timeMachine;
+
+    // Which makes the new state the reference for the next one
+    myFullState.assign(myBuffer.data(), myBuffer.data() + myBuffer.size());
+    myFullStateSlot = myStateList.slot(myStateList.size() - 1);
     return true;
   }
   return false;
@@ -155,10 +360,6 @@ uInt32 RewindManager::rewindStates(uInt32 numStates)
         // ...except when the last state was added automatically,
         // because that already happened one interval before
         myLastTimeMachineAdd = false;
-
-      RewindState& state = myStateList.current();
-      Serializer& s = state.data;
-      s.rewind();  // rewind Serializer internal buffers
     }
     else
       break;
@@ -189,10 +390,6 @@ uInt32 RewindManager::unwindStates(uInt32 numStates)
       // Set internal current iterator to nextCycles state (forward in time),
       // since we will now process this state
       myStateList.moveToNext();
-
-      RewindState& state = myStateList.current();
-      Serializer& s = state.data;
-      s.rewind();  // rewind Serializer internal buffers
     }
     else
       break;
@@ -224,43 +421,244 @@ void RewindManager::compressStates()
 {
   double expectedCycles = myInterval * myFactor * (1 + myFactor);
   double maxError = 1.5;
-  uInt32 idx = myStateList.size() - 2;
   // in case maxError is <= 1.5 remove first state by default:
-  Common::LinkedObjectPool<RewindState>::const_iter removeIter = myStateList.first();
+  uInt32 removeIdx = 0;
   /*if(myUncompressed < mySize)
     //  if compression is enabled, the first but one state is removed by default:
-    removeIter++;*/
+    removeIdx++;*/
 
   // iterate from last but one to first but one
-  for(auto it = myStateList.previous(myStateList.last()); it != myStateList.first(); --it)
+  for(uInt32 idx = myStateList.size() - 2; idx > 0; --idx)
   {
     if(idx < mySize - myUncompressed)
     {
       expectedCycles *= myFactor;
 
-      uInt64 prevCycles = myStateList.previous(it)->cycles;
-      uInt64 nextCycles = myStateList.next(it)->cycles;
+      uInt64 prevCycles = myStateList[idx - 1].cycles;
+      uInt64 nextCycles = myStateList[idx + 1].cycles;
       double error = expectedCycles / (nextCycles - prevCycles);
 
       if(error > maxError)
       {
         maxError = error;
-        removeIter = it;
+        removeIdx = idx;
       }
     }
-    --idx;
   }
-   myStateList.remove(removeIter); // remove
+  removeState(removeIdx); // remove
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RewindManager::removeState(uInt32 idx)
+{
+  // If the next state is a delta to this one, it becomes a delta to the
+  // previous state instead (or a keyframe, if this one is a keyframe)
+  const bool keyframe = myStateList[idx].depth == 0;
+  const bool dependent = idx + 1 < myStateList.size() && myStateList[idx + 1].depth > 0;
+  if(dependent)
+  {
+    if(keyframe)
+    {
+      // Leave the last state reconstructed alone, it's likely needed next
+      myMask.resize(myStateList[idx].size);
+      fetchData(myStateList[idx], myMask.data());
+    }
+    else
+    {
+      // XOR'ing both deltas onto zeros gives the combined changes
+      myZeros.assign(myStateList[idx].size, 0);
+      myMask = myZeros;
+      applyDelta(idx, myMask.data());
+    }
+    applyDelta(idx + 1, myMask.data());
+  }
+
+  if(myStateList.slot(idx) == myFullStateSlot)
+    myFullStateSlot = NO_SLOT;
+  freeData(myStateList[idx]);
+  myStateList.remove(idx);
+
+  if(dependent)
+  {
+    // The next state is now at 'idx'
+    RewindState& state = myStateList[idx];
+    freeData(state);
+    if(!keyframe)
+    {
+      uInt32 length;
+      myDelta.resize(state.size);
+      if(encodeDelta(myZeros.data(), myMask.data(), state.size, myDelta.data(), length))
+      {
+        state.depth = myStateList[idx - 1].depth + 1;
+        storeData(state, myDelta.data(), length);
+        return;
+      }
+
+      // The combined delta is too large, so apply it after all.  The previous
+      // state must be reconstructed going forward: going backward from the
+      // last state reconstructed would pass through the delta freed above
+      for(uInt32 i = idx; i < myStateList.size() && myStateList[i].depth > 0; ++i)
+        if(myStateList.slot(i) == myFullStateSlot)
+          myFullStateSlot = NO_SLOT;
+      decodeState(idx - 1);
+      for(uInt32 i = 0; i < state.size; ++i)
+        myMask[i] ^= myFullState[i];
+    }
+    encodeState(idx, myMask.data(), nullptr);
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RewindManager::encodeState(uInt32 idx, const uInt8* data, const ByteArray* prev)
+{
+  RewindState& state = myStateList[idx];
+
+  if(prev && prev->size() == state.size &&
+     myStateList[idx - 1].depth + 1 < KEYFRAME_INTERVAL)
+  {
+    uInt32 length;
+    myDelta.resize(state.size);
+    if(encodeDelta(prev->data(), data, state.size, myDelta.data(), length))
+    {
+      state.depth = myStateList[idx - 1].depth + 1;
+      storeData(state, myDelta.data(), length);
+      return;
+    }
+  }
+
+  // Store a keyframe if a delta isn't possible, or wouldn't be any smaller
+  state.depth = 0;
+  storeData(state, data, state.size);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RewindManager::decodeState(uInt32 idx)
+{
+  const uInt32 slot = myStateList.slot(idx);
+  if(slot == myFullStateSlot)
+    return;
+
+  // Going forward, start at the previous keyframe, or the last state
+  // reconstructed if that comes first
+  uInt32 first = idx;
+  while(first > 0 && myStateList[first].depth > 0 &&
+        myStateList.slot(first) != myFullStateSlot)
+    --first;
+  const bool cached = myStateList.slot(first) == myFullStateSlot;
+  const uInt32 cost = idx - first + (cached ? 0 : 1);
+
+  // Going backward is possible from the last state reconstructed, if there
+  // is no keyframe in between
+  for(uInt32 i = idx + 1; i - idx < cost && i < myStateList.size() &&
+      myStateList[i].depth > 0; ++i)
+  {
+    if(myStateList.slot(i) == myFullStateSlot)
+    {
+      for(; i > idx; --i)
+        applyDelta(i, myFullState.data());
+      myFullStateSlot = slot;
+      return;
+    }
+  }
+
+  if(!cached)
+  {
+    myFullState.resize(myStateList[first].size);
+    fetchData(myStateList[first], myFullState.data());
+  }
+  for(uInt32 i = first + 1; i <= idx; ++i)
+    applyDelta(i, myFullState.data());
+  myFullStateSlot = slot;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RewindManager::applyDelta(uInt32 idx, uInt8* data)
+{
+  const RewindState& state = myStateList[idx];
+
+  myDelta.resize(state.length);
+  fetchData(state, myDelta.data());
+  decodeDelta(data, myDelta.data(), state.length);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RewindManager::storeData(RewindState& state, const uInt8* data, uInt32 length)
+{
+  const uInt32 numChunks = (length + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+  if(numChunks > myNumFreeChunks)
+  {
+    // Grow the arena (at least) geometrically, and add the new chunks to the
+    // free list; no make_unique, since there's no need to clear the arena
+    const uInt32 oldChunks = uInt32(myNextChunk.size());
+    const uInt32 newChunks = std::max(oldChunks * 2, oldChunks + numChunks);
+    BytePtr arena(new uInt8[size_t(newChunks) * CHUNK_SIZE]);
+    if(oldChunks)
+      memcpy(arena.get(), myArena.get(), size_t(oldChunks) * CHUNK_SIZE);
+    myArena = std::move(arena);
+
+    myNextChunk.resize(newChunks);
+    for(uInt32 i = oldChunks; i < newChunks - 1; ++i)
+      myNextChunk[i] = i + 1;
+    myNextChunk[newChunks - 1] = myFreeChunk;
+    myFreeChunk = oldChunks;
+    myNumFreeChunks += newChunks - oldChunks;
+  }
+
+  state.chunk = myFreeChunk;
+  state.length = length;
+  for(uInt32 offset = 0; offset < length; offset += CHUNK_SIZE)
+  {
+    memcpy(myArena.get() + size_t(myFreeChunk) * CHUNK_SIZE, data + offset,
+           std::min(length - offset, uInt32(CHUNK_SIZE)));
+    myFreeChunk = myNextChunk[myFreeChunk];
+  }
+  myNumFreeChunks -= numChunks;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RewindManager::fetchData(const RewindState& state, uInt8* data) const
+{
+  uInt32 chunk = state.chunk;
+  for(uInt32 offset = 0; offset < state.length; offset += CHUNK_SIZE)
+  {
+    memcpy(data + offset, myArena.get() + size_t(chunk) * CHUNK_SIZE,
+           std::min(state.length - offset, uInt32(CHUNK_SIZE)));
+    chunk = myNextChunk[chunk];
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RewindManager::freeData(RewindState& state)
+{
+  const uInt32 numChunks = (state.length + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  if(numChunks == 0)
+    return;
+
+  // Put the whole chain in front of the free list
+  uInt32 last = state.chunk;
+  for(uInt32 i = 1; i < numChunks; ++i)
+    last = myNextChunk[last];
+  myNextChunk[last] = myFreeChunk;
+  myFreeChunk = state.chunk;
+  myNumFreeChunks += numChunks;
+  state.length = 0;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 string RewindManager::loadState(Int64 startCycles, uInt32 numStates)
 {
   RewindState& state = myStateList.current();
-  Serializer& s = state.data;
 
-  myStateManager.loadState(s);
-  myOSystem.console().tia().loadDisplay(s);
+  // Going back or forth in time would break an active movie
+  myStateManager.stopMovie();
+
+  decodeState(myStateList.currentIdx() - 1);
+  myBuffer.rewind();  // rewind Serializer internal buffers
+  myBuffer.putByteArray(myFullState.data(), state.size);
+  myBuffer.rewind();
+  myStateManager.loadState(myBuffer);
+  myOSystem.console().tia().loadDisplay(myBuffer);
 
   Int64 diff = startCycles - state.cycles;
   stringstream message;
@@ -310,7 +708,7 @@ string RewindManager::getUnitString(Int64 cycles)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt64 RewindManager::getFirstCycles() const
 {
-  return !myStateList.empty() ? myStateList.first()->cycles : 0;
+  return !myStateList.empty() ? myStateList[0].cycles : 0;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -325,7 +723,7 @@ uInt64 RewindManager::getCurrentCycles() const
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt64 RewindManager::getLastCycles() const
 {
-  return !myStateList.empty() ? myStateList.last()->cycles : 0;
+  return !myStateList.empty() ? myStateList[myStateList.size() - 1].cycles : 0;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -334,8 +732,8 @@ IntArray RewindManager::cyclesList() const
   IntArray arr;
 
   uInt64 firstCycle = getFirstCycles();
-  for(auto it = myStateList.cbegin(); it != myStateList.cend(); ++it)
-    arr.push_back(uInt32(it->cycles - firstCycle));
+  for(uInt32 i = 0; i < myStateList.size(); ++i)
+    arr.push_back(uInt32(myStateList[i].cycles - firstCycle));
 
   return arr;
 }
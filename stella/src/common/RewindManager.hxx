@@ -21,7 +21,8 @@
 class OSystem;
 class StateManager;
 
-#include "LinkedObjectPool.hxx"
+#include "RingBuffer.hxx"
+#include "Serializer.hxx"
 #include "bspf.hxx"
 
 /**
@@ -41,6 +42,14 @@ class StateManager;
   If the list is full, states are either removed at the beginning (compression
   off) or at selective positions (compression on).
 
+  Successive states differ in only a few bytes, so most states are stored
+  as a delta (XOR, then run-length encoded) to the previous one; only every
+  KEYFRAME_INTERVAL'th state is stored in full.  States are reconstructed
+  on demand, from the nearest keyframe or the last state reconstructed
+  (XOR deltas work in both directions).
+  The data of all states is kept in one arena, in chains of fixed-size
+  chunks.
+
   @author  Stephen Anthony
 */
 class RewindManager
@@ -138,8 +147,8 @@ class RewindManager
 
     bool atFirst() const { return myStateList.atFirst(); }
     bool atLast() const  { return myStateList.atLast();  }
-    void resize(uInt32 size) { myStateList.resize(size); }
-    void clear() { myStateList.clear(); }
+    void resize(uInt32 size);
+    void clear();
 
     /**
       Convert the cycles into a unit string.
@@ -170,15 +179,20 @@ class RewindManager
     double myFactor;
     bool   myLastTimeMachineAdd;
 
+    // Maximum number of states depending on the same keyframe
+    static constexpr uInt32 KEYFRAME_INTERVAL = 32;
+    // Granularity of the arena
+    static constexpr uInt32 CHUNK_SIZE = 256;
+
     struct RewindState {
-      Serializer data;  // actual save state
+      uInt32 size;      // size of the save state
+      uInt32 depth;     // number of deltas since the last keyframe (0 = keyframe)
+      uInt32 chunk;     // first chunk of the stored data in the arena
+      uInt32 length;    // length of the stored data
       string message;   // describes save state origin
       uInt64 cycles;    // cycles since emulation started
 
-      // We do nothing on object instantiation or copy
-      // The goal of LinkedObjectPool is to not do any allocations at all
-      RewindState() : cycles(0) { }
-      RewindState(const RewindState& rs) : cycles(rs.cycles) { }
+      RewindState() : size(0), depth(0), chunk(0), length(0), cycles(0) { }
 
       // Output object info; used for debugging only
       friend ostream& operator<<(ostream& os, const RewindState& s) {
@@ -186,15 +200,65 @@ class RewindManager
       }
     };
 
-    // The linked-list to store states (internally it takes care of reducing
-    // frequent (de)-allocations)
-    Common::LinkedObjectPool<RewindState> myStateList;
+    // The list of states
+    Common::RingBuffer<RewindState> myStateList;
+
+    // The stored data of all states, in chunks of CHUNK_SIZE bytes; each
+    // chunk links to the next one of its state (or of the free list)
+    BytePtr myArena;
+    vector<uInt32> myNextChunk;
+    uInt32 myFreeChunk, myNumFreeChunks;
+
+    // States are saved to and loaded from here
+    Serializer myBuffer;
+
+    // The last state reconstructed, and its slot in the list (if still valid)
+    ByteArray myFullState;
+    uInt32 myFullStateSlot;
+
+    // Temporary storage while encoding and decoding
+    ByteArray myDelta, myMask, myZeros;
 
     /**
       Remove a save state from the list
     */
     void compressStates();
 
+    /**
+      Remove the state at the given index of the list, re-encoding the state
+      following it as necessary
+    */
+    void removeState(uInt32 idx);
+
+    /**
+      Store the given state data for the state at the given index, as a
+      delta to 'prev' (the previous state's data) if possible
+
+      @param idx   The index of the state
+      @param data  The state's data (size taken from the state)
+      @param prev  The previous state's data, or nullptr if there is none
+    */
+    void encodeState(uInt32 idx, const uInt8* data, const ByteArray* prev);
+
+    /**
+      Reconstruct the state at the given index of the list into 'myFullState'
+    */
+    void decodeState(uInt32 idx);
+
+    /**
+      Apply the delta of the state at the given index to 'data', which
+      turns the previous state into this one, and vice versa
+    */
+    void applyDelta(uInt32 idx, uInt8* data);
+
+    /**
+      Allocate chunks for and copy the data of a state into the arena, and
+      the reverse
+    */
+    void storeData(RewindState& state, const uInt8* data, uInt32 length);
+    void fetchData(const RewindState& state, uInt8* data) const;
+    void freeData(RewindState& state);
+
     /**
       Load the current state and get the message string for the rewind/unwind
 
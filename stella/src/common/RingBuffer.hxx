@@ -0,0 +1,220 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef RING_BUFFER_HXX
+#define RING_BUFFER_HXX
+
+#include "bspf.hxx"
+
+/**
+  A fixed-capacity list with O(1) access by index, for use as a history
+  (states are added at the end, and removed at either end or at arbitrary
+  positions).
+
+  The elements themselves live in one array and are never moved or
+  destroyed; removing an element simply returns its slot for reuse by the
+  next add.  What's kept in order is a ring of slot numbers, so removing
+  from the front or the back is O(1), and removing from the middle only
+  shifts 32-bit slot numbers.
+
+  Since an element always stays in the same slot, the slot number can also
+  be used to address external per-element storage (see slot()).
+
+  There's a 'current' position, which must be checked with
+  'currentIsValid()' before calling 'current()'.
+*/
+namespace Common {
+
+template <class T>
+class RingBuffer
+{
+  public:
+    /*
+      Create a buffer with room for 'capacity' elements; it starts out empty.
+    */
+    explicit RingBuffer(uInt32 capacity = 100)
+      : myCapacity(0), myFirst(0), mySize(0), myCurrent(INVALID) {
+      resize(capacity);
+    }
+
+    /**
+      Return the element at the 'current' position.  Make sure to call
+      'currentIsValid()' before accessing this method.
+    */
+    T& current()             { return (*this)[myCurrent]; }
+    const T& current() const { return (*this)[myCurrent]; }
+
+    /**
+      Returns current's position in the list (1-based, 0 if empty).
+    */
+    uInt32 currentIdx() const { return empty() ? 0 : myCurrent + 1; }
+
+    /**
+      Does the 'current' position point to a valid element?
+      This must be called before 'current()' is called.
+    */
+    bool currentIsValid() const { return myCurrent < mySize; }
+
+    /**
+      Move 'current' to the previous/next element.  Going past the
+      beginning/end invalidates it.
+    */
+    void moveToPrevious() {
+      if(currentIsValid())
+        myCurrent = myCurrent == 0 ? INVALID : myCurrent - 1;
+    }
+    void moveToNext() {
+      if(currentIsValid())
+        myCurrent = myCurrent + 1 < mySize ? myCurrent + 1 : INVALID;
+    }
+
+    /**
+      Answer whether 'current' is at the first/last element.
+    */
+    bool atFirst() const { return !empty() && myCurrent == 0;         }
+    bool atLast() const  { return !empty() && myCurrent == mySize - 1; }
+
+    /**
+      Access elements by their position in the list (0 is the first).
+    */
+    T& operator[](uInt32 idx)             { return myElements[slot(idx)]; }
+    const T& operator[](uInt32 idx) const { return myElements[slot(idx)]; }
+
+    /**
+      The slot (0 .. capacity-1) of the element at the given position.
+      The slot of an element never changes while it is in the list.
+    */
+    uInt32 slot(uInt32 idx) const {
+      idx += myFirst;
+      return myOrder[idx < myCapacity ? idx : idx - myCapacity];
+    }
+
+    /**
+      Add a new element at the end of the list, and update 'current' to
+      point to it.  The element is reused and still holds whatever data
+      it had before; the list must not be full.
+    */
+    T& addLast() {
+      myCurrent = mySize++;
+      return current();
+    }
+
+    /**
+      Remove the first/last element, updating 'current' if it happens to be
+      the one removed.
+    */
+    void removeFirst() {
+      // The old first slot is now the last free one
+      myFirst = myFirst + 1 < myCapacity ? myFirst + 1 : 0;
+      --mySize;
+      if(myCurrent != INVALID && myCurrent > 0)
+        --myCurrent;
+      else if(myCurrent >= mySize)
+        myCurrent = INVALID;
+    }
+    void removeLast() {
+      if(myCurrent == --mySize)
+        myCurrent = mySize == 0 ? INVALID : mySize - 1;
+    }
+
+    /**
+      Remove a single element, by its position in the list.  'current'
+      keeps pointing to the same element, unless that's the one removed.
+    */
+    void remove(uInt32 idx) {
+      // Rotate the slot of the removed element to the end of the list
+      for(uInt32 i = idx; i + 1 < mySize; ++i)
+        std::swap(myOrder[position(i)], myOrder[position(i + 1)]);
+      --mySize;
+
+      if(myCurrent != INVALID && myCurrent > idx)
+        --myCurrent;
+      else if(myCurrent >= mySize)
+        myCurrent = INVALID;
+    }
+
+    /**
+      Remove all elements after 'current'.
+    */
+    void removeToLast() {
+      if(currentIsValid())
+        mySize = myCurrent + 1;
+    }
+
+    /**
+      Resize the buffer, invalidating the list in the process (ie, the list
+      essentially becomes empty again).
+    */
+    void resize(uInt32 capacity) {
+      if(myCapacity != capacity)  // only resize when necessary
+      {
+        myElements = vector<T>(capacity);
+        myOrder.resize(capacity);
+        for(uInt32 i = 0; i < capacity; ++i)
+          myOrder[i] = i;
+        myCapacity = capacity;
+        clear();
+      }
+    }
+
+    /**
+      Erase entire contents of the list.
+    */
+    void clear() {
+      myFirst = mySize = 0;
+      myCurrent = INVALID;
+    }
+
+    uInt32 capacity() const { return myCapacity; }
+
+    uInt32 size() const { return mySize;                }
+    bool empty() const  { return mySize == 0;           }
+    bool full() const   { return mySize >= myCapacity;  }
+
+  private:
+    // Index into 'myOrder' of the element at the given position
+    uInt32 position(uInt32 idx) const {
+      idx += myFirst;
+      return idx < myCapacity ? idx : idx - myCapacity;
+    }
+
+  private:
+    static constexpr uInt32 INVALID = ~0u;
+
+    // The elements, indexed by slot
+    vector<T> myElements;
+
+    // Slots of all elements in list order, starting at 'myFirst'; slots
+    // past the end of the list are the free ones
+    vector<uInt32> myOrder;
+
+    uInt32 myCapacity, myFirst, mySize;
+
+    // Position of the current element ('INVALID' if there is none)
+    uInt32 myCurrent;
+
+  private:
+    // Following constructors and assignment operators not supported
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer(RingBuffer&&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+    RingBuffer& operator=(RingBuffer&&) = delete;
+};
+
+}  // Namespace Common
+
+#endif
@@ -0,0 +1,284 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "BSType.hxx"
+#include "CartDetector.hxx"
+#include "MD5.hxx"
+#include "OSystem.hxx"
+#include "Props.hxx"
+#include "PropsSet.hxx"
+
+#include "RomIndex.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RomIndex::RomIndex(OSystem& osystem, const string& filename)
+  : myOSystem(osystem),
+    myFilename(filename),
+    myChanged(false),
+    myActiveJobs(0),
+    myQuit(false)
+{
+  if(myFilename == EmptyString)
+    return;
+
+  ifstream in(myFilename);
+  string tag;
+  uInt32 version = 0;
+  if(!(in >> tag >> version) || tag != "RomIndex" || version != VERSION)
+  {
+    // An outdated file is replaced on the next save
+    myChanged = true;
+    return;
+  }
+
+  // Lines are 'path size modtime md5 type', separated by tabs
+  string line;
+  while(getline(in, line))
+  {
+    string fields[5];
+    size_t pos = 0;
+    for(int i = 0; i < 5 && pos != string::npos; ++i)
+    {
+      size_t next = i < 4 ? line.find('\t', pos) : string::npos;
+      fields[i] = line.substr(pos, next == string::npos ? next : next - pos);
+      pos = next == string::npos ? next : next + 1;
+    }
+    if(fields[0] == EmptyString || fields[3] == EmptyString)
+      continue;
+
+    Entry& entry = myEntries[fields[0]];
+    entry.size = strtoull(fields[1].c_str(), nullptr, 10);
+    entry.modtime = strtoull(fields[2].c_str(), nullptr, 10);
+    entry.md5 = fields[3];
+    entry.type = fields[4];
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RomIndex::~RomIndex()
+{
+  {
+    std::lock_guard<std::mutex> lock(myMutex);
+    myQuit = true;
+  }
+  myJobAvailable.notify_all();
+  for(auto& thread: myThreads)
+    thread.join();
+
+  save();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndex::update(const FilesystemNode& dir, const FSList& files)
+{
+  startWorkers();
+
+  std::set<string> paths;
+  for(const auto& f: files)
+    paths.insert(f.getPath());
+
+  std::lock_guard<std::mutex> lock(myMutex);
+
+  // Forget the files which are no longer in the directory; files in
+  // subdirectories (or inside archives) are left alone
+  const string& dirpath = dir.getPath();
+  for(auto iter = myEntries.lower_bound(dirpath); iter != myEntries.end() &&
+      iter->first.compare(0, dirpath.size(), dirpath) == 0; )
+  {
+    if(iter->first.find_first_of("/\\", dirpath.size()) == string::npos &&
+       paths.find(iter->first) == paths.end())
+    {
+      iter = myEntries.erase(iter);
+      myChanged = true;
+    }
+    else
+      ++iter;
+  }
+
+  // The workers check whether the files have changed, so that listing
+  // a large directory doesn't wait for each file to be examined
+  for(const auto& f: files)
+    myJobs.push_back({ f });
+
+  myJobAvailable.notify_all();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RomIndex::get(const FilesystemNode& rom, Entry& entry)
+{
+  uInt64 size, modtime;
+  if(!rom.getStats(size, modtime))
+    return false;
+
+  std::lock_guard<std::mutex> lock(myMutex);
+
+  auto iter = myEntries.find(rom.getPath());
+  if(iter == myEntries.end() ||
+     iter->second.size != size || iter->second.modtime != modtime)
+    return false;
+
+  entry = iter->second;
+  resolve(entry);
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndex::rename(const string& oldpath, const string& newpath)
+{
+  std::lock_guard<std::mutex> lock(myMutex);
+
+  auto iter = myEntries.find(oldpath);
+  if(iter == myEntries.end())
+    return;
+
+  myEntries[newpath] = iter->second;
+  myEntries.erase(oldpath);
+  myChanged = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 RomIndex::wait(uInt32 timeout)
+{
+  std::unique_lock<std::mutex> lock(myMutex);
+
+  myJobDone.wait_for(lock, std::chrono::milliseconds(timeout),
+      [this] { return myJobs.empty() && myActiveJobs == 0; });
+
+  return uInt32(myJobs.size()) + myActiveJobs;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndex::save()
+{
+  std::lock_guard<std::mutex> lock(myMutex);
+
+  if(!myChanged || myFilename == EmptyString)
+    return;
+
+  ofstream out(myFilename, std::ios::trunc);
+  if(!out)
+    return;
+
+  out << "RomIndex " << VERSION << endl;
+  for(const auto& e: myEntries)
+    out << e.first << '\t' << e.second.size << '\t' << e.second.modtime << '\t'
+        << e.second.md5 << '\t' << e.second.type << endl;
+
+  myChanged = false;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndex::startWorkers()
+{
+  if(!myThreads.empty())
+    return;
+
+  uInt32 threads = std::max(std::thread::hardware_concurrency(), 1u);
+  for(uInt32 i = 0; i < threads; ++i)
+    myThreads.emplace_back([this] { runWorker(); });
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndex::runWorker()
+{
+  std::unique_lock<std::mutex> lock(myMutex);
+
+  for(;;)
+  {
+    myJobAvailable.wait(lock, [this] { return myQuit || !myJobs.empty(); });
+    if(myQuit)
+      return;
+
+    const FilesystemNode rom = myJobs.front().rom;
+    const string& path = rom.getPath();
+    myJobs.pop_front();
+    ++myActiveJobs;
+    lock.unlock();
+
+    // Only files which are new or have changed are read
+    Entry entry;
+    bool valid = rom.getStats(entry.size, entry.modtime), current = false;
+    if(valid)
+    {
+      lock.lock();
+      auto iter = myEntries.find(path);
+      current = iter != myEntries.end() && iter->second.size == entry.size &&
+                iter->second.modtime == entry.modtime;
+      lock.unlock();
+    }
+    if(valid && !current)
+    {
+      try
+      {
+        BytePtr image;
+        uInt32 size = rom.read(image);
+        if(size > 0)
+        {
+          entry.md5 = MD5::hash(image, size);
+          entry.type = Bankswitch::typeToName(
+              CartDetector::autodetectType(image, size));
+        }
+        else
+          valid = false;
+      }
+      catch(...)
+      {
+        valid = false;
+      }
+    }
+
+    lock.lock();
+    if(!valid)
+      myChanged |= myEntries.erase(path) > 0;
+    else if(!current)
+    {
+      myEntries[path] = entry;
+      myChanged = true;
+    }
+    --myActiveJobs;
+    myJobDone.notify_all();
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndex::resolve(Entry& entry) const
+{
+  // Most ROMs only have built-in properties, which can be read directly
+  const PropertiesSet& propSet = myOSystem.propSet();
+  const char* defType   = propSet.getDefault(entry.md5, Cartridge_Type);
+  const char* defFormat = propSet.getDefault(entry.md5, Display_Format);
+  const char* defName   = propSet.getDefault(entry.md5, Cartridge_Name);
+  if(defType && defFormat && defName)
+  {
+    if(*defType != 0 && strcmp(defType, "AUTO") != 0)
+      entry.type = defType;
+    entry.format = *defFormat != 0 ? defFormat :
+                   Properties::getDefault(Display_Format).c_str();
+    entry.name = *defName != 0 ? defName :
+                 Properties::getDefault(Cartridge_Name).c_str();
+    return;
+  }
+
+  Properties props;
+  bool found = propSet.getMD5(entry.md5, props);
+
+  const string& type = props.get(Cartridge_Type);
+  if(type != "AUTO")
+    entry.type = type;
+  entry.format = props.get(Display_Format);
+  entry.name = found ? props.get(Cartridge_Name) : EmptyString;
+}
@@ -0,0 +1,158 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef ROM_INDEX_HXX
+#define ROM_INDEX_HXX
+
+class OSystem;
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "FSNode.hxx"
+#include "bspf.hxx"
+
+/**
+  This class maintains an index of the ROM files seen by the launcher,
+  so that their md5, bankswitch type, display format and name are known
+  without reading (and hashing) each file again.
+
+  Files are identified by their path, and an entry is only valid as long
+  as the size and modification time of the file are unchanged.  New and
+  changed files are read and hashed by a pool of worker threads, which
+  are started the first time a directory is indexed.  The index is kept
+  in a plain text file, which is rewritten when the index is destroyed.
+
+  Only what is derived from the file itself is stored; the fields taken
+  from the properties are looked up whenever an entry is requested, so
+  that they follow any changes to the properties.
+*/
+class RomIndex
+{
+  public:
+    struct Entry {
+      uInt64 size;     // size of the file when it was indexed
+      uInt64 modtime;  // modification time of the file when it was indexed
+      string md5;      // md5 of the ROM image
+      string type;     // bankswitch type (from properties, or autodetected)
+      string format;   // display format (from properties)
+      string name;     // name from the properties, empty if not found
+    };
+
+    /**
+      Create an index from the specified file.  An empty filename gives
+      an index which is never written to disk.
+    */
+    RomIndex(OSystem& osystem, const string& filename);
+    ~RomIndex();
+
+  public:
+    /**
+      Bring the index up to date with the ROM files in a directory.  Files
+      which are new or have changed are queued for hashing, and entries for
+      files no longer in the directory are removed.
+
+      @param dir    The directory being listed
+      @param files  The ROM files in the directory (others are ignored)
+    */
+    void update(const FilesystemNode& dir, const FSList& files);
+
+    /**
+      Get the entry for the given ROM file.  This fails if the file hasn't
+      been indexed yet, or has changed since.
+
+      @param rom    The ROM file
+      @param entry  The entry, if found
+
+      @return  True if a current entry was found, else false
+    */
+    bool get(const FilesystemNode& rom, Entry& entry);
+
+    /**
+      Move the entry of a ROM file which has been renamed.
+    */
+    void rename(const string& oldpath, const string& newpath);
+
+    /**
+      Wait until all queued files have been indexed, or the given time
+      has passed.
+
+      @param timeout  The maximum time to wait, in milliseconds
+
+      @return  The number of files which are still queued or being indexed
+    */
+    uInt32 wait(uInt32 timeout = 0);
+
+    /**
+      Write the index file, if anything has changed.
+    */
+    void save();
+
+  private:
+    // A file to be indexed
+    struct Job {
+      FilesystemNode rom;
+    };
+
+    // Start the worker threads, if not running yet
+    void startWorkers();
+
+    // Main loop of the worker threads; reads and hashes queued files
+    void runWorker();
+
+    // Fill in the fields taken from the properties (must be called on the
+    // thread owning the properties)
+    void resolve(Entry& entry) const;
+
+  private:
+    // Increase whenever the format of the file changes, which invalidates it
+    static constexpr uInt32 VERSION = 2;
+
+    OSystem& myOSystem;
+
+    string myFilename;
+
+    // Entries by path, with the autodetected bankswitch type (the other
+    // fields taken from the properties are empty)
+    std::map<string, Entry> myEntries;
+    bool myChanged;
+
+    // Files waiting to be indexed, and the number being indexed right now
+    std::deque<Job> myJobs;
+    uInt32 myActiveJobs;
+
+    vector<std::thread> myThreads;
+    bool myQuit;
+
+    // Guards everything above which is shared with the workers
+    std::mutex myMutex;
+    std::condition_variable myJobAvailable, myJobDone;
+
+  private:
+    // Following constructors and assignment operators not supported
+    RomIndex() = delete;
+    RomIndex(const RomIndex&) = delete;
+    RomIndex(RomIndex&&) = delete;
+    RomIndex& operator=(const RomIndex&) = delete;
+    RomIndex& operator=(RomIndex&&) = delete;
+};
+
+#endif
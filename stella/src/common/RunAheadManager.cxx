@@ -0,0 +1,128 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "OSystem.hxx"
+#include "Console.hxx"
+#include "EmulationWorker.hxx"
+#include "EventHandler.hxx"
+#include "M6532.hxx"
+#include "Settings.hxx"
+#include "StateManager.hxx"
+#include "TIA.hxx"
+
+#ifdef CHEATCODE_SUPPORT
+  #include "Cheat.hxx"
+  #include "CheatManager.hxx"
+#endif
+
+#include "RunAheadManager.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RunAheadManager::RunAheadManager(OSystem& system, StateManager& statemgr)
+  : myOSystem(system),
+    myStateManager(statemgr),
+    myFrames(0),
+    myOverhead(0.0)
+{
+  // Restoring the sound device would flush the register writes queued
+  // for the real frame, and audio is disabled while running ahead anyway
+  myState.setTransient(true);
+
+  // Changes to the setting take effect immediately
+  myOSystem.settings().addListener(Settings::RunAhead, this,
+                                   [this](const Variant&) { setup(); });
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RunAheadManager::~RunAheadManager()
+{
+  myOSystem.settings().removeListeners(this);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RunAheadManager::setup()
+{
+  myFrames = BSPF::clamp(myOSystem.settings().getInt(Settings::RunAhead),
+                         0, int(MAX_FRAMES));
+  myOverhead = 0.0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RunAheadManager::emulateFrame()
+{
+  Console& console = myOSystem.console();
+  TIA& tia = console.tia();
+
+  // The frame itself is emulated as usual (so that the debugger shows
+  // a complete framebuffer, should a breakpoint be hit)
+  tia.update();
+  if(myFrames == 0 || interrupted())
+    return;
+
+  const uInt64 start = myOSystem.getTicks();
+
+  // Everything from here on is thrown away again, except for the image
+  tia.enableAudio(false);
+  tia.enableRendering(false);
+
+  myState.rewind();
+  if(!myStateManager.saveState(myState))
+  {
+    tia.enableAudio(true);
+    tia.enableRendering(true);
+    myFrames = 0;
+    return;
+  }
+
+  for(uInt32 frame = 1; frame <= myFrames; ++frame)
+  {
+    if(frame == myFrames)
+      tia.enableRendering(true);
+
+    // Same as EventHandler::updateEmulation(), minus rewind and movies
+    console.riot().update();
+  #ifdef CHEATCODE_SUPPORT
+    for(auto& cheat: myOSystem.cheat().perFrame())
+      cheat->evaluate();
+  #endif
+    tia.update();
+
+    // The debugger has to see the state the breakpoint was hit in;
+    // the frames run ahead become the real ones
+    if(interrupted())
+    {
+      tia.enableAudio(true);
+      tia.enableRendering(true);
+      return;
+    }
+  }
+
+  // The framebuffer isn't part of the state, so the frame run ahead
+  // stays there to be presented
+  myState.rewind();
+  myStateManager.loadState(myState);
+  tia.enableAudio(true);
+
+  myOverhead += (double(myOSystem.getTicks() - start) - myOverhead) / 16;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RunAheadManager::interrupted() const
+{
+  return myOSystem.eventHandler().state() != EventHandlerState::EMULATION ||
+         myOSystem.emulationWorker().debuggerRequested();
+}
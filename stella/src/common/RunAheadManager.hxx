@@ -0,0 +1,97 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef RUN_AHEAD_MANAGER_HXX
+#define RUN_AHEAD_MANAGER_HXX
+
+class OSystem;
+class StateManager;
+
+#include "Serializer.hxx"
+#include "bspf.hxx"
+
+/**
+  This class hides the input lag built into many games.  Each frame, the
+  state after emulating it is saved, and the console is run some frames
+  further, with the current input and without sound.  The last of these
+  frames is the one shown; then the saved state is restored.  So input
+  shows up on screen as many frames earlier as the game would delay it.
+
+  Only the last frame of each run ahead is drawn into the framebuffer,
+  and the cost of it all (saving, emulating, restoring) is tracked, so
+  that it can be shown with the frame stats.
+*/
+class RunAheadManager
+{
+  public:
+    RunAheadManager(OSystem& system, StateManager& statemgr);
+    ~RunAheadManager();
+
+  public:
+    // The maximum number of frames to run ahead
+    static constexpr uInt32 MAX_FRAMES = 6;
+
+    /**
+      Set the number of frames to run ahead from the settings.
+    */
+    void setup();
+
+    /**
+      The number of frames run ahead (0 when disabled).
+    */
+    uInt32 frames() const { return myFrames; }
+
+    /**
+      Emulate the next frame, and run ahead from there (if enabled).
+      Replaces TIA::update() when the frames are presented.
+    */
+    void emulateFrame();
+
+    /**
+      The average time spent running ahead, in microseconds per frame.
+    */
+    uInt32 overhead() const { return uInt32(myOverhead); }
+
+  private:
+    /**
+      Answers whether the emulation was stopped during the last frame
+      (ie, a breakpoint was hit).
+    */
+    bool interrupted() const;
+
+  private:
+    OSystem& myOSystem;
+    StateManager& myStateManager;
+
+    uInt32 myFrames;
+
+    // The state to return to after running ahead
+    Serializer myState;
+
+    // Running average of the time spent per frame, in microseconds
+    double myOverhead;
+
+  private:
+    // Following constructors and assignment operators not supported
+    RunAheadManager() = delete;
+    RunAheadManager(const RunAheadManager&) = delete;
+    RunAheadManager(RunAheadManager&&) = delete;
+    RunAheadManager& operator=(const RunAheadManager&) = delete;
+    RunAheadManager& operator=(RunAheadManager&&) = delete;
+};
+
+#endif
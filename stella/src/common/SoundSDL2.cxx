@@ -176,8 +176,24 @@ void SoundSDL2::mute(bool state)
 {
   if(myIsInitializedFlag)
   {
+    // The flag is read by set(), possibly on the emulation thread
+    SDL_LockAudio();
     myIsMuted = state;
-    SDL_PauseAudio(myIsMuted ? 1 : 0);
+
+    // Register writes are applied immediately while muted (see set()),
+    // so the ones still queued have to go first
+    if(myIsMuted)
+    {
+      while(myRegWriteQueue.size() > 0)
+      {
+        RegWrite& info = myRegWriteQueue.front();
+        myTIASound.set(info.addr, info.value);
+        myRegWriteQueue.dequeue();
+      }
+    }
+    SDL_UnlockAudio();
+
+    SDL_PauseAudio(state ? 1 : 0);
   }
 }
 
@@ -254,6 +270,17 @@ void SoundSDL2::set(uInt16 addr, uInt8 value, uInt64 cycle)
 {
   SDL_LockAudio();
 
+  // Nothing is played while muted, so there's no point in queueing the
+  // write (the queue would only grow, ie. while fast-forwarding); the
+  // registers just have to be current once sound resumes
+  if(myIsMuted)
+  {
+    myTIASound.set(addr, value);
+    myLastRegisterSetCycle = cycle;
+    SDL_UnlockAudio();
+    return;
+  }
+
   // First, calculate how many seconds would have past since the last
   // register write on a real 2600
   double delta = double(cycle - myLastRegisterSetCycle) / 1193191.66666667;
@@ -20,15 +20,17 @@
 #include "Console.hxx"
 #include "Cart.hxx"
 #include "Control.hxx"
+#include "EventHandler.hxx"
 #include "Switches.hxx"
 #include "System.hxx"
 #include "Serializable.hxx"
 #include "RewindManager.hxx"
+#include "MovieManager.hxx"
+#include "RunAheadManager.hxx"
 
 #include "StateManager.hxx"
 
 #define STATE_HEADER "05019000state"
-// #define MOVIE_HEADER "03030000movie"
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 StateManager::StateManager(OSystem& osystem)
@@ -37,6 +39,8 @@ StateManager::StateManager(OSystem& osystem)
     myActiveMode(Mode::Off)
 {
   myRewindManager = make_unique<RewindManager>(myOSystem, *this);
+  myMovieManager = make_unique<MovieManager>(myOSystem, *this);
+  myRunAheadManager = make_unique<RunAheadManager>(myOSystem, *this);
   reset();
 }
 
@@ -45,100 +49,119 @@ StateManager::~StateManager()
 {
 }
 
-#if 0
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void StateManager::toggleRecordMode()
 {
-  if(myActiveMode != kMovieRecordMode)  // Turn on movie record mode
+  if(myActiveMode != Mode::MovieRecord)  // Turn on movie record mode
   {
-    myActiveMode = kOffMode;
-
-    string moviefile = /*myOSystem.baseDir() +*/ "test.inp";
-    if(myMovieWriter.isOpen())
-      myMovieWriter.close();
-    if(!myMovieWriter.open(moviefile))
-      return false;
-
-    // Prepend the ROM md5 so this state file only works with that ROM
-    myMovieWriter.putString(myOSystem.console().properties().get(Cartridge_MD5));
-
-    if(!myOSystem.console().save(myMovieWriter))
-      return false;
-
-    // Save controller types for this ROM
-    // We need to check this, since some controllers save more state than
-    // normal, and those states files wouldn't be compatible with normal
-    // controllers.
-    myMovieWriter.putString(
-      myOSystem.console().controller(Controller::Left).name());
-    myMovieWriter.putString(
-      myOSystem.console().controller(Controller::Right).name());
-
-    // If we get this far, we're really in movie record mode
-    myActiveMode = kMovieRecordMode;
+    if(myActiveMode == Mode::MoviePlayback)
+      stopMoviePlayback();
+
+    if(startMovieRecord())
+      myOSystem.frameBuffer().showMessage("Movie recording started");
+    else
+      myOSystem.frameBuffer().showMessage("Error starting movie recording");
   }
   else  // Turn off movie record mode
   {
-    myActiveMode = kOffMode;
-    myMovieWriter.close();
-    return false;
+    if(stopMovieRecord(movieFile()))
+      myOSystem.frameBuffer().showMessage("Movie recording saved");
+    else
+      myOSystem.frameBuffer().showMessage("Error saving movie");
   }
+}
 
-  return myActiveMode == kMovieRecordMode;
-////////////////////////////////////////////////////////
-// FIXME - For now, I'm going to use this to activate movie playback
-  // Close the writer, since we're about to re-open in read mode
-  myMovieWriter.close();
-
-  if(myActiveMode != kMoviePlaybackMode)  // Turn on movie playback mode
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void StateManager::togglePlaybackMode()
+{
+  if(myActiveMode != Mode::MoviePlayback)  // Turn on movie playback mode
   {
-    myActiveMode = kOffMode;
+    if(myActiveMode == Mode::MovieRecord)
+      stopMovieRecord(movieFile());
 
-    string moviefile = /*myOSystem.baseDir() + */ "test.inp";
-    if(myMovieReader.isOpen())
-      myMovieReader.close();
-    if(!myMovieReader.open(moviefile))
-      return false;
+    if(startMoviePlayback(movieFile()))
+      myOSystem.frameBuffer().showMessage("Movie playback started");
+    else
+      myOSystem.frameBuffer().showMessage("Can't open/load movie file");
+  }
+  else  // Turn off movie playback mode
+  {
+    stopMoviePlayback();
+    myOSystem.frameBuffer().showMessage("Movie playback stopped");
+  }
+}
 
-    // Check the ROM md5
-    if(myMovieReader.getString() !=
-       myOSystem.console().properties().get(Cartridge_MD5))
-      return false;
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool StateManager::startMovieRecord()
+{
+  myActiveMode = Mode::Off;
+  if(!myOSystem.hasConsole() || !myMovieManager->startRecording())
+  {
+    myActiveMode = defaultMode();
+    return false;
+  }
 
-    if(!myOSystem.console().load(myMovieReader))
-      return false;
+  // If we get this far, we're really in movie record mode
+  myActiveMode = Mode::MovieRecord;
+  return true;
+}
 
-    // Check controller types
-    const string& left  = myMovieReader.getString();
-    const string& right = myMovieReader.getString();
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool StateManager::stopMovieRecord(const string& filename)
+{
+  if(myActiveMode != Mode::MovieRecord)
+    return false;
 
-    if(left != myOSystem.console().controller(Controller::Left).name() ||
-       right != myOSystem.console().controller(Controller::Right).name())
-      return false;
+  myActiveMode = defaultMode();
+  return myMovieManager->save(filename);
+}
 
-    // If we get this far, we're really in movie record mode
-    myActiveMode = kMoviePlaybackMode;
-  }
-  else  // Turn off movie playback mode
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool StateManager::startMoviePlayback(const string& filename)
+{
+  myActiveMode = Mode::Off;
+  if(!myOSystem.hasConsole() || !myMovieManager->load(filename) ||
+     !myMovieManager->seek(0))
   {
-    myActiveMode = kOffMode;
-    myMovieReader.close();
+    myActiveMode = defaultMode();
     return false;
   }
+
+  // If we get this far, we're really in movie playback mode
+  myActiveMode = Mode::MoviePlayback;
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void StateManager::stopMoviePlayback()
+{
+  if(myActiveMode == Mode::MoviePlayback)
+    myActiveMode = defaultMode();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void StateManager::stopMovie()
+{
+  if(myActiveMode == Mode::MovieRecord)
+    toggleRecordMode();
+  else if(myActiveMode == Mode::MoviePlayback)
+    togglePlaybackMode();
 }
-#endif
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void StateManager::toggleTimeMachine()
 {
   bool devSettings = myOSystem.settings().getBool("dev.settings");
+  bool enable = defaultMode() != Mode::TimeMachine;
 
-  myActiveMode = myActiveMode == Mode::TimeMachine ? Mode::Off : Mode::TimeMachine;
-  if(myActiveMode == Mode::TimeMachine)
+  // A movie stays active; defaultMode() is used once it ends
+  if(!movieActive())
+    myActiveMode = enable ? Mode::TimeMachine : Mode::Off;
+  if(enable)
     myOSystem.frameBuffer().showMessage("Time Machine enabled");
   else
     myOSystem.frameBuffer().showMessage("Time Machine disabled");
-  myOSystem.settings().setValue(devSettings ? "dev.timemachine" : "plr.timemachine", myActiveMode == Mode::TimeMachine);
+  myOSystem.settings().setValue(devSettings ? "dev.timemachine" : "plr.timemachine", enable);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -182,19 +205,18 @@ void StateManager::update()
       myRewindManager->addState("Time Machine", true);
       break;
 
-#if 0
     case Mode::MovieRecord:
-      myOSystem.console().controller(Controller::Left).save(myMovieWriter);
-      myOSystem.console().controller(Controller::Right).save(myMovieWriter);
-      myOSystem.console().switches().save(myMovieWriter);
+      myMovieManager->recordFrame(myOSystem.eventHandler().event());
       break;
 
     case Mode::MoviePlayback:
-      myOSystem.console().controller(Controller::Left).load(myMovieReader);
-      myOSystem.console().controller(Controller::Right).load(myMovieReader);
-      myOSystem.console().switches().load(myMovieReader);
+      if(!myMovieManager->playFrame(myOSystem.eventHandler().event()))
+      {
+        stopMoviePlayback();
+        myOSystem.frameBuffer().showMessage("Movie playback finished");
+      }
       break;
-#endif
+
     default:
       break;
   }
@@ -233,6 +255,7 @@ void StateManager::loadState(int slot)
         buf << "State " << slot << " file doesn't match current ROM";
       else
       {
+        stopMovie();
         if(myOSystem.console().load(in))
           buf << "State " << slot << " loaded";
         else
@@ -374,25 +397,21 @@ bool StateManager::saveState(Serializer& out)
 void StateManager::reset()
 {
   myRewindManager->clear();
-  myActiveMode = myOSystem.settings().getBool(
-    myOSystem.settings().getBool("dev.settings") ? "dev.timemachine" : "plr.timemachine") ? Mode::TimeMachine : Mode::Off;
-
-#if 0
-  myCurrentSlot = 0;
-
-  switch(myActiveMode)
-  {
-    case kMovieRecordMode:
-      myMovieWriter.close();
-      break;
+  myMovieManager->clear();
+  myRunAheadManager->setup();
+  myActiveMode = defaultMode();
+}
 
-    case kMoviePlaybackMode:
-      myMovieReader.close();
-      break;
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+StateManager::Mode StateManager::defaultMode() const
+{
+  return myOSystem.settings().getBool(
+    myOSystem.settings().getBool("dev.settings") ? "dev.timemachine" : "plr.timemachine") ? Mode::TimeMachine : Mode::Off;
+}
 
-    default:
-      break;
-  }
-  myActiveMode = kOffMode;
-#endif
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string StateManager::movieFile() const
+{
+  return myOSystem.stateDir() +
+         myOSystem.console().properties().get(Cartridge_Name) + ".inp";
 }
@@ -20,6 +20,8 @@
 
 class OSystem;
 class RewindManager;
+class MovieManager;
+class RunAheadManager;
 
 #include "Serializer.hxx"
 
@@ -52,24 +54,65 @@ class StateManager
     */
     Mode mode() const { return myActiveMode; }
 
-#if 0
     /**
-      Toggle movie recording mode (FIXME - currently disabled)
+      Answers whether a movie is being recorded or played back.
+    */
+    bool movieActive() const {
+      return myActiveMode == Mode::MovieRecord || myActiveMode == Mode::MoviePlayback;
+    }
+
+    /**
+      Toggle movie recording mode; when recording stops, the movie is saved
+      to the state directory, named after the ROM.
     */
     void toggleRecordMode();
-#endif
+
+    /**
+      Toggle movie playback mode, using the movie last recorded for the
+      ROM (see toggleRecordMode()).
+    */
+    void togglePlaybackMode();
+
+    /**
+      Start recording a movie from the current state, and stop recording
+      and save the movie to the given file.  No messages are printed to
+      the screen.
+
+      @return  False on any errors, else true
+    */
+    bool startMovieRecord();
+    bool stopMovieRecord(const string& filename);
+
+    /**
+      Start playing back the movie in the given file from its start, and
+      stop playback.  No messages are printed to the screen.  Playback
+      also stops at the end of the movie.
+
+      @return  False on any errors, else true
+    */
+    bool startMoviePlayback(const string& filename);
+    void stopMoviePlayback();
+
+    /**
+      Stop an active movie like toggleRecordMode()/togglePlaybackMode() do.
+      Must be called before the state of the system is changed other than
+      by emulating (ie, loading a state or rewinding), which would make the
+      movie useless.
+    */
+    void stopMovie();
 
     /**
       Toggle state rewind recording mode; this uses the RewindManager
-      for its functionality.
+      for its functionality.  An active movie is kept; the new mode takes
+      effect when it ends.
     */
     void toggleTimeMachine();
 
     /**
       Sets state rewind recording mode; this uses the RewindManager
-      for its functionality.
+      for its functionality.  Ignored while a movie is active.
     */
-    void setRewindMode(Mode mode) { myActiveMode = mode; }
+    void setRewindMode(Mode mode) { if(!movieActive()) myActiveMode = mode; }
 
     /**
       Optionally adds one extra state when entering the Time Machine dialog;
@@ -146,6 +189,16 @@ class StateManager
     */
     RewindManager& rewindManager() const { return *myRewindManager; }
 
+    /**
+      The movie facility for the state manager
+    */
+    MovieManager& movieManager() const { return *myMovieManager; }
+
+    /**
+      The run-ahead facility for the state manager
+    */
+    RunAheadManager& runAheadManager() const { return *myRunAheadManager; }
+
   private:
     enum {
       kVersion = 001
@@ -160,16 +213,27 @@ class StateManager
     // Whether the manager is in record or playback mode
     Mode myActiveMode;
 
-    // MD5 of the currently active ROM (either in movie or rewind mode)
-    string myMD5;
-
-    // Serializer classes used to save/load the eventstream
-    Serializer myMovieWriter;
-    Serializer myMovieReader;
-
     // Stored savestates to be later rewound
     unique_ptr<RewindManager> myRewindManager;
 
+    // The movie being recorded or played back
+    unique_ptr<MovieManager> myMovieManager;
+
+    // Runs the emulation ahead, to hide input lag
+    unique_ptr<RunAheadManager> myRunAheadManager;
+
+  private:
+    /**
+      The mode when no movie is active (depending on the Time Machine
+      setting).
+    */
+    Mode defaultMode() const;
+
+    /**
+      The file used by toggleRecordMode() and togglePlaybackMode().
+    */
+    string movieFile() const;
+
   private:
     // Following constructors and assignment operators not supported
     StateManager() = delete;
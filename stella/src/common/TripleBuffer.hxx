@@ -0,0 +1,95 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef TRIPLE_BUFFER_HXX
+#define TRIPLE_BUFFER_HXX
+
+#include <atomic>
+#include "bspf.hxx"
+
+/**
+  A lock-free triple buffer, used to hand data (ie, complete frames) from
+  one producer thread to one consumer thread.
+
+  The producer always fills the 'back' buffer, and then exchanges it with
+  the 'middle' buffer.  The consumer exchanges the 'front' buffer with the
+  middle one whenever it has been refreshed in the meantime.  Neither side
+  ever waits for the other; the producer simply overwrites a middle buffer
+  the consumer didn't pick up in time, so that the consumer always sees
+  the newest complete data.
+*/
+namespace Common {
+
+template <class T>
+class TripleBuffer
+{
+  public:
+    TripleBuffer() : myBuffers(), myBack(0), myMiddle(1), myFront(2) { }
+
+    /**
+      The buffer to be filled by the producer.
+    */
+    T& back() { return myBuffers[myBack]; }
+
+    /**
+      Make the back buffer available to the consumer, replacing any data
+      it didn't pick up yet.
+    */
+    void publish() {
+      myBack = myMiddle.exchange(myBack | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+
+    /**
+      Make the most recently published buffer the front buffer.
+
+      @return  False if nothing was published since the last call
+    */
+    bool acquire() {
+      if(!(myMiddle.load(std::memory_order_relaxed) & FRESH))
+        return false;
+
+      myFront = myMiddle.exchange(myFront, std::memory_order_acq_rel) & INDEX;
+      return true;
+    }
+
+    /**
+      The buffer to be read by the consumer.
+    */
+    const T& front() const { return myBuffers[myFront]; }
+
+  private:
+    // The middle index carries a flag telling whether it was published
+    // since the consumer last acquired it
+    static constexpr uInt8 INDEX = 0x03, FRESH = 0x04;
+
+    T myBuffers[3];
+
+    uInt8 myBack;
+    std::atomic<uInt8> myMiddle;
+    uInt8 myFront;
+
+  private:
+    // Following constructors and assignment operators not supported
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer(TripleBuffer&&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(TripleBuffer&&) = delete;
+};
+
+} // Namespace Common
+
+#endif
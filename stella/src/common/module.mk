@@ -2,21 +2,31 @@ MODULE := src/common
 
 MODULE_OBJS := \
 	src/common/Base.o \
-	src/common/EventHandlerSDL2.o \
-	src/common/FBSurfaceSDL2.o \
-	src/common/FrameBufferSDL2.o \
+	src/common/EmulationWorker.o \
 	src/common/FSNodeZIP.o \
-	src/common/main.o \
+	src/common/InputQueue.o \
 	src/common/MouseControl.o \
+	src/common/MovieManager.o \
 	src/common/PhysicalJoystick.o \
 	src/common/PJoystickHandler.o \
 	src/common/PKeyboardHandler.o \
 	src/common/PNGLibrary.o \
 	src/common/RewindManager.o \
-	src/common/SoundSDL2.o \
+	src/common/RomIndex.o \
+	src/common/RunAheadManager.o \
 	src/common/StateManager.o \
 	src/common/ZipHandler.o
 
+# The SDL2 backend and the application itself aren't part of libstella-core
+ifndef HEADLESS
+MODULE_OBJS += \
+	src/common/EventHandlerSDL2.o \
+	src/common/FBSurfaceSDL2.o \
+	src/common/FrameBufferSDL2.o \
+	src/common/main.o \
+	src/common/SoundSDL2.o
+endif
+
 MODULE_DIRS += \
 	src/common
 
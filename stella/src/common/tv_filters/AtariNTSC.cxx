@@ -18,6 +18,18 @@
 #include <thread>
 #include "AtariNTSC.hxx"
 
+#ifdef ATARI_NTSC_X86
+  #include <immintrin.h>
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+    #define ATARI_NTSC_TARGET(isa)
+  #else
+    // The vector kernels are compiled for their instruction set regardless
+    // of the build flags, and only used if the CPU supports them
+    #define ATARI_NTSC_TARGET(isa) __attribute__((target(isa)))
+  #endif
+#endif
+
 // blitter related
 #ifndef restrict
   #if defined (__GNUC__)
@@ -67,9 +79,21 @@ void AtariNTSC::initializePalette(const uInt8* palette)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void AtariNTSC::enableThreading(bool enable)
+AtariNTSC::~AtariNTSC()
 {
-  uInt32 systemThreads = enable ? std::thread::hardware_concurrency() : 0;
+  stopWorkers();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AtariNTSC::enableThreading(bool enable, uInt32 threads)
+{
+  stopWorkers();
+
+  uInt32 systemThreads = 0;
+  if(enable)
+    systemThreads = threads > 0 ? threads :
+                    std::min(4u, std::thread::hardware_concurrency());
+
   if(systemThreads <= 1)
   {
     myWorkerThreads = 0;
@@ -77,12 +101,61 @@ void AtariNTSC::enableThreading(bool enable)
   }
   else
   {
-    systemThreads = std::min(4u, systemThreads);
-
     myWorkerThreads = systemThreads - 1;
     myTotalThreads  = systemThreads;
 
+    myShutdown = false;
     myThreads = make_unique<std::thread[]>(myWorkerThreads);
+    for(uInt32 i = 0; i < myWorkerThreads; ++i)
+      myThreads[i] = std::thread([this] { runWorker(); });
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AtariNTSC::stopWorkers()
+{
+  if(myWorkerThreads == 0)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(myMutex);
+    myShutdown = true;
+  }
+  myJobAvailable.notify_all();
+
+  for(uInt32 i = 0; i < myWorkerThreads; ++i)
+    myThreads[i].join();
+
+  myThreads.reset();
+  myWorkerThreads = 0;
+  myTotalThreads  = 1;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AtariNTSC::runWorker()
+{
+  uInt32 generation = 0;
+
+  for(;;)
+  {
+    {
+      std::unique_lock<std::mutex> lock(myMutex);
+      myJobAvailable.wait(lock, [&] {
+        return myShutdown || myGeneration != generation;
+      });
+      if(myShutdown)
+        return;
+
+      generation = myGeneration;
+    }
+
+    renderBands();
+
+    {
+      std::lock_guard<std::mutex> lock(myMutex);
+      if(--myBusyWorkers == 0)
+        myJobDone.notify_one();
+    }
   }
 }
 
@@ -90,36 +163,64 @@ void AtariNTSC::enableThreading(bool enable)
 void AtariNTSC::render(const uInt8* atari_in, const uInt32 in_width, const uInt32 in_height,
   void* rgb_out, const uInt32 out_pitch, uInt32* rgb_in)
 {
-  // Spawn the threads...
-  for(uInt32 i = 0; i < myWorkerThreads; ++i)
+  // Several bands per thread, so that a thread that gets descheduled
+  // doesn't hold up the whole frame
+  const uInt32 bands = myTotalThreads * 4;
+
+  myJob = { atari_in, in_width, in_height, rgb_out, out_pitch, rgb_in,
+            (in_height + bands - 1) / bands };
+  myNextBand = 0;
+
+  // Wake up the workers...
+  if(myWorkerThreads > 0)
   {
-    myThreads[i] = std::thread([=] {
-    rgb_in == nullptr ?
-      renderThread(atari_in, in_width, in_height, myTotalThreads, i+1, rgb_out, out_pitch) :
-      renderWithPhosphorThread(atari_in, in_width, in_height, myTotalThreads, i+1, rgb_in, rgb_out, out_pitch);
-    });
+    {
+      std::lock_guard<std::mutex> lock(myMutex);
+      myBusyWorkers = myWorkerThreads;
+      ++myGeneration;
+    }
+    myJobAvailable.notify_all();
   }
+
   // Make the main thread busy too
-  rgb_in == nullptr ?
-    renderThread(atari_in, in_width, in_height, myTotalThreads, 0, rgb_out, out_pitch) :
-    renderWithPhosphorThread(atari_in, in_width, in_height, myTotalThreads, 0, rgb_in, rgb_out, out_pitch);
-  // ...and make them join again
-  for(uInt32 i = 0; i < myWorkerThreads; ++i)
-    myThreads[i].join();
+  renderBands();
+
+  // ...and wait until they're done
+  if(myWorkerThreads > 0)
+  {
+    std::unique_lock<std::mutex> lock(myMutex);
+    myJobDone.wait(lock, [this] { return myBusyWorkers == 0; });
+  }
 
   // Copy phosphor values into out buffer
   if(rgb_in != nullptr)
     memcpy(rgb_out, rgb_in, in_height * out_pitch);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AtariNTSC::renderBands()
+{
+  const Job& job = myJob;
+
+  if(job.bandHeight == 0)
+    return;
+
+  for(uInt32 band = myNextBand++; band * job.bandHeight < job.in_height; band = myNextBand++)
+  {
+    const uInt32 yStart = band * job.bandHeight;
+    const uInt32 yEnd = std::min(yStart + job.bandHeight, job.in_height);
+
+    job.rgb_in == nullptr ?
+      renderThread(job.atari_in, job.in_width, yStart, yEnd, job.rgb_out, job.out_pitch) :
+      renderWithPhosphorThread(job.atari_in, job.in_width, yStart, yEnd, job.rgb_in, job.rgb_out, job.out_pitch);
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void AtariNTSC::renderThread(const uInt8* atari_in, const uInt32 in_width,
-  const uInt32 in_height, const uInt32 numThreads, const uInt32 threadNum,
-  void* rgb_out, const uInt32 out_pitch)
+  const uInt32 yStart, const uInt32 yEnd, void* rgb_out, const uInt32 out_pitch)
 {
-  // Adapt parameters to thread number
-  const uInt32 yStart = in_height * threadNum / numThreads;
-  const uInt32 yEnd = in_height * (threadNum + 1) / numThreads;
+  // Adapt parameters to the band of rows
   atari_in += in_width * yStart;
   rgb_out  = static_cast<char*>(rgb_out) + out_pitch * yStart;
 
@@ -127,56 +228,7 @@ void AtariNTSC::renderThread(const uInt8* atari_in, const uInt32 in_width,
 
   for(uInt32 y = yStart; y < yEnd; ++y)
   {
-    const uInt8* line_in = atari_in;
-    ATARI_NTSC_BEGIN_ROW(NTSC_black, line_in[0]);
-    uInt32* restrict line_out = static_cast<uInt32*>(rgb_out);
-    ++line_in;
-
-    for(uInt32 n = chunk_count; n; --n)
-    {
-      // order of input and output pixels must not be altered
-      ATARI_NTSC_COLOR_IN(0, line_in[0]);
-      ATARI_NTSC_RGB_OUT_8888(0, line_out[0]);
-      ATARI_NTSC_RGB_OUT_8888(1, line_out[1]);
-      ATARI_NTSC_RGB_OUT_8888(2, line_out[2]);
-      ATARI_NTSC_RGB_OUT_8888(3, line_out[3]);
-
-      ATARI_NTSC_COLOR_IN(1, line_in[1]);
-      ATARI_NTSC_RGB_OUT_8888(4, line_out[4]);
-      ATARI_NTSC_RGB_OUT_8888(5, line_out[5]);
-      ATARI_NTSC_RGB_OUT_8888(6, line_out[6]);
-
-      line_in += 2;
-      line_out += 7;
-    }
-
-    // finish final pixels
-    ATARI_NTSC_COLOR_IN(0, line_in[0]);
-    ATARI_NTSC_RGB_OUT_8888(0, line_out[0]);
-    ATARI_NTSC_RGB_OUT_8888(1, line_out[1]);
-    ATARI_NTSC_RGB_OUT_8888(2, line_out[2]);
-    ATARI_NTSC_RGB_OUT_8888(3, line_out[3]);
-
-    ATARI_NTSC_COLOR_IN(1, NTSC_black);
-    ATARI_NTSC_RGB_OUT_8888(4, line_out[4]);
-    ATARI_NTSC_RGB_OUT_8888(5, line_out[5]);
-    ATARI_NTSC_RGB_OUT_8888(6, line_out[6]);
-
-    line_in += 2;
-    line_out += 7;
-
-    ATARI_NTSC_COLOR_IN(0, NTSC_black);
-    ATARI_NTSC_RGB_OUT_8888(0, line_out[0]);
-    ATARI_NTSC_RGB_OUT_8888(1, line_out[1]);
-    ATARI_NTSC_RGB_OUT_8888(2, line_out[2]);
-    ATARI_NTSC_RGB_OUT_8888(3, line_out[3]);
-
-    ATARI_NTSC_COLOR_IN(1, NTSC_black);
-    ATARI_NTSC_RGB_OUT_8888(4, line_out[4]);
-#if 0
-    ATARI_NTSC_RGB_OUT_8888(5, line_out[5]);
-    ATARI_NTSC_RGB_OUT_8888(6, line_out[6]);
-#endif
+    (this->*myRenderRow)(atari_in, static_cast<uInt32*>(rgb_out), chunk_count);
 
     atari_in += in_width;
     rgb_out = static_cast<char*>(rgb_out) + out_pitch;
@@ -185,12 +237,9 @@ void AtariNTSC::renderThread(const uInt8* atari_in, const uInt32 in_width,
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void AtariNTSC::renderWithPhosphorThread(const uInt8* atari_in, const uInt32 in_width,
-  const uInt32 in_height, const uInt32 numThreads, const uInt32 threadNum,
-  uInt32* rgb_in, void* rgb_out, const uInt32 out_pitch)
+  const uInt32 yStart, const uInt32 yEnd, uInt32* rgb_in, void* rgb_out, const uInt32 out_pitch)
 {
-  // Adapt parameters to thread number
-  const uInt32 yStart = in_height * threadNum / numThreads;
-  const uInt32 yEnd = in_height * (threadNum + 1) / numThreads;
+  // Adapt parameters to the band of rows
   uInt32 bufofs = AtariNTSC::outWidth(in_width) * yStart;
   uInt32* out = static_cast<uInt32*>(rgb_out);
   atari_in += in_width * yStart;
@@ -200,56 +249,7 @@ void AtariNTSC::renderWithPhosphorThread(const uInt8* atari_in, const uInt32 in_
 
   for(uInt32 y = yStart; y < yEnd; ++y)
   {
-    const uInt8* line_in = atari_in;
-    ATARI_NTSC_BEGIN_ROW(NTSC_black, line_in[0]);
-    uInt32* restrict line_out = static_cast<uInt32*>(rgb_out);
-    ++line_in;
-
-    for(uInt32 n = chunk_count; n; --n)
-    {
-      // order of input and output pixels must not be altered
-      ATARI_NTSC_COLOR_IN(0, line_in[0]);
-      ATARI_NTSC_RGB_OUT_8888(0, line_out[0]);
-      ATARI_NTSC_RGB_OUT_8888(1, line_out[1]);
-      ATARI_NTSC_RGB_OUT_8888(2, line_out[2]);
-      ATARI_NTSC_RGB_OUT_8888(3, line_out[3]);
-
-      ATARI_NTSC_COLOR_IN(1, line_in[1]);
-      ATARI_NTSC_RGB_OUT_8888(4, line_out[4]);
-      ATARI_NTSC_RGB_OUT_8888(5, line_out[5]);
-      ATARI_NTSC_RGB_OUT_8888(6, line_out[6]);
-
-      line_in += 2;
-      line_out += 7;
-    }
-
-    // finish final pixels
-    ATARI_NTSC_COLOR_IN(0, line_in[0]);
-    ATARI_NTSC_RGB_OUT_8888(0, line_out[0]);
-    ATARI_NTSC_RGB_OUT_8888(1, line_out[1]);
-    ATARI_NTSC_RGB_OUT_8888(2, line_out[2]);
-    ATARI_NTSC_RGB_OUT_8888(3, line_out[3]);
-
-    ATARI_NTSC_COLOR_IN(1, NTSC_black);
-    ATARI_NTSC_RGB_OUT_8888(4, line_out[4]);
-    ATARI_NTSC_RGB_OUT_8888(5, line_out[5]);
-    ATARI_NTSC_RGB_OUT_8888(6, line_out[6]);
-
-    line_in += 2;
-    line_out += 7;
-
-    ATARI_NTSC_COLOR_IN(0, NTSC_black);
-    ATARI_NTSC_RGB_OUT_8888(0, line_out[0]);
-    ATARI_NTSC_RGB_OUT_8888(1, line_out[1]);
-    ATARI_NTSC_RGB_OUT_8888(2, line_out[2]);
-    ATARI_NTSC_RGB_OUT_8888(3, line_out[3]);
-
-    ATARI_NTSC_COLOR_IN(1, NTSC_black);
-    ATARI_NTSC_RGB_OUT_8888(4, line_out[4]);
-#if 0
-    ATARI_NTSC_RGB_OUT_8888(5, line_out[5]);
-    ATARI_NTSC_RGB_OUT_8888(6, line_out[6]);
-#endif
+    (this->*myRenderRow)(atari_in, static_cast<uInt32*>(rgb_out), chunk_count);
 
     // Do phosphor mode (blend the resulting frames)
     // Note: The code assumes that AtariNTSC::outWidth(kTIAW) == outPitch == 565
@@ -296,6 +296,217 @@ void AtariNTSC::renderWithPhosphorThread(const uInt8* atari_in, const uInt32 in_
   }
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AtariNTSC::renderRow(const uInt8* line_in, uInt32* restrict line_out,
+                          const uInt32 chunk_count) const
+{
+  ATARI_NTSC_BEGIN_ROW(NTSC_black, line_in[0]);
+  ++line_in;
+
+  for(uInt32 n = chunk_count; n; --n)
+  {
+    // order of input and output pixels must not be altered
+    ATARI_NTSC_COLOR_IN(0, line_in[0]);
+    ATARI_NTSC_RGB_OUT_8888(0, line_out[0]);
+    ATARI_NTSC_RGB_OUT_8888(1, line_out[1]);
+    ATARI_NTSC_RGB_OUT_8888(2, line_out[2]);
+    ATARI_NTSC_RGB_OUT_8888(3, line_out[3]);
+
+    ATARI_NTSC_COLOR_IN(1, line_in[1]);
+    ATARI_NTSC_RGB_OUT_8888(4, line_out[4]);
+    ATARI_NTSC_RGB_OUT_8888(5, line_out[5]);
+    ATARI_NTSC_RGB_OUT_8888(6, line_out[6]);
+
+    line_in += 2;
+    line_out += 7;
+  }
+
+  // finish final pixels
+  ATARI_NTSC_COLOR_IN(0, line_in[0]);
+  ATARI_NTSC_RGB_OUT_8888(0, line_out[0]);
+  ATARI_NTSC_RGB_OUT_8888(1, line_out[1]);
+  ATARI_NTSC_RGB_OUT_8888(2, line_out[2]);
+  ATARI_NTSC_RGB_OUT_8888(3, line_out[3]);
+
+  ATARI_NTSC_COLOR_IN(1, NTSC_black);
+  ATARI_NTSC_RGB_OUT_8888(4, line_out[4]);
+  ATARI_NTSC_RGB_OUT_8888(5, line_out[5]);
+  ATARI_NTSC_RGB_OUT_8888(6, line_out[6]);
+
+  line_in += 2;
+  line_out += 7;
+
+  ATARI_NTSC_COLOR_IN(0, NTSC_black);
+  ATARI_NTSC_RGB_OUT_8888(0, line_out[0]);
+  ATARI_NTSC_RGB_OUT_8888(1, line_out[1]);
+  ATARI_NTSC_RGB_OUT_8888(2, line_out[2]);
+  ATARI_NTSC_RGB_OUT_8888(3, line_out[3]);
+
+  ATARI_NTSC_COLOR_IN(1, NTSC_black);
+  ATARI_NTSC_RGB_OUT_8888(4, line_out[4]);
+#if 0
+  ATARI_NTSC_RGB_OUT_8888(5, line_out[5]);
+  ATARI_NTSC_RGB_OUT_8888(6, line_out[6]);
+#endif
+}
+
+#ifdef ATARI_NTSC_X86
+/*
+  The vector kernels treat a row as a sequence of chunks of two input
+  pixels, padded with black at the end just like the scalar code. For each
+  chunk, the seven outputs are sums of four kernel entries each:
+
+    out[0..3] = k0[0..3] + x0[ 7..10] + k1[17..20] + x1[24..27]
+    out[4..6] = k0[4..6] + x0[11..13] + kn[14..16] + k1[21..23]
+
+  where k0 / kn are the kernels of the current even / odd pixel, x0 / k1
+  those of the previous even / odd pixel and x1 the odd pixel before that.
+  The eighth lane is junk; it lands on the first output of the next chunk,
+  which is overwritten afterwards. The last chunk only writes five outputs.
+*/
+namespace {
+  #define ATARI_NTSC_LOAD(p) _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))
+
+  // Vector version of ATARI_NTSC_CLAMP_ (shift 0) and the 8888 packing
+  ATARI_NTSC_TARGET("sse2")
+  inline __m128i clampAndPackSSE2(__m128i raw, uInt32 clampMask, uInt32 clampAdd)
+  {
+    const __m128i sub = _mm_and_si128(_mm_srli_epi32(raw, 9), _mm_set1_epi32(clampMask));
+    __m128i clamp = _mm_sub_epi32(_mm_set1_epi32(clampAdd), sub);
+    raw = _mm_or_si128(raw, clamp);
+    clamp = _mm_sub_epi32(clamp, sub);
+    raw = _mm_and_si128(raw, clamp);
+
+    return _mm_or_si128(
+      _mm_or_si128(_mm_and_si128(_mm_srli_epi32(raw, 5), _mm_set1_epi32(0x00FF0000)),
+                   _mm_and_si128(_mm_srli_epi32(raw, 3), _mm_set1_epi32(0x0000FF00))),
+      _mm_and_si128(_mm_srli_epi32(raw, 1), _mm_set1_epi32(0x000000FF)));
+  }
+
+  ATARI_NTSC_TARGET("avx2")
+  inline __m256i clampAndPackAVX2(__m256i raw, uInt32 clampMask, uInt32 clampAdd)
+  {
+    const __m256i sub = _mm256_and_si256(_mm256_srli_epi32(raw, 9), _mm256_set1_epi32(clampMask));
+    __m256i clamp = _mm256_sub_epi32(_mm256_set1_epi32(clampAdd), sub);
+    raw = _mm256_or_si256(raw, clamp);
+    clamp = _mm256_sub_epi32(clamp, sub);
+    raw = _mm256_and_si256(raw, clamp);
+
+    return _mm256_or_si256(
+      _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(raw, 5), _mm256_set1_epi32(0x00FF0000)),
+                      _mm256_and_si256(_mm256_srli_epi32(raw, 3), _mm256_set1_epi32(0x0000FF00))),
+      _mm256_and_si256(_mm256_srli_epi32(raw, 1), _mm256_set1_epi32(0x000000FF)));
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ATARI_NTSC_TARGET("sse2")
+void AtariNTSC::renderRowSSE2(const uInt8* line_in, uInt32* restrict line_out,
+                              const uInt32 chunk_count) const
+{
+  const uInt32 *k0 = myColorTable[NTSC_black], *k1 = myColorTable[line_in[0]],
+               *x1 = myColorTable[NTSC_black];
+  ++line_in;
+
+  for(uInt32 chunk = 0; chunk < chunk_count + 2; ++chunk, line_out += 7)
+  {
+    const uInt32* x0 = k0;
+    k0 = myColorTable[chunk <= chunk_count ? line_in[2 * chunk] : uInt8(NTSC_black)];
+    const uInt32* kn = myColorTable[chunk < chunk_count ? line_in[2 * chunk + 1] : uInt8(NTSC_black)];
+
+    const __m128i lo = clampAndPackSSE2(_mm_add_epi32(
+      _mm_add_epi32(ATARI_NTSC_LOAD(k0), ATARI_NTSC_LOAD(x0 + 7)),
+      _mm_add_epi32(ATARI_NTSC_LOAD(k1 + 17), ATARI_NTSC_LOAD(x1 + 24))),
+      atari_ntsc_clamp_mask, atari_ntsc_clamp_add);
+    const __m128i hi = clampAndPackSSE2(_mm_add_epi32(
+      _mm_add_epi32(ATARI_NTSC_LOAD(k0 + 4), ATARI_NTSC_LOAD(x0 + 11)),
+      _mm_add_epi32(ATARI_NTSC_LOAD(kn + 14), ATARI_NTSC_LOAD(k1 + 21))),
+      atari_ntsc_clamp_mask, atari_ntsc_clamp_add);
+
+    x1 = k1;
+    k1 = kn;
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(line_out), lo);
+    if(chunk <= chunk_count)
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(line_out + 4), hi);
+    else
+      line_out[4] = _mm_cvtsi128_si32(hi);
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ATARI_NTSC_TARGET("avx2")
+void AtariNTSC::renderRowAVX2(const uInt8* line_in, uInt32* restrict line_out,
+                              const uInt32 chunk_count) const
+{
+  #define ATARI_NTSC_LOAD2(lo, hi) _mm256_inserti128_si256( \
+    _mm256_castsi128_si256(ATARI_NTSC_LOAD(lo)), ATARI_NTSC_LOAD(hi), 1)
+
+  const uInt32 *k0 = myColorTable[NTSC_black], *k1 = myColorTable[line_in[0]],
+               *x1 = myColorTable[NTSC_black];
+  ++line_in;
+
+  for(uInt32 chunk = 0; chunk < chunk_count + 2; ++chunk, line_out += 7)
+  {
+    const uInt32* x0 = k0;
+    k0 = myColorTable[chunk <= chunk_count ? line_in[2 * chunk] : uInt8(NTSC_black)];
+    const uInt32* kn = myColorTable[chunk < chunk_count ? line_in[2 * chunk + 1] : uInt8(NTSC_black)];
+
+    const __m256i out = clampAndPackAVX2(_mm256_add_epi32(
+      _mm256_add_epi32(ATARI_NTSC_LOAD2(k0, k0 + 4), ATARI_NTSC_LOAD2(x0 + 7, x0 + 11)),
+      _mm256_add_epi32(ATARI_NTSC_LOAD2(k1 + 17, kn + 14), ATARI_NTSC_LOAD2(x1 + 24, k1 + 21))),
+      atari_ntsc_clamp_mask, atari_ntsc_clamp_add);
+
+    x1 = k1;
+    k1 = kn;
+
+    if(chunk <= chunk_count)
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(line_out), out);
+    else
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(line_out), _mm256_castsi256_si128(out));
+      line_out[4] = _mm_cvtsi128_si32(_mm256_extracti128_si256(out, 1));
+    }
+  }
+
+  #undef ATARI_NTSC_LOAD2
+}
+
+#endif // ATARI_NTSC_X86
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+AtariNTSC::RowRenderer AtariNTSC::selectRowRenderer()
+{
+#ifdef ATARI_NTSC_X86
+  bool sse2 = false, avx2 = false;
+
+  #if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  const int maxLeaf = info[0];
+
+  __cpuid(info, 1);
+  sse2 = info[3] & (1 << 26);
+  // AVX state must be enabled by the OS as well
+  if(maxLeaf >= 7 && (info[2] & (1 << 27)) && (info[2] & (1 << 28)) &&
+     (_xgetbv(0) & 0x06) == 0x06)
+  {
+    __cpuidex(info, 7, 0);
+    avx2 = info[1] & (1 << 5);
+  }
+  #else
+  __builtin_cpu_init();
+  sse2 = __builtin_cpu_supports("sse2");
+  avx2 = __builtin_cpu_supports("avx2");
+  #endif
+
+  if(avx2)  return &AtariNTSC::renderRowAVX2;
+  if(sse2)  return &AtariNTSC::renderRowSSE2;
+#endif
+
+  return &AtariNTSC::renderRow;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 inline uInt32 AtariNTSC::getRGBPhosphor(const uInt32 c, const uInt32 p) const
 {
@@ -40,11 +40,18 @@
 #ifndef ATARI_NTSC_HXX
 #define ATARI_NTSC_HXX
 
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
 #include "bspf.hxx"
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #define ATARI_NTSC_X86
+#endif
+
 class AtariNTSC
 {
   public:
@@ -54,7 +61,14 @@ class AtariNTSC
     };
 
     // By default, threading is turned off
-    AtariNTSC() { enableThreading(false); }
+    AtariNTSC()
+      : myWorkerThreads(0),
+        myTotalThreads(1),
+        myGeneration(0),
+        myBusyWorkers(0),
+        myShutdown(false),
+        myRenderRow(selectRowRenderer()) { enableThreading(false); }
+    ~AtariNTSC();
 
     // Image parameters, ranging from -1.0 to 1.0. Actual internal values shown
     // in parenthesis and should remain fairly stable in future versions.
@@ -85,8 +99,10 @@ class AtariNTSC
     void initialize(const Setup& setup, const uInt8* palette);
     void initializePalette(const uInt8* palette);
 
-    // Set up threading
-    void enableThreading(bool enable);
+    // Set up threading; the worker threads are kept alive until threading
+    // is reconfigured. A thread count of 0 uses all available cores, up
+    // to four.
+    void enableThreading(bool enable, uInt32 threads = 0);
 
     // Set phosphor palette, for use in Blargg + phosphor mode
     void setPhosphorPalette(uInt8 palette[256][256]) {
@@ -117,9 +133,30 @@ class AtariNTSC
   private:
     // Threaded rendering
     void renderThread(const uInt8* atari_in, const uInt32 in_width,
-      const uInt32 in_height, const uInt32 numThreads, const uInt32 threadNum, void* rgb_out, const uInt32 out_pitch);
+      const uInt32 yStart, const uInt32 yEnd, void* rgb_out, const uInt32 out_pitch);
     void renderWithPhosphorThread(const uInt8* atari_in, const uInt32 in_width,
-      const uInt32 in_height, const uInt32 numThreads, const uInt32 threadNum, uInt32* rgb_in, void* rgb_out, const uInt32 out_pitch);
+      const uInt32 yStart, const uInt32 yEnd, uInt32* rgb_in, void* rgb_out, const uInt32 out_pitch);
+
+    // Render a single row; the scalar version is the reference, the vector
+    // versions produce identical output
+    void renderRow(const uInt8* line_in, uInt32* line_out, const uInt32 chunk_count) const;
+  #ifdef ATARI_NTSC_X86
+    void renderRowSSE2(const uInt8* line_in, uInt32* line_out, const uInt32 chunk_count) const;
+    void renderRowAVX2(const uInt8* line_in, uInt32* line_out, const uInt32 chunk_count) const;
+  #endif
+
+    // Pick the fastest row renderer supported by the CPU
+    using RowRenderer = void (AtariNTSC::*)(const uInt8*, uInt32*, const uInt32) const;
+    static RowRenderer selectRowRenderer();
+
+    // Render bands of rows from the current job until none are left
+    void renderBands();
+
+    // Main loop of the worker threads; waits for a job, renders bands
+    void runWorker();
+
+    // Terminate and join the worker threads
+    void stopWorkers();
 
     /**
       Used to calculate an averaged color for the 'phosphor' effect.
@@ -175,6 +212,29 @@ class AtariNTSC
     // Number of rendering and total threads
     uInt32 myWorkerThreads, myTotalThreads;
 
+    // The frame currently being rendered; rows are handed out in bands
+    struct Job
+    {
+      const uInt8* atari_in;
+      uInt32 in_width, in_height;
+      void* rgb_out;
+      uInt32 out_pitch;
+      uInt32* rgb_in;
+      uInt32 bandHeight;
+    };
+    Job myJob;
+    std::atomic<uInt32> myNextBand;
+
+    // Signalling between render() and the workers; a new job is announced
+    // by incrementing the generation
+    std::mutex myMutex;
+    std::condition_variable myJobAvailable, myJobDone;
+    uInt32 myGeneration, myBusyWorkers;
+    bool myShutdown;
+
+    // The row renderer selected for this CPU
+    RowRenderer myRenderRow;
+
     struct init_t
     {
       float to_rgb [burst_count * 6];
@@ -292,6 +352,13 @@ class AtariNTSC
       out [1] = (unsigned char) (clamped >> 11);\
       out [2] = (unsigned char) (clamped >>  1);\
     }
+
+  private:
+    // Following constructors and assignment operators not supported
+    AtariNTSC(const AtariNTSC&) = delete;
+    AtariNTSC(AtariNTSC&&) = delete;
+    AtariNTSC& operator=(const AtariNTSC&) = delete;
+    AtariNTSC& operator=(AtariNTSC&&) = delete;
 };
 
 #endif
@@ -26,6 +26,7 @@ constexpr uInt32 scaleTo100(double x)   { return uInt32(50*(x+1.0)); }
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 NTSCFilter::NTSCFilter()
   : mySetup(AtariNTSC::TV_Composite),
+    myCustomSetup(AtariNTSC::TV_Composite),
     myPreset(PRESET_OFF),
     myCurrentAdjustable(0)
 {
@@ -114,9 +115,10 @@ string NTSCFilter::increaseAdjustable()
   if(myPreset != PRESET_CUSTOM)
     return "'Custom' TV mode not selected";
 
-  uInt32 newval = scaleTo100(*ourCustomAdjustables[myCurrentAdjustable].value);
+  double& value = myCustomSetup.*ourCustomAdjustables[myCurrentAdjustable].value;
+  uInt32 newval = scaleTo100(value);
   newval += 2;  if(newval > 100) newval = 100;
-  *ourCustomAdjustables[myCurrentAdjustable].value = scaleFrom100(newval);
+  value = scaleFrom100(newval);
 
   ostringstream buf;
   buf << "Custom '" << ourCustomAdjustables[myCurrentAdjustable].type
@@ -132,10 +134,11 @@ string NTSCFilter::decreaseAdjustable()
   if(myPreset != PRESET_CUSTOM)
     return "'Custom' TV mode not selected";
 
-  uInt32 newval = scaleTo100(*ourCustomAdjustables[myCurrentAdjustable].value);
+  double& value = myCustomSetup.*ourCustomAdjustables[myCurrentAdjustable].value;
+  uInt32 newval = scaleTo100(value);
   if(newval < 2) newval = 0;
   else           newval -= 2;
-  *ourCustomAdjustables[myCurrentAdjustable].value = scaleFrom100(newval);
+  value = scaleFrom100(newval);
 
   ostringstream buf;
   buf << "Custom '" << ourCustomAdjustables[myCurrentAdjustable].type
@@ -228,19 +231,16 @@ void NTSCFilter::convertToAdjustable(Adjustable& adjustable,
   adjustable.bleed       = scaleTo100(setup.bleed);
 }
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-AtariNTSC::Setup NTSCFilter::myCustomSetup = AtariNTSC::TV_Composite;
-
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 const NTSCFilter::AdjustableTag NTSCFilter::ourCustomAdjustables[10] = {
-  { "contrast", &myCustomSetup.contrast },
-  { "brightness", &myCustomSetup.brightness },
-  { "hue", &myCustomSetup.hue },
-  { "saturation", &myCustomSetup.saturation },
-  { "gamma", &myCustomSetup.gamma },
-  { "sharpness", &myCustomSetup.sharpness },
-  { "resolution", &myCustomSetup.resolution },
-  { "artifacts", &myCustomSetup.artifacts },
-  { "fringing", &myCustomSetup.fringing },
-  { "bleeding", &myCustomSetup.bleed }
+  { "contrast", &AtariNTSC::Setup::contrast },
+  { "brightness", &AtariNTSC::Setup::brightness },
+  { "hue", &AtariNTSC::Setup::hue },
+  { "saturation", &AtariNTSC::Setup::saturation },
+  { "gamma", &AtariNTSC::Setup::gamma },
+  { "sharpness", &AtariNTSC::Setup::sharpness },
+  { "resolution", &AtariNTSC::Setup::resolution },
+  { "artifacts", &AtariNTSC::Setup::artifacts },
+  { "fringing", &AtariNTSC::Setup::fringing },
+  { "bleeding", &AtariNTSC::Setup::bleed }
 };
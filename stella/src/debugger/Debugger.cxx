@@ -29,6 +29,7 @@
 #include "DebuggerParser.hxx"
 #include "StateManager.hxx"
 #include "RewindManager.hxx"
+#include "EmulationWorker.hxx"
 
 #include "Console.hxx"
 #include "System.hxx"
@@ -122,6 +123,10 @@ FBInitStatus Debugger::initializeVideo()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool Debugger::start(const string& message, int address, bool read)
 {
+  // The GUI can only be entered from the main thread
+  if(myOSystem.emulationWorker().onThread())
+    return myOSystem.emulationWorker().requestDebugger(message, address, read);
+
   if(myOSystem.eventHandler().enterDebugMode())
   {
     // This must be done *after* we enter debug mode,
@@ -139,6 +144,9 @@ bool Debugger::start(const string& message, int address, bool read)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool Debugger::startWithFatalError(const string& message)
 {
+  if(myOSystem.emulationWorker().onThread())
+    return myOSystem.emulationWorker().requestDebugger(message, -1, true, true);
+
   if(myOSystem.eventHandler().enterDebugMode())
   {
     // This must be done *after* we enter debug mode,
@@ -18,8 +18,6 @@
 #ifndef DEBUGGER_EXPRESSIONS_HXX
 #define DEBUGGER_EXPRESSIONS_HXX
 
-#include <functional>
-
 #include "bspf.hxx"
 #include "CartDebug.hxx"
 #include "CpuDebug.hxx"
@@ -39,6 +37,8 @@ class BinAndExpression : public Expression
     BinAndExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() & myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::And, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -48,6 +48,8 @@ class BinNotExpression : public Expression
     BinNotExpression(Expression* left) : Expression(left) { }
     Int32 evaluate() const override
       { return ~(myLHS->evaluate()); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitUnary(ExpressionProgram::Op::Not, *myLHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -57,6 +59,8 @@ class BinOrExpression : public Expression
     BinOrExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() | myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Or, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -66,6 +70,8 @@ class BinXorExpression : public Expression
     BinXorExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() ^ myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Xor, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -75,6 +81,8 @@ class ByteDerefExpression : public Expression
     ByteDerefExpression(Expression* left): Expression(left) { }
     Int32 evaluate() const override
       { return Debugger::debugger().peek(myLHS->evaluate()); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitUnary(ExpressionProgram::Op::Peek, *myLHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -84,6 +92,8 @@ class ByteDerefOffsetExpression : public Expression
     ByteDerefOffsetExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return Debugger::debugger().peek(myLHS->evaluate() + myRHS->evaluate()); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::PeekOffset, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -93,6 +103,8 @@ class ConstExpression : public Expression
     ConstExpression(const int value) : Expression(), myValue(value) { }
     Int32 evaluate() const override
       { return myValue; }
+    void compile(ExpressionProgram& p) const override
+      { p.emitConst(myValue); }
 
   private:
     int myValue;
@@ -102,12 +114,14 @@ class ConstExpression : public Expression
 class CpuMethodExpression : public Expression
 {
   public:
-    CpuMethodExpression(CpuMethod method) : Expression(), myMethod(std::mem_fn(method)) { }
+    CpuMethodExpression(CpuMethod method) : Expression(), myMethod(method) { }
     Int32 evaluate() const override
-      { return myMethod(Debugger::debugger().cpuDebug()); }
+      { return (Debugger::debugger().cpuDebug().*myMethod)(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitMethod(myMethod); }
 
   private:
-    std::function<int(const CpuDebug&)> myMethod;
+    CpuMethod myMethod;
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -118,6 +132,8 @@ class DivExpression : public Expression
     Int32 evaluate() const override
       { int denom = myRHS->evaluate();
         return denom == 0 ? 0 : myLHS->evaluate() / denom; }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Div, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -127,6 +143,8 @@ class EqualsExpression : public Expression
     EqualsExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() == myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Eq, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -160,6 +178,8 @@ class GreaterEqualsExpression : public Expression
     GreaterEqualsExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() >= myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Ge, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -169,6 +189,8 @@ class GreaterExpression : public Expression
     GreaterExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() > myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Gt, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -178,6 +200,8 @@ class HiByteExpression : public Expression
     HiByteExpression(Expression* left) : Expression(left) { }
     Int32 evaluate() const override
       { return 0xff & (myLHS->evaluate() >> 8); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitUnary(ExpressionProgram::Op::HiByte, *myLHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -187,6 +211,8 @@ class LessEqualsExpression : public Expression
     LessEqualsExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() <= myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Le, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -196,6 +222,8 @@ class LessExpression : public Expression
     LessExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() < myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Lt, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -205,6 +233,8 @@ class LoByteExpression : public Expression
     LoByteExpression(Expression* left) : Expression(left) { }
     Int32 evaluate() const override
       { return 0xff & myLHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitUnary(ExpressionProgram::Op::LoByte, *myLHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -214,6 +244,8 @@ class LogAndExpression : public Expression
     LogAndExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() && myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitLogical(ExpressionProgram::Op::AndJump, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -223,6 +255,8 @@ class LogNotExpression : public Expression
     LogNotExpression(Expression* left) : Expression(left) { }
     Int32 evaluate() const override
       { return !(myLHS->evaluate()); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitUnary(ExpressionProgram::Op::LogNot, *myLHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -232,6 +266,8 @@ class LogOrExpression : public Expression
     LogOrExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() || myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitLogical(ExpressionProgram::Op::OrJump, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -241,6 +277,8 @@ class MinusExpression : public Expression
     MinusExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() - myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Sub, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -251,6 +289,8 @@ class ModExpression : public Expression
     Int32 evaluate() const override
       { int rhs = myRHS->evaluate();
         return rhs == 0 ? 0 : myLHS->evaluate() % rhs; }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Mod, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -260,6 +300,8 @@ class MultExpression : public Expression
     MultExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() * myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Mul, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -269,6 +311,8 @@ class NotEqualsExpression : public Expression
     NotEqualsExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() != myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Ne, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -278,18 +322,22 @@ class PlusExpression : public Expression
     PlusExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() + myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Add, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 class CartMethodExpression : public Expression
 {
   public:
-    CartMethodExpression(CartMethod method) : Expression(), myMethod(std::mem_fn(method)) { }
+    CartMethodExpression(CartMethod method) : Expression(), myMethod(method) { }
     Int32 evaluate() const override
-      { return myMethod(Debugger::debugger().cartDebug()); }
+      { return (Debugger::debugger().cartDebug().*myMethod)(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitMethod(myMethod); }
 
   private:
-    std::function<int(CartDebug&)> myMethod;
+    CartMethod myMethod;
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -299,6 +347,8 @@ class ShiftLeftExpression : public Expression
     ShiftLeftExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() << myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Shl, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -308,18 +358,22 @@ class ShiftRightExpression : public Expression
     ShiftRightExpression(Expression* left, Expression* right) : Expression(left, right) { }
     Int32 evaluate() const override
       { return myLHS->evaluate() >> myRHS->evaluate(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitBinary(ExpressionProgram::Op::Shr, *myLHS, *myRHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 class TiaMethodExpression : public Expression
 {
   public:
-    TiaMethodExpression(TiaMethod method) : Expression(), myMethod(std::mem_fn(method)) { }
+    TiaMethodExpression(TiaMethod method) : Expression(), myMethod(method) { }
     Int32 evaluate() const override
-      { return myMethod(Debugger::debugger().tiaDebug()); }
+      { return (Debugger::debugger().tiaDebug().*myMethod)(); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitMethod(myMethod); }
 
   private:
-    std::function<int(const TIADebug&)> myMethod;
+    TiaMethod myMethod;
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -329,6 +383,8 @@ class UnaryMinusExpression : public Expression
     UnaryMinusExpression(Expression* left) : Expression(left) { }
     Int32 evaluate() const override
       { return -(myLHS->evaluate()); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitUnary(ExpressionProgram::Op::Neg, *myLHS); }
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -338,6 +394,8 @@ class WordDerefExpression : public Expression
     WordDerefExpression(Expression* left) : Expression(left) { }
     Int32 evaluate() const override
       { return Debugger::debugger().dpeekAsInt(myLHS->evaluate()); }
+    void compile(ExpressionProgram& p) const override
+      { p.emitUnary(ExpressionProgram::Op::DPeek, *myLHS); }
 };
 
 #endif
@@ -19,6 +19,7 @@
 #define EXPRESSION_HXX
 
 #include "bspf.hxx"
+#include "ExpressionProgram.hxx"
 
 /**
   This class provides an implementation of an expression node, which
@@ -26,6 +27,9 @@
   returns the result.  When placed in a tree, a collection of such nodes
   can represent complex expression statements.
 
+  Trees which are evaluated often (ie, conditions checked on every
+  instruction) should be compiled into an ExpressionProgram instead.
+
   @author  Stephen Anthony
 */
 class Expression
@@ -37,6 +41,13 @@ class Expression
 
     virtual Int32 evaluate() const { return 0; }
 
+    /**
+      Emit the code for this node (and its children) into the program.
+      By default, the program calls back into evaluate().
+    */
+    virtual void compile(ExpressionProgram& program) const
+      { program.emitCall(*this); }
+
   protected:
     unique_ptr<Expression> myLHS, myRHS;
 
@@ -0,0 +1,314 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "Debugger.hxx"
+#include "Expression.hxx"
+#include "ExpressionProgram.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ExpressionProgram::ExpressionProgram(const Expression& expr)
+{
+  expr.compile(*this);
+
+  // Work out how deep the operand stack can get; jumps only ever skip
+  // forward over code that leaves exactly one value, so a linear scan
+  // gives an upper bound
+  uInt32 depth = 0, maxDepth = 1;
+  for(const auto& i: myCode)
+  {
+    switch(i.op)
+    {
+      case Op::Const: case Op::Call: case Op::CpuMethod:
+      case Op::TiaMethod: case Op::CartMethod: case Op::PeekAddr:
+        ++depth;
+        break;
+      case Op::Peek: case Op::DPeek: case Op::Not: case Op::LogNot:
+      case Op::Neg: case Op::HiByte: case Op::LoByte: case Op::ToBool:
+        break;
+      default:  // binary operators and conditional jumps consume a value
+        if(i.op < Op::AddImm || i.op > Op::GeImm)
+          --depth;
+        break;
+    }
+    maxDepth = std::max(maxDepth, depth);
+  }
+  myStack.resize(maxDepth);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool ExpressionProgram::operator==(const ExpressionProgram& other) const
+{
+  return myCode == other.myCode;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool ExpressionProgram::Instr::operator==(const Instr& other) const
+{
+  if(op != other.op || value != other.value)
+    return false;
+
+  switch(op)
+  {
+    case Op::Call:        return node == other.node;
+    case Op::CpuMethod:   return cpu == other.cpu;
+    case Op::TiaMethod:   return tia == other.tia;
+    case Op::CartMethod:  return cart == other.cart;
+    default:              return true;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ExpressionProgram::emitCall(const Expression& node)
+{
+  emit(Op::Call).node = &node;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ExpressionProgram::emitMethod(CpuMethod method)
+{
+  emit(Op::CpuMethod).cpu = method;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ExpressionProgram::emitMethod(TiaMethod method)
+{
+  emit(Op::TiaMethod).tia = method;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ExpressionProgram::emitMethod(CartMethod method)
+{
+  emit(Op::CartMethod).cart = method;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ExpressionProgram::emitUnary(Op op, const Expression& lhs)
+{
+  uInt32 start = uInt32(myCode.size());
+  lhs.compile(*this);
+
+  // A read from a constant address doesn't need the address on the stack
+  if(op == Op::Peek && myCode.size() == start + 1 && myCode[start].op == Op::Const)
+  {
+    myCode[start].op = Op::PeekAddr;
+    return;
+  }
+  emit(op);
+  fold(start);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ExpressionProgram::emitBinary(Op op, const Expression& lhs,
+                                   const Expression& rhs)
+{
+  uInt32 start = uInt32(myCode.size());
+  lhs.compile(*this);
+  uInt32 right = uInt32(myCode.size());
+  rhs.compile(*this);
+
+  // Most conditions compare against a constant, so take it as an immediate
+  if(op >= Op::Add && op <= Op::Ge &&
+     myCode.size() == right + 1 && myCode[right].op == Op::Const)
+  {
+    Int32 value = myCode[right].value;
+    myCode.pop_back();
+    emit(Op(uInt8(op) - uInt8(Op::Add) + uInt8(Op::AddImm)), value);
+  }
+  else
+    emit(op);
+
+  fold(start);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ExpressionProgram::emitLogical(Op op, const Expression& lhs,
+                                    const Expression& rhs)
+{
+  // 'lhs && rhs' becomes: lhs, AndJump end, rhs, ToBool, end:
+  // AndJump leaves 0 and jumps when lhs is false, otherwise it pops lhs
+  // and rhs decides the result (OrJump is the mirror image)
+  uInt32 start = uInt32(myCode.size());
+  lhs.compile(*this);
+
+  // A constant lhs either decides the result, or leaves it to rhs alone
+  if(myCode.size() == start + 1 && myCode[start].op == Op::Const)
+  {
+    bool value = myCode[start].value != 0;
+    myCode.pop_back();
+    if(value == (op == Op::OrJump))
+      emitConst(value);
+    else
+    {
+      rhs.compile(*this);
+      if(!lastIsBoolean())
+        emit(Op::ToBool);
+      fold(start);
+    }
+    return;
+  }
+
+  uInt32 jump = uInt32(myCode.size());
+  emit(op);
+  rhs.compile(*this);
+  if(!lastIsBoolean())
+    emit(Op::ToBool);
+  myCode[jump].value = Int32(myCode.size());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool ExpressionProgram::lastIsBoolean() const
+{
+  // A logical operator ends in its rhs, and leaves 0 or 1 when it jumps,
+  // so it is covered by looking at the rhs alone
+  switch(myCode.back().op)
+  {
+    case Op::Eq: case Op::Ne: case Op::Lt: case Op::Le: case Op::Gt: case Op::Ge:
+    case Op::EqImm: case Op::NeImm: case Op::LtImm: case Op::LeImm:
+    case Op::GtImm: case Op::GeImm: case Op::LogNot: case Op::ToBool:
+      return true;
+    case Op::Const:
+      return myCode.back().value == 0 || myCode.back().value == 1;
+    default:
+      return false;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ExpressionProgram::fold(uInt32 start)
+{
+  for(uInt32 i = start; i < myCode.size(); ++i)
+  {
+    switch(myCode[i].op)
+    {
+      case Op::Call: case Op::CpuMethod: case Op::TiaMethod:
+      case Op::CartMethod: case Op::Peek: case Op::PeekAddr:
+      case Op::PeekOffset: case Op::DPeek:
+        return;
+      default:
+        break;
+    }
+  }
+  myStack.resize(myCode.size() - start);
+  Int32 value = run(start, uInt32(myCode.size()));
+
+  myCode.resize(start);
+  emitConst(value);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Int32 ExpressionProgram::evaluate() const
+{
+  return run(0, uInt32(myCode.size()));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Int32 ExpressionProgram::run(uInt32 start, uInt32 end) const
+{
+  // 'sp' points at the top of stack; binary operators combine it with the
+  // value below and store the result there
+  Int32* sp = myStack.data() - 1;
+  const Instr* code = myCode.data();
+  Debugger& debugger = Debugger::debugger();
+
+  #define BINARY(op, expr) \
+    case Op::op:       { Int32 b = *sp--;  Int32 a = *sp;  *sp = (expr);  break; } \
+    case Op::op##Imm:  { Int32 b = i.value;  Int32 a = *sp;  *sp = (expr);  break; }
+
+  for(uInt32 pc = start; pc < end; ++pc)
+  {
+    const Instr& i = code[pc];
+    switch(i.op)
+    {
+      case Op::Const:     *++sp = i.value;                              break;
+      case Op::Call:        *++sp = i.node->evaluate();                 break;
+      case Op::CpuMethod:   *++sp = (debugger.cpuDebug().*i.cpu)();     break;
+      case Op::TiaMethod:   *++sp = (debugger.tiaDebug().*i.tia)();     break;
+      case Op::CartMethod:  *++sp = (debugger.cartDebug().*i.cart)();   break;
+      case Op::Peek:        *sp = debugger.peek(*sp);                   break;
+      case Op::PeekAddr:    *++sp = debugger.peek(i.value);             break;
+      case Op::PeekOffset:
+        { Int32 b = *sp--;  *sp = debugger.peek(*sp + b);               break; }
+      case Op::DPeek:       *sp = debugger.dpeekAsInt(*sp);             break;
+
+      BINARY(Add, a + b)
+      BINARY(Sub, a - b)
+      BINARY(Mul, a * b)
+      BINARY(Div, b == 0 ? 0 : a / b)
+      BINARY(Mod, b == 0 ? 0 : a % b)
+      BINARY(And, a & b)
+      BINARY(Or,  a | b)
+      BINARY(Xor, a ^ b)
+      BINARY(Shl, a << b)
+      BINARY(Shr, a >> b)
+      BINARY(Eq,  a == b)
+      BINARY(Ne,  a != b)
+      BINARY(Lt,  a < b)
+      BINARY(Le,  a <= b)
+      BINARY(Gt,  a > b)
+      BINARY(Ge,  a >= b)
+
+      case Op::Not:     *sp = ~*sp;               break;
+      case Op::LogNot:  *sp = !*sp;               break;
+      case Op::Neg:     *sp = -*sp;               break;
+      case Op::HiByte:  *sp = 0xff & (*sp >> 8);  break;
+      case Op::LoByte:  *sp = 0xff & *sp;         break;
+      case Op::ToBool:  *sp = *sp != 0;           break;
+
+      case Op::AndJump:
+        if(*sp == 0)  pc = i.value - 1;
+        else          --sp;
+        break;
+      case Op::OrJump:
+        if(*sp != 0)  { *sp = 1;  pc = i.value - 1; }
+        else          --sp;
+        break;
+    }
+  }
+  #undef BINARY
+
+  return *sp;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CompiledConditions::compile(const vector<unique_ptr<Expression>>& conditions)
+{
+  myIndices.clear();
+  myPrograms.clear();
+
+  for(uInt32 i = 0; i < conditions.size(); ++i)
+  {
+    ExpressionProgram program(*conditions[i]);
+
+    if(program.isConstant() && program.constant() == 0)
+      continue;
+    if(std::find(myPrograms.begin(), myPrograms.end(), program) != myPrograms.end())
+      continue;
+
+    myIndices.push_back(i);
+    myPrograms.push_back(std::move(program));
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Int32 CompiledConditions::firstHit() const
+{
+  for(uInt32 i = 0; i < myPrograms.size(); ++i)
+    if(myPrograms[i].evaluate())
+      return myIndices[i];
+
+  return -1;
+}
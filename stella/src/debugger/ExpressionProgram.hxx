@@ -0,0 +1,190 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef EXPRESSION_PROGRAM_HXX
+#define EXPRESSION_PROGRAM_HXX
+
+class Expression;
+class CartDebug;
+class CpuDebug;
+class TIADebug;
+
+#include "bspf.hxx"
+
+using CartMethod = int (CartDebug::*)();
+using CpuMethod = int (CpuDebug::*)() const;
+using TiaMethod = int (TIADebug::*)() const;
+
+/**
+  A flat, stack-based form of an expression tree.  The tree is walked
+  once when the program is created; each node emits one or more
+  instructions, and subtrees that only involve constants are folded into
+  a single constant.  Evaluating the program is then a single loop over
+  an instruction array, rather than a chain of virtual calls.
+
+  CPU, TIA and cart methods are called directly.  Nodes which cannot be
+  resolved at compile time (equates and user functions, which may be
+  redefined) are emitted as a call back into the original node, so the
+  tree must outlive the program.
+*/
+class ExpressionProgram
+{
+  public:
+    enum class Op : uInt8
+    {
+      Const, Call, CpuMethod, TiaMethod, CartMethod,
+      Peek, PeekAddr, PeekOffset, DPeek,
+      Add, Sub, Mul, Div, Mod, And, Or, Xor, Shl, Shr,
+      Eq, Ne, Lt, Le, Gt, Ge,
+      // The same binary operators, with a constant right operand
+      // taken from the instruction instead of the stack
+      AddImm, SubImm, MulImm, DivImm, ModImm, AndImm, OrImm, XorImm,
+      ShlImm, ShrImm, EqImm, NeImm, LtImm, LeImm, GtImm, GeImm,
+      Not, LogNot, Neg, HiByte, LoByte, ToBool,
+      AndJump, OrJump
+    };
+
+  public:
+    /**
+      Compile the given expression tree.
+    */
+    explicit ExpressionProgram(const Expression& expr);
+
+    /**
+      Evaluate the program; the result is identical to expr.evaluate().
+    */
+    Int32 evaluate() const;
+
+    /**
+      Answers whether the whole expression folded to a constant.
+    */
+    bool isConstant() const {
+      return myCode.size() == 1 && myCode[0].op == Op::Const;
+    }
+    Int32 constant() const { return myCode[0].value; }
+
+    /**
+      Two programs are equal when they contain the same instructions,
+      and calls refer to the same nodes.
+    */
+    bool operator==(const ExpressionProgram& other) const;
+
+    //////////////////////////////////////////////////////////////////////
+    // The following are used by Expression::compile() to emit code
+    //////////////////////////////////////////////////////////////////////
+    void emitConst(Int32 value) { emit(Op::Const, value); }
+    void emitCall(const Expression& node);
+    void emitMethod(CpuMethod method);
+    void emitMethod(TiaMethod method);
+    void emitMethod(CartMethod method);
+    void emitUnary(Op op, const Expression& lhs);
+    void emitBinary(Op op, const Expression& lhs, const Expression& rhs);
+    void emitLogical(Op op, const Expression& lhs, const Expression& rhs);
+
+  private:
+    struct Instr
+    {
+      Op op;
+      Int32 value;  // constant, address or jump target
+      union {       // target of the call instructions
+        const Expression* node;
+        CpuMethod cpu;
+        TiaMethod tia;
+        CartMethod cart;
+      };
+
+      bool operator==(const Instr& other) const;
+    };
+
+    /**
+      Answers whether the value left by the last instruction can only be
+      0 or 1, so that a following ToBool is redundant.
+    */
+    bool lastIsBoolean() const;
+
+    Instr& emit(Op op, Int32 value = 0) {
+      myCode.emplace_back();
+      Instr& i = myCode.back();
+      i.op = op;  i.value = value;  i.node = nullptr;
+      return i;
+    }
+
+    /**
+      Replace the instructions starting at 'start' with a single constant,
+      if none of them depend on the state of the emulation.
+    */
+    void fold(uInt32 start);
+
+    /**
+      Run the instructions in [start, end) and return the top of stack.
+    */
+    Int32 run(uInt32 start, uInt32 end) const;
+
+  private:
+    vector<Instr> myCode;
+
+    // Operand stack, sized for the deepest point of the program
+    mutable vector<Int32> myStack;
+
+  private:
+    // Following constructors and assignment operators not supported
+    ExpressionProgram() = delete;
+    ExpressionProgram(const ExpressionProgram&) = delete;
+    ExpressionProgram& operator=(const ExpressionProgram&) = delete;
+
+  public:
+    // Programs are kept in vectors, so they must be movable
+    ExpressionProgram(ExpressionProgram&&) = default;
+    ExpressionProgram& operator=(ExpressionProgram&&) = default;
+};
+
+/**
+  The compiled form of a list of conditions (breakifs, trapifs or
+  savestateifs).  A condition that is identical to an earlier one in the
+  list can never be the first to trigger, and one that folded to zero can
+  never trigger at all, so neither is evaluated.
+*/
+class CompiledConditions
+{
+  public:
+    CompiledConditions() = default;
+
+    /**
+      Recompile from the given list of conditions; must be called
+      whenever the list changes.
+    */
+    void compile(const vector<unique_ptr<Expression>>& conditions);
+
+    /**
+      Answers the index (in the original list) of the first condition
+      that evaluates to true, or -1 if none do.
+    */
+    Int32 firstHit() const;
+
+  private:
+    vector<uInt32> myIndices;
+    vector<ExpressionProgram> myPrograms;
+
+  private:
+    // Following constructors and assignment operators not supported
+    CompiledConditions(const CompiledConditions&) = delete;
+    CompiledConditions(CompiledConditions&&) = delete;
+    CompiledConditions& operator=(const CompiledConditions&) = delete;
+    CompiledConditions& operator=(CompiledConditions&&) = delete;
+};
+
+#endif
@@ -25,24 +25,30 @@
 class PackedBitArray
 {
   public:
-    PackedBitArray() : myInitialized(false) { }
+    PackedBitArray() : mySetCount(0), myInitialized(false) { }
 
     bool isSet(uInt16 bit) const   { return myBits[bit];  }
     bool isClear(uInt16 bit) const { return !myBits[bit]; }
 
-    void set(uInt16 bit)    { myBits[bit] = true;  }
-    void clear(uInt16 bit)  { myBits[bit] = false; }
-    void toggle(uInt16 bit) { myBits.flip(bit);    }
+    void set(uInt16 bit)    { if(!myBits[bit]) { myBits[bit] = true;  ++mySetCount; } }
+    void clear(uInt16 bit)  { if(myBits[bit])  { myBits[bit] = false; --mySetCount; } }
+    void toggle(uInt16 bit) { myBits[bit] ? clear(bit) : set(bit); }
 
     void initialize() { myInitialized = true; }
-    void clearAll() { myInitialized = false; myBits.reset(); }
+    void clearAll() { myInitialized = false; myBits.reset(); mySetCount = 0; }
 
     bool isInitialized() const { return myInitialized; }
 
+    // Answers whether no bit is currently set
+    bool isEmpty() const { return mySetCount == 0; }
+
   private:
     // The actual bits
     std::bitset<0x10000> myBits;
 
+    // The number of bits currently set
+    uInt32 mySetCount;
+
     // Indicates whether we should treat this bitset as initialized
     bool myInitialized;
 
@@ -23,28 +23,41 @@
 class TrapArray
 {
 public:
-  TrapArray() : myInitialized(false) {}
+  TrapArray() : mySetCount(0), myInitialized(false) {}
 
   bool isSet(const uInt16 address) const { return myCount[address]; }
   bool isClear(const uInt16 address) const { return myCount[address] == 0; }
 
-  void add(const uInt16 address) { myCount[address]++; }
-  void remove(const uInt16 address) { myCount[address]--; }
+  void add(const uInt16 address) { if(myCount[address]++ == 0) ++mySetCount; }
+  void remove(const uInt16 address) {
+    if(myCount[address] && --myCount[address] == 0) --mySetCount;
+  }
   //void toggle(uInt16 address) { myCount[address] ? remove(address) : add(address); } // TODO condition
 
   void initialize() { 
     if(!myInitialized)
+    {
       memset(myCount, 0, sizeof(myCount));
+      mySetCount = 0;
+    }
     myInitialized = true; 
   }
-  void clearAll() { myInitialized = false; memset(myCount, 0, sizeof(myCount)); }
+  void clearAll() {
+    myInitialized = false; memset(myCount, 0, sizeof(myCount)); mySetCount = 0;
+  }
 
   bool isInitialized() const { return myInitialized; }
 
+  // Answers whether no address currently has a trap
+  bool isEmpty() const { return mySetCount == 0; }
+
 private:
   // The actual counts
   uInt8 myCount[0x10000];
 
+  // The number of addresses with a non-zero count
+  uInt32 mySetCount;
+
   // Indicates whether we should treat this array as initialized
   bool myInitialized;
 
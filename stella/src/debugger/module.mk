@@ -6,6 +6,7 @@ MODULE_OBJS := \
 	src/debugger/CartDebug.o \
 	src/debugger/CpuDebug.o \
 	src/debugger/DiStella.o \
+	src/debugger/ExpressionProgram.o \
 	src/debugger/RiotDebug.o \
 	src/debugger/TIADebug.o
 
@@ -30,6 +30,9 @@ Cartridge::Cartridge(const Settings& settings)
     myStartBank(0),
     myBankChanged(true),
     myCodeAccessBase(nullptr),
+    myBankPagesAddr(0),
+    myBankPagesCount(0),
+    myBankPagesBank(0xFFFF),
     myBankLocked(false)
 {
 }
@@ -88,6 +91,34 @@ void Cartridge::createCodeAccessBase(uInt32 size)
 #endif
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Cartridge::createBankPages(uInt8* image, uInt16 banks, uInt16 startAddr,
+                                uInt16 hotspotAddr)
+{
+  const uInt16 hotspotPage = hotspotAddr & ~System::PAGE_MASK;
+
+  myBankPagesAddr = startAddr;
+  myBankPagesCount = (0x2000 - startAddr) >> System::PAGE_SHIFT;
+  myBankPages.clear();
+  myBankPages.reserve(banks * myBankPagesCount);
+  myBankPagesBank = 0xFFFF;  // nothing installed yet
+
+  for(uInt16 bank = 0; bank < banks; ++bank)
+  {
+    const uInt32 offset = bank << 12;
+    System::PageAccess access(this, System::PA_READ);
+
+    for(uInt16 addr = startAddr; addr < 0x2000; addr += System::PAGE_SIZE)
+    {
+      const uInt32 pos = offset + (addr & 0x0FFF);
+      access.directPeekBase = addr < hotspotPage ? &image[pos] : nullptr;
+      access.codeAccessBase =
+          myCodeAccessBase ? &myCodeAccessBase[pos] : nullptr;
+      myBankPages.push_back(access);
+    }
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Cartridge::initializeRAM(uInt8* arr, uInt32 size, uInt8 val) const
 {
@@ -101,7 +132,7 @@ void Cartridge::initializeRAM(uInt8* arr, uInt32 size, uInt8 val) const
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool Cartridge::randomInitialRAM() const
 {
-  return mySettings.getBool(mySettings.getBool("dev.settings") ? "dev.ramrandom" : "plr.ramrandom");
+  return mySettings.getBool(mySettings.activeId(Settings::PlrRamRandom));
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -114,5 +145,5 @@ void Cartridge::randomizeStartBank()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool Cartridge::randomStartBank() const
 {
-  return mySettings.getBool(mySettings.getBool("dev.settings") ? "dev.bankrandom" : "plr.bankrandom");
+  return mySettings.getBool(mySettings.activeId(Settings::PlrBankRandom));
 }
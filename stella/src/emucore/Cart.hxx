@@ -27,6 +27,7 @@ class GuiObject;
 #include "bspf.hxx"
 #include "Device.hxx"
 #include "Settings.hxx"
+#include "System.hxx"
 #include "Font.hxx"
 
 /**
@@ -186,6 +187,40 @@ class Cartridge : public Device
     */
     void createCodeAccessBase(uInt32 size);
 
+    /**
+      Precompute the page accesses of every 4K bank of the given image, so
+      that switching banks only copies one bank's entries into the system.
+      Pages from 'startAddr' up to the page containing 'hotspotAddr' read
+      directly from the image; the remaining pages up to $2000 contain the
+      hotspots, and always go through peek().  Should be called from
+      install(), after the code-access array has been created.
+
+      @param image        The ROM image, consisting of 4K banks
+      @param banks        The number of banks in the image
+      @param startAddr    The first address mapped to the bank (0x1000
+                          unless there's RAM below the bank)
+      @param hotspotAddr  The address of the first hotspot, or 0x2000
+                          if there are no hotspots in the bank area
+    */
+    void createBankPages(uInt8* image, uInt16 banks, uInt16 startAddr = 0x1000,
+                         uInt16 hotspotAddr = 0x2000);
+
+    /**
+      Install the page accesses precomputed by createBankPages() for
+      the given bank.  Nothing is copied if the bank is already mapped,
+      since only the cartridge changes these pages.
+
+      @param bank  The bank to map into the system
+    */
+    void installBankPages(uInt16 bank) {
+      if(bank != myBankPagesBank)
+      {
+        mySystem->setPageAccess(myBankPagesAddr,
+            &myBankPages[bank * myBankPagesCount], myBankPagesCount);
+        myBankPagesBank = bank;
+      }
+    }
+
     /**
       Fill the given RAM array with (possibly random) data.
 
@@ -230,6 +265,14 @@ class Cartridge : public Device
     BytePtr myCodeAccessBase;
 
   private:
+    // The page accesses of every bank, for pages starting at
+    // myBankPagesAddr (myBankPagesCount entries per bank)
+    vector<System::PageAccess> myBankPages;
+    uInt16 myBankPagesAddr, myBankPagesCount;
+
+    // The bank whose page accesses are currently in the system
+    uInt16 myBankPagesBank;
+
     // If myBankLocked is true, ignore attempts at bankswitching. This is used
     // by the debugger, when disassembling/dumping ROM.
     bool myBankLocked;
@@ -60,6 +60,9 @@ void Cartridge0840::install(System& system)
   for(uInt16 addr = 0x0800; addr < 0x0FFF; addr += System::PAGE_SIZE)
     mySystem->setPageAccess(addr, access);
 
+  // Precompute the page accesses for all banks
+  createBankPages(myImage, bankCount());
+
   // Install pages for bank 0
   bank(myStartBank);
 }
@@ -133,16 +136,9 @@ bool Cartridge0840::bank(uInt16 bank)
   // Remember what bank we're in
   myBankOffset = bank << 12;
 
-  // Setup the page access methods for the current bank
-  System::PageAccess access(this, System::PA_READ);
+  // Install the precomputed page accesses for the bank
+  installBankPages(bank);
 
-  // Map ROM image into the system
-  for(uInt16 addr = 0x1000; addr < 0x2000; addr += System::PAGE_SIZE)
-  {
-    access.directPeekBase = &myImage[myBankOffset + (addr & 0x0FFF)];
-    access.codeAccessBase = &myCodeAccessBase[myBankOffset + (addr & 0x0FFF)];
-    mySystem->setPageAccess(addr, access);
-  }
   return myBankChanged = true;
 }
 
@@ -206,7 +202,7 @@ bool Cartridge0840::load(Serializer& in)
   }
 
   // Remember what bank we were in
-  bank(myBankOffset);
+  bank(myBankOffset >> 12);
 
   return true;
 }
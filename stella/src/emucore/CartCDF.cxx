@@ -429,6 +429,7 @@ bool CartridgeCDF::patch(uInt16 address, uInt8 value)
   if(address >= 0x0040)
   {
     myProgramImage[myBankOffset + (address & 0x0FFF)] = value;
+    myThumbEmulator->invalidateTranslations();
     return myBankChanged = true;
   }
   else
@@ -367,7 +367,7 @@ uInt8 CartridgeCTY::ramReadWrite()
         if(index < 7)
         {
           // Add 0.5 s delay for read
-          myRamAccessTimeout = myOSystem.getTicks() + 500000;
+          myRamAccessTimeout = mySystem->cycles() + 597000;
           loadTune(index);
         }
         break;
@@ -375,7 +375,7 @@ uInt8 CartridgeCTY::ramReadWrite()
         if(index < 4)
         {
           // Add 0.5 s delay for read
-          myRamAccessTimeout = myOSystem.getTicks() + 500000;
+          myRamAccessTimeout = mySystem->cycles() + 597000;
           loadScore(index);
         }
         break;
@@ -383,13 +383,13 @@ uInt8 CartridgeCTY::ramReadWrite()
         if(index < 4)
         {
           // Add 1 s delay for write
-          myRamAccessTimeout = myOSystem.getTicks() + 1000000;
+          myRamAccessTimeout = mySystem->cycles() + 1193000;
           saveScore(index);
         }
         break;
       case 4:  // Wipe all score tables
         // Add 1 s delay for write
-        myRamAccessTimeout = myOSystem.getTicks() + 1000000;
+        myRamAccessTimeout = mySystem->cycles() + 1193000;
         wipeAllScores();
         break;
     }
@@ -399,7 +399,7 @@ uInt8 CartridgeCTY::ramReadWrite()
   else
   {
     // Have we reached the timeout value yet?
-    if(myOSystem.getTicks() >= myRamAccessTimeout)
+    if(mySystem->cycles() >= myRamAccessTimeout)
     {
       myRamAccessTimeout = 0;  // Turn off timer
       myRAM[0] = 0;            // Successful operation
@@ -612,6 +612,7 @@ bool CartridgeDPCPlus::patch(uInt16 address, uInt8 value)
   if(address >= 0x0080)
   {
     myProgramImage[myBankOffset + (address & 0x0FFF)] = value;
+    myThumbEmulator->invalidateTranslations();
     return myBankChanged = true;
   }
   else
@@ -65,6 +65,132 @@
 
 #include "CartDetector.hxx"
 
+namespace {
+  // All byte signatures used for autodetection; every table listed in
+  // 'ourSignatureTables' is matched in a single pass over the ROM image
+
+  const uInt8 SigF8[1][3] = {
+    { 0x8D, 0xF9, 0x1F }   // STA $1FF9
+  };
+  // ARM code contains the following 'loader' patterns in the first 1K
+  // Thanks to Thomas Jentzsch of AtariAge for this advice
+  const uInt8 SigARM[2][4] = {
+    { 0xA0, 0xC1, 0x1F, 0xE0 },
+    { 0x00, 0x80, 0x02, 0xE0 }
+  };
+  const uInt8 Sig0840a[3][3] = {
+    { 0xAD, 0x00, 0x08 },  // LDA $0800
+    { 0xAD, 0x40, 0x08 },  // LDA $0840
+    { 0x2C, 0x00, 0x08 }   // BIT $0800
+  };
+  const uInt8 Sig0840b[2][4] = {
+    { 0x0C, 0x00, 0x08, 0x4C },  // NOP $0800; JMP ...
+    { 0x0C, 0xFF, 0x0F, 0x4C }   // NOP $0FFF; JMP ...
+  };
+  const uInt8 Sig3E[1][4] = {
+    { 0x85, 0x3E, 0xA9, 0x00 }   // STA $3E; LDA #$00
+  };
+  const uInt8 Sig3EPlus[1][4] = {
+    { 'T', 'J', '3', 'E' }
+  };
+  const uInt8 Sig3F[1][2] = {
+    { 0x85, 0x3F }   // STA $3F
+  };
+  // These signatures are attributed to the MESS project
+  const uInt8 SigCV[2][3] = {
+    { 0x9D, 0xFF, 0xF3 },  // STA $F3FF.X
+    { 0x99, 0x00, 0xF4 }   // STA $F400.Y
+  };
+  const uInt8 SigDASH[1][4] = {
+    { 'T', 'J', 'A', 'D' }
+  };
+  const uInt8 SigDPCplus[1][4] = {
+    { 'D', 'P', 'C', '+' }
+  };
+  // These signatures are attributed to the MESS project
+  const uInt8 SigE0[8][3] = {
+    { 0x8D, 0xE0, 0x1F },  // STA $1FE0
+    { 0x8D, 0xE0, 0x5F },  // STA $5FE0
+    { 0x8D, 0xE9, 0xFF },  // STA $FFE9
+    { 0x0C, 0xE0, 0x1F },  // NOP $1FE0
+    { 0xAD, 0xE0, 0x1F },  // LDA $1FE0
+    { 0xAD, 0xE9, 0xFF },  // LDA $FFE9
+    { 0xAD, 0xED, 0xFF },  // LDA $FFED
+    { 0xAD, 0xF3, 0xBF }   // LDA $BFF3
+  };
+  // These signatures are attributed to the MESS project
+  const uInt8 SigE7[7][3] = {
+    { 0xAD, 0xE2, 0xFF },  // LDA $FFE2
+    { 0xAD, 0xE5, 0xFF },  // LDA $FFE5
+    { 0xAD, 0xE5, 0x1F },  // LDA $1FE5
+    { 0xAD, 0xE7, 0x1F },  // LDA $1FE7
+    { 0x0C, 0xE7, 0x1F },  // NOP $1FE7
+    { 0x8D, 0xE7, 0xFF },  // STA $FFE7
+    { 0x8D, 0xE7, 0x1F }   // STA $1FE7
+  };
+  const uInt8 SigE78K[3][3] = {
+    { 0xAD, 0xE4, 0xFF },  // LDA $FFE4
+    { 0xAD, 0xE5, 0xFF },  // LDA $FFE5
+    { 0xAD, 0xE6, 0xFF }   // LDA $FFE6
+  };
+  const uInt8 SigEF[4][3] = {
+    { 0x0C, 0xE0, 0xFF },  // NOP $FFE0
+    { 0xAD, 0xE0, 0xFF },  // LDA $FFE0
+    { 0x0C, 0xE0, 0x1F },  // NOP $1FE0
+    { 0xAD, 0xE0, 0x1F }   // LDA $1FE0
+  };
+  const uInt8 SigBUS[1][3] = {
+    { 'B', 'U', 'S' }
+  };
+  const uInt8 SigCDF[1][3] = {
+    { 'C', 'D', 'F' }
+  };
+  // These signatures are attributed to the MESS project
+  const uInt8 SigFE[4][5] = {
+    { 0x20, 0x00, 0xD0, 0xC6, 0xC5 },  // JSR $D000; DEC $C5
+    { 0x20, 0xC3, 0xF8, 0xA5, 0x82 },  // JSR $F8C3; LDA $82
+    { 0xD0, 0xFB, 0x20, 0x73, 0xFE },  // BNE $FB; JSR $FE73
+    { 0x20, 0x00, 0xF0, 0x84, 0xD6 }   // JSR $F000; STY $D6
+  };
+  const uInt8 SigMDM[1][4] = {
+    { 'M', 'D', 'M', 'C' }
+  };
+  const uInt8 SigSB[2][3] = {
+    { 0xBD, 0x00, 0x08 },  // LDA $0800,x
+    { 0xAD, 0x00, 0x08 }   // LDA $0800
+  };
+  const uInt8 SigUA[3][3] = {
+    { 0x8D, 0x40, 0x02 },  // STA $240
+    { 0xAD, 0x40, 0x02 },  // LDA $240
+    { 0xBD, 0x1F, 0x02 }   // LDA $21F,X
+  };
+  const uInt8 SigX07[6][3] = {
+    { 0xAD, 0x0D, 0x08 },  // LDA $080D
+    { 0xAD, 0x1D, 0x08 },  // LDA $081D
+    { 0xAD, 0x2D, 0x08 },  // LDA $082D
+    { 0x0C, 0x0D, 0x08 },  // NOP $080D
+    { 0x0C, 0x1D, 0x08 },  // NOP $081D
+    { 0x0C, 0x2D, 0x08 }   // NOP $082D
+  };
+
+  struct SignatureTable {
+    const uInt8* bytes;
+    uInt32 size;   // size of each signature
+    uInt32 count;  // number of signatures in the table
+  };
+  #define SIG_TABLE(t) { &t[0][0], sizeof(t[0]), sizeof(t) / sizeof(t[0]) }
+  const SignatureTable ourSignatureTables[] = {
+    SIG_TABLE(SigF8),      SIG_TABLE(SigARM),  SIG_TABLE(Sig0840a),
+    SIG_TABLE(Sig0840b),   SIG_TABLE(Sig3E),   SIG_TABLE(Sig3EPlus),
+    SIG_TABLE(Sig3F),      SIG_TABLE(SigCV),   SIG_TABLE(SigDASH),
+    SIG_TABLE(SigDPCplus), SIG_TABLE(SigE0),   SIG_TABLE(SigE7),
+    SIG_TABLE(SigE78K),    SIG_TABLE(SigEF),   SIG_TABLE(SigBUS),
+    SIG_TABLE(SigCDF),     SIG_TABLE(SigFE),   SIG_TABLE(SigMDM),
+    SIG_TABLE(SigSB),      SIG_TABLE(SigUA),   SIG_TABLE(SigX07)
+  };
+  #undef SIG_TABLE
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 unique_ptr<Cartridge> CartDetector::create(const BytePtr& image, uInt32 size,
     string& md5, const string& propertiesType, const OSystem& osystem)
@@ -329,6 +455,24 @@ CartDetector::createFromImage(const BytePtr& image, uInt32 size, BSType type,
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 BSType CartDetector::autodetectType(const BytePtr& image, uInt32 size)
+{
+  // Collect all signature matches at once; the checks only query them
+  const Signatures sigs(image, size);
+
+  return autodetectType(image, size, sigs);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+BSType CartDetector::autodetectTypeReference(const BytePtr& image, uInt32 size)
+{
+  const Signatures sigs(image, size, false);
+
+  return autodetectType(image, size, sigs);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+BSType CartDetector::autodetectType(const BytePtr& image, uInt32 size,
+                                    const Signatures& sigs)
 {
   // Guess type based on size
   BSType type = BSType::_AUTO;
@@ -348,11 +492,11 @@ BSType CartDetector::autodetectType(const BytePtr& image, uInt32 size)
   else if((size == 2048) ||
           (size == 4096 && memcmp(image.get(), image.get() + 2048, 2048) == 0))
   {
-    type = isProbablyCV(image, size) ? BSType::_CV : BSType::_2K;
+    type = isProbablyCV(sigs) ? BSType::_CV : BSType::_2K;
   }
   else if(size == 4096)
   {
-    if(isProbablyCV(image, size))
+    if(isProbablyCV(sigs))
       type = BSType::_CV;
     else if(isProbably4KSC(image, size))
       type = BSType::_4KSC;
@@ -362,26 +506,25 @@ BSType CartDetector::autodetectType(const BytePtr& image, uInt32 size)
   else if(size == 8*1024)  // 8K
   {
     // First check for *potential* F8
-    uInt8 signature[] = { 0x8D, 0xF9, 0x1F };  // STA $1FF9
-    bool f8 = searchForBytes(image.get(), size, signature, 3, 2);
+    bool f8 = sigs.search(SigF8[0], 3, 2);  // STA $1FF9
 
     if(isProbablySC(image, size))
       type = BSType::_F8SC;
     else if(memcmp(image.get(), image.get() + 4096, 4096) == 0)
       type = BSType::_4K;
-    else if(isProbablyE0(image, size))
+    else if(isProbablyE0(sigs))
       type = BSType::_E0;
-    else if(isProbably3E(image, size))
+    else if(isProbably3E(sigs))
       type = BSType::_3E;
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(sigs))
       type = BSType::_3F;
-    else if(isProbablyUA(image, size))
+    else if(isProbablyUA(sigs))
       type = BSType::_UA;
-    else if(isProbablyFE(image, size) && !f8)
+    else if(isProbablyFE(sigs) && !f8)
       type = BSType::_FE;
-    else if(isProbably0840(image, size))
+    else if(isProbably0840(sigs))
       type = BSType::_0840;
-    else if(isProbablyE78K(image, size))
+    else if(isProbablyE78K(sigs))
       type = BSType::_E78K;
     else
       type = BSType::_F8;
@@ -402,12 +545,12 @@ BSType CartDetector::autodetectType(const BytePtr& image, uInt32 size)
   {
     if(isProbablySC(image, size))
       type = BSType::_F6SC;
-    else if(isProbablyE7(image, size))
+    else if(isProbablyE7(sigs))
       type = BSType::_E7;
-    else if(isProbably3E(image, size))
+    else if(isProbably3E(sigs))
       type = BSType::_3E;
   /* no known 16K 3F ROMS
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(sigs))
       type = BSType::_3F;
   */
     else
@@ -419,24 +562,24 @@ BSType CartDetector::autodetectType(const BytePtr& image, uInt32 size)
   }
   else if(size == 29*1024)  // 29K
   {
-    if(isProbablyARM(image, size))
+    if(isProbablyARM(sigs))
       type = BSType::_FA2;
-    else /*if(isProbablyDPCplus(image, size))*/
+    else /*if(isProbablyDPCplus(sigs))*/
       type = BSType::_DPCP;
   }
   else if(size == 32*1024)  // 32K
   {
     if(isProbablySC(image, size))
       type = BSType::_F4SC;
-    else if(isProbably3E(image, size))
+    else if(isProbably3E(sigs))
       type = BSType::_3E;
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(sigs))
       type = BSType::_3F;
-    else if (isProbablyBUS(image, size))
+    else if (isProbablyBUS(sigs))
       type = BSType::_BUS;
-    else if (isProbablyCDF(image, size))
+    else if (isProbablyCDF(sigs))
       type = BSType::_CDF;
-    else if(isProbablyDPCplus(image, size))
+    else if(isProbablyDPCplus(sigs))
       type = BSType::_DPCP;
     else if(isProbablyCTY(image, size))
       type = BSType::_CTY;
@@ -447,59 +590,59 @@ BSType CartDetector::autodetectType(const BytePtr& image, uInt32 size)
   }
   else if(size == 64*1024)  // 64K
   {
-    if(isProbably3E(image, size))
+    if(isProbably3E(sigs))
       type = BSType::_3E;
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(sigs))
       type = BSType::_3F;
     else if(isProbably4A50(image, size))
       type = BSType::_4A50;
-    else if(isProbablyEF(image, size, type))
+    else if(isProbablyEF(image, size, sigs, type))
       ; // type has been set directly in the function
-    else if(isProbablyX07(image, size))
+    else if(isProbablyX07(sigs))
       type = BSType::_X07;
     else
       type = BSType::_F0;
   }
   else if(size == 128*1024)  // 128K
   {
-    if(isProbably3E(image, size))
+    if(isProbably3E(sigs))
       type = BSType::_3E;
     else if(isProbablyDF(image, size, type))
       ; // type has been set directly in the function
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(sigs))
       type = BSType::_3F;
     else if(isProbably4A50(image, size))
       type = BSType::_4A50;
-    else if(isProbablySB(image, size))
+    else if(isProbablySB(sigs))
       type = BSType::_SB;
   }
   else if(size == 256*1024)  // 256K
   {
-    if(isProbably3E(image, size))
+    if(isProbably3E(sigs))
       type = BSType::_3E;
     else if(isProbablyBF(image, size, type))
       ; // type has been set directly in the function
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(sigs))
       type = BSType::_3F;
-    else /*if(isProbablySB(image, size))*/
+    else /*if(isProbablySB(sigs))*/
       type = BSType::_SB;
   }
   else  // what else can we do?
   {
-    if(isProbably3E(image, size))
+    if(isProbably3E(sigs))
       type = BSType::_3E;
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(sigs))
       type = BSType::_3F;
     else
       type = BSType::_4K;  // Most common bankswitching type
   }
 
   // Variable sized ROM formats are independent of image size and come last
-  if(isProbablyDASH(image, size))
+  if(isProbablyDASH(sigs))
     type = BSType::_DASH;
-  else if(isProbably3EPlus(image, size))
+  else if(isProbably3EPlus(sigs))
     type = BSType::_3EP;
-  else if(isProbablyMDM(image, size))
+  else if(isProbablyMDM(sigs))
     type = BSType::_MDM;
 
   return type;
@@ -568,72 +711,55 @@ bool CartDetector::isProbably4KSC(const BytePtr& image, uInt32 size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyARM(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyARM(const Signatures& sigs)
 {
-  // ARM code contains the following 'loader' patterns in the first 1K
-  // Thanks to Thomas Jentzsch of AtariAge for this advice
-  uInt8 signature[2][4] = {
-    { 0xA0, 0xC1, 0x1F, 0xE0 },
-    { 0x00, 0x80, 0x02, 0xE0 }
-  };
-  if(searchForBytes(image.get(), std::min(size, 1024u), signature[0], 4, 1))
+  // ARM code contains the 'loader' patterns in the first 1K
+  if(sigs.searchWithin(SigARM[0], 4, 1024))
     return true;
   else
-    return searchForBytes(image.get(), std::min(size, 1024u), signature[1], 4, 1);
+    return sigs.searchWithin(SigARM[1], 4, 1024);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably0840(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbably0840(const Signatures& sigs)
 {
   // 0840 cart bankswitching is triggered by accessing addresses 0x0800
   // or 0x0840 at least twice
-  uInt8 signature1[3][3] = {
-    { 0xAD, 0x00, 0x08 },  // LDA $0800
-    { 0xAD, 0x40, 0x08 },  // LDA $0840
-    { 0x2C, 0x00, 0x08 }   // BIT $0800
-  };
   for(uInt32 i = 0; i < 3; ++i)
-    if(searchForBytes(image.get(), size, signature1[i], 3, 2))
+    if(sigs.search(Sig0840a[i], 3, 2))
       return true;
 
-  uInt8 signature2[2][4] = {
-    { 0x0C, 0x00, 0x08, 0x4C },  // NOP $0800; JMP ...
-    { 0x0C, 0xFF, 0x0F, 0x4C }   // NOP $0FFF; JMP ...
-  };
   for(uInt32 i = 0; i < 2; ++i)
-    if(searchForBytes(image.get(), size, signature2[i], 4, 2))
+    if(sigs.search(Sig0840b[i], 4, 2))
       return true;
 
   return false;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3E(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbably3E(const Signatures& sigs)
 {
   // 3E cart bankswitching is triggered by storing the bank number
   // in address 3E using 'STA $3E', commonly followed by an
   // immediate mode LDA
-  uInt8 signature[] = { 0x85, 0x3E, 0xA9, 0x00 };  // STA $3E; LDA #$00
-  return searchForBytes(image.get(), size, signature, 4, 1);
+  return sigs.search(Sig3E[0], 4, 1);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3EPlus(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbably3EPlus(const Signatures& sigs)
 {
   // 3E+ cart is identified key 'TJ3E' in the ROM
-  uInt8 signature[] = { 'T', 'J', '3', 'E' };
-  return searchForBytes(image.get(), size, signature, 4, 1);
+  return sigs.search(Sig3EPlus[0], 4, 1);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3F(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbably3F(const Signatures& sigs)
 {
   // 3F cart bankswitching is triggered by storing the bank number
   // in address 3F using 'STA $3F'
   // We expect it will be present at least 2 times, since there are
   // at least two banks
-  uInt8 signature[] = { 0x85, 0x3F };  // STA $3F
-  return searchForBytes(image.get(), size, signature, 2, 2);
+  return sigs.search(Sig3F[0], 2, 2);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -661,18 +787,13 @@ bool CartDetector::isProbablyCTY(const BytePtr&, uInt32)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyCV(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyCV(const Signatures& sigs)
 {
   // CV RAM access occurs at addresses $f3ff and $f400
-  // These signatures are attributed to the MESS project
-  uInt8 signature[2][3] = {
-    { 0x9D, 0xFF, 0xF3 },  // STA $F3FF.X
-    { 0x99, 0x00, 0xF4 }   // STA $F400.Y
-  };
-  if(searchForBytes(image.get(), size, signature[0], 3, 1))
+  if(sigs.search(SigCV[0], 3, 1))
     return true;
   else
-    return searchForBytes(image.get(), size, signature[1], 3, 1);
+    return sigs.search(SigCV[1], 3, 1);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -686,95 +807,68 @@ bool CartDetector::isProbablyCVPlus(const BytePtr& image, uInt32)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyDASH(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyDASH(const Signatures& sigs)
 {
   // DASH cart is identified key 'TJAD' in the ROM
-  uInt8 signature[] = { 'T', 'J', 'A', 'D' };
-  return searchForBytes(image.get(), size, signature, 4, 1);
+  return sigs.search(SigDASH[0], 4, 1);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyDPCplus(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyDPCplus(const Signatures& sigs)
 {
   // DPC+ ARM code has 2 occurrences of the string DPC+
   // Note: all Harmony/Melody custom drivers also contain the value
   // 0x10adab1e (LOADABLE) if needed for future improvement
-  uInt8 signature[] = { 'D', 'P', 'C', '+' };
-  return searchForBytes(image.get(), size, signature, 4, 2);
+  return sigs.search(SigDPCplus[0], 4, 2);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyE0(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyE0(const Signatures& sigs)
 {
   // E0 cart bankswitching is triggered by accessing addresses
   // $FE0 to $FF9 using absolute non-indexed addressing
   // To eliminate false positives (and speed up processing), we
   // search for only certain known signatures
   // Thanks to "stella@casperkitty.com" for this advice
-  // These signatures are attributed to the MESS project
-  uInt8 signature[8][3] = {
-    { 0x8D, 0xE0, 0x1F },  // STA $1FE0
-    { 0x8D, 0xE0, 0x5F },  // STA $5FE0
-    { 0x8D, 0xE9, 0xFF },  // STA $FFE9
-    { 0x0C, 0xE0, 0x1F },  // NOP $1FE0
-    { 0xAD, 0xE0, 0x1F },  // LDA $1FE0
-    { 0xAD, 0xE9, 0xFF },  // LDA $FFE9
-    { 0xAD, 0xED, 0xFF },  // LDA $FFED
-    { 0xAD, 0xF3, 0xBF }   // LDA $BFF3
-  };
   for(uInt32 i = 0; i < 8; ++i)
-    if(searchForBytes(image.get(), size, signature[i], 3, 1))
+    if(sigs.search(SigE0[i], 3, 1))
       return true;
 
   return false;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyE7(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyE7(const Signatures& sigs)
 {
   // E7 cart bankswitching is triggered by accessing addresses
   // $FE0 to $FE6 using absolute non-indexed addressing
   // To eliminate false positives (and speed up processing), we
   // search for only certain known signatures
   // Thanks to "stella@casperkitty.com" for this advice
-  // These signatures are attributed to the MESS project
-  uInt8 signature[7][3] = {
-    { 0xAD, 0xE2, 0xFF },  // LDA $FFE2
-    { 0xAD, 0xE5, 0xFF },  // LDA $FFE5
-    { 0xAD, 0xE5, 0x1F },  // LDA $1FE5
-    { 0xAD, 0xE7, 0x1F },  // LDA $1FE7
-    { 0x0C, 0xE7, 0x1F },  // NOP $1FE7
-    { 0x8D, 0xE7, 0xFF },  // STA $FFE7
-    { 0x8D, 0xE7, 0x1F }   // STA $1FE7
-  };
   for(uInt32 i = 0; i < 7; ++i)
-    if(searchForBytes(image.get(), size, signature[i], 3, 1))
+    if(sigs.search(SigE7[i], 3, 1))
       return true;
 
   return false;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyE78K(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyE78K(const Signatures& sigs)
 {
   // E78K cart bankswitching is triggered by accessing addresses
   // $FE4 to $FE6 using absolute non-indexed addressing
   // To eliminate false positives (and speed up processing), we
   // search for only certain known signatures
-  uInt8 signature[3][3] = {
-    { 0xAD, 0xE4, 0xFF },  // LDA $FFE4
-    { 0xAD, 0xE5, 0xFF },  // LDA $FFE5
-    { 0xAD, 0xE6, 0xFF },  // LDA $FFE6
-  };
   for(uInt32 i = 0; i < 3; ++i)
-    if(searchForBytes(image.get(), size, signature[i], 3, 1))
+    if(sigs.search(SigE78K[i], 3, 1))
       return true;
 
   return false;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyEF(const BytePtr& image, uInt32 size, BSType& type)
+bool CartDetector::isProbablyEF(const BytePtr& image, uInt32 size,
+                                const Signatures& sigs, BSType& type)
 {
   // Newer EF carts store strings 'EFEF' and 'EFSC' starting at address $FFF8
   // This signature is attributed to "RevEng" of AtariAge
@@ -795,15 +889,9 @@ bool CartDetector::isProbablyEF(const BytePtr& image, uInt32 size, BSType& type)
   // 0xFE0 to 0xFEF, usually with either a NOP or LDA
   // It's likely that the code will switch to bank 0, so that's what is tested
   bool isEF = false;
-  uInt8 signature[4][3] = {
-    { 0x0C, 0xE0, 0xFF },  // NOP $FFE0
-    { 0xAD, 0xE0, 0xFF },  // LDA $FFE0
-    { 0x0C, 0xE0, 0x1F },  // NOP $1FE0
-    { 0xAD, 0xE0, 0x1F }   // LDA $1FE0
-  };
   for(uInt32 i = 0; i < 4; ++i)
   {
-    if(searchForBytes(image.get(), size, signature[i], 3, 1))
+    if(sigs.search(SigEF[i], 3, 1))
     {
       isEF = true;
       break;
@@ -843,23 +931,21 @@ bool CartDetector::isProbablyBF(const BytePtr& image, uInt32 size, BSType& type)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyBUS(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyBUS(const Signatures& sigs)
 {
   // BUS ARM code has 2 occurrences of the string BUS
   // Note: all Harmony/Melody custom drivers also contain the value
   // 0x10adab1e (LOADABLE) if needed for future improvement
-  uInt8 bus[] = { 'B', 'U', 'S'};
-  return searchForBytes(image.get(), size, bus, 3, 2);
+  return sigs.search(SigBUS[0], 3, 2);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyCDF(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyCDF(const Signatures& sigs)
 {
   // CDF ARM code has 3 occurrences of the string DPC+
   // Note: all Harmony/Melody custom drivers also contain the value
   // 0x10adab1e (LOADABLE) if needed for future improvement
-  uInt8 signature[] = { 'C', 'D', 'F' };
-  return searchForBytes(image.get(), size, signature, 3, 3);
+  return sigs.search(SigCDF[0], 3, 3);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -900,78 +986,245 @@ bool CartDetector::isProbablyFA2(const BytePtr& image, uInt32)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyFE(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyFE(const Signatures& sigs)
 {
   // FE bankswitching is very weird, but always seems to include a
   // 'JSR $xxxx'
-  // These signatures are attributed to the MESS project
-  uInt8 signature[4][5] = {
-    { 0x20, 0x00, 0xD0, 0xC6, 0xC5 },  // JSR $D000; DEC $C5
-    { 0x20, 0xC3, 0xF8, 0xA5, 0x82 },  // JSR $F8C3; LDA $82
-    { 0xD0, 0xFB, 0x20, 0x73, 0xFE },  // BNE $FB; JSR $FE73
-    { 0x20, 0x00, 0xF0, 0x84, 0xD6 }   // JSR $F000; STY $D6
-  };
   for(uInt32 i = 0; i < 4; ++i)
-    if(searchForBytes(image.get(), size, signature[i], 5, 1))
+    if(sigs.search(SigFE[i], 5, 1))
       return true;
 
   return false;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyMDM(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyMDM(const Signatures& sigs)
 {
   // MDM cart is identified key 'MDMC' in the first 8K of ROM
-  uInt8 signature[] = { 'M', 'D', 'M', 'C' };
-  return searchForBytes(image.get(), std::min(size, 8192u), signature, 4, 1);
+  return sigs.searchWithin(SigMDM[0], 4, 8192);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablySB(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablySB(const Signatures& sigs)
 {
   // SB cart bankswitching switches banks by accessing address 0x0800
-  uInt8 signature[2][3] = {
-    { 0xBD, 0x00, 0x08 },  // LDA $0800,x
-    { 0xAD, 0x00, 0x08 }   // LDA $0800
-  };
-  if(searchForBytes(image.get(), size, signature[0], 3, 1))
+  if(sigs.search(SigSB[0], 3, 1))
     return true;
   else
-    return searchForBytes(image.get(), size, signature[1], 3, 1);
+    return sigs.search(SigSB[1], 3, 1);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyUA(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyUA(const Signatures& sigs)
 {
   // UA cart bankswitching switches to bank 1 by accessing address 0x240
   // using 'STA $240' or 'LDA $240'
-  uInt8 signature[3][3] = {
-    { 0x8D, 0x40, 0x02 },  // STA $240
-    { 0xAD, 0x40, 0x02 },  // LDA $240
-    { 0xBD, 0x1F, 0x02 }   // LDA $21F,X
-  };
   for(uInt32 i = 0; i < 3; ++i)
-    if(searchForBytes(image.get(), size, signature[i], 3, 1))
+    if(sigs.search(SigUA[i], 3, 1))
       return true;
 
   return false;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyX07(const BytePtr& image, uInt32 size)
+bool CartDetector::isProbablyX07(const Signatures& sigs)
 {
   // X07 bankswitching switches to bank 0, 1, 2, etc by accessing address 0x08xd
-  uInt8 signature[6][3] = {
-    { 0xAD, 0x0D, 0x08 },  // LDA $080D
-    { 0xAD, 0x1D, 0x08 },  // LDA $081D
-    { 0xAD, 0x2D, 0x08 },  // LDA $082D
-    { 0x0C, 0x0D, 0x08 },  // NOP $080D
-    { 0x0C, 0x1D, 0x08 },  // NOP $081D
-    { 0x0C, 0x2D, 0x08 }   // NOP $082D
-  };
   for(uInt32 i = 0; i < 6; ++i)
-    if(searchForBytes(image.get(), size, signature[i], 3, 1))
+    if(sigs.search(SigX07[i], 3, 1))
       return true;
 
   return false;
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+struct CartDetector::Signatures::Automaton
+{
+  // Dense transition table; 256 entries per node, node 0 is the root
+  vector<uInt16> next;
+  // Signature length for pattern nodes, 0 for all other nodes
+  vector<uInt8> length;
+  // The pattern nodes matched when entering each node are
+  // outputs[outputStart[node] .. outputStart[node+1]-1]; only nodes
+  // numbered 'firstOutput' and above have any
+  vector<uInt32> outputStart;
+  uInt32 firstOutput;
+  vector<uInt16> outputs;
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const CartDetector::Signatures::Automaton&
+CartDetector::Signatures::automaton()
+{
+  static const Automaton ourAutomaton = [] {
+    vector<uInt16> next(256, 0);
+    vector<uInt8> length(1, 0), depth(1, 0);
+
+    // Build the trie of all signatures
+    for(const auto& table: ourSignatureTables)
+    {
+      for(uInt32 s = 0; s < table.count; ++s)
+      {
+        const uInt8* sig = table.bytes + s * table.size;
+        uInt32 node = 0;
+        for(uInt32 i = 0; i < table.size; ++i)
+        {
+          uInt16& child = next[node * 256 + sig[i]];
+          if(child == 0)
+          {
+            child = uInt16(depth.size());
+            depth.push_back(uInt8(i + 1));
+            length.push_back(0);
+            next.resize(next.size() + 256, 0);
+          }
+          node = next[node * 256 + sig[i]];
+        }
+        length[node] = uInt8(table.size);
+      }
+    }
+
+    // Turn it into a DFA, following failure links breadth first;
+    // a node only depends on nodes closer to the root
+    const uInt32 numNodes = uInt32(depth.size());
+    vector<uInt16> fail(numNodes, 0), order(1, 0);
+    vector<vector<uInt16>> out(numNodes);
+    for(uInt32 q = 0; q < order.size(); ++q)
+    {
+      uInt32 node = order[q];
+      if(length[node])
+        out[node].push_back(uInt16(node));
+      out[node].insert(out[node].end(), out[fail[node]].begin(),
+                       out[fail[node]].end());
+
+      for(uInt32 c = 0; c < 256; ++c)
+      {
+        uInt16& child = next[node * 256 + c];
+        uInt16 viaFail = node == 0 ? 0 : next[fail[node] * 256 + c];
+        if(child != 0)  // a trie edge
+        {
+          fail[child] = viaFail;
+          order.push_back(child);
+        }
+        else
+          child = viaFail;
+      }
+    }
+
+    // Renumber the nodes so that those with outputs come last; the scan
+    // then needs only a single compare per byte to skip all the others
+    vector<uInt16> ordered, id(numNodes);
+    for(uInt32 node = 0; node < numNodes; ++node)
+      if(out[node].empty())
+        ordered.push_back(uInt16(node));
+    const uInt32 firstOutput = uInt32(ordered.size());
+    for(uInt32 node = 0; node < numNodes; ++node)
+      if(!out[node].empty())
+        ordered.push_back(uInt16(node));
+    for(uInt32 i = 0; i < numNodes; ++i)
+      id[ordered[i]] = uInt16(i);
+
+    Automaton a;
+    a.firstOutput = firstOutput;
+    a.next.resize(numNodes * 256);
+    a.length.resize(numNodes);
+    a.outputStart.reserve(numNodes + 1);
+    for(uInt32 i = 0; i < numNodes; ++i)
+    {
+      uInt32 node = ordered[i];
+      for(uInt32 c = 0; c < 256; ++c)
+        a.next[i * 256 + c] = id[next[node * 256 + c]];
+      a.length[i] = length[node];
+
+      a.outputStart.push_back(uInt32(a.outputs.size()));
+      for(uInt16 o: out[node])
+        a.outputs.push_back(id[o]);
+    }
+    a.outputStart.push_back(uInt32(a.outputs.size()));
+
+    return a;
+  }();
+
+  return ourAutomaton;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+CartDetector::Signatures::Signatures(const BytePtr& image, uInt32 size,
+                                     bool scan)
+  : myImage(image.get()),
+    mySize(size)
+{
+  if(!scan)
+    return;
+
+  const Automaton& a = automaton();
+  myHits.assign(a.length.size(), Hits{ 0, 0, 0 });
+
+  // 'searchForBytes' never considers a match ending on the last byte, and
+  // skips one extra byte after each match; the same rules apply here, so
+  // that every count is identical to what it would have found
+  const uInt16* next = a.next.data();
+  uInt32 node = 0;
+  for(uInt32 i = 0; i + 1 < size; ++i)
+  {
+    // Most bytes are read while at the root; testing for that explicitly
+    // lets the CPU start on the next lookup without waiting for this one
+    if(node == 0)
+      node = next[myImage[i]];
+    else
+      node = next[node * 256 + myImage[i]];
+    if(node < a.firstOutput)
+      continue;
+
+    for(uInt32 o = a.outputStart[node]; o < a.outputStart[node + 1]; ++o)
+    {
+      Hits& hits = myHits[a.outputs[o]];
+      uInt32 pos = i + 1 - a.length[a.outputs[o]];
+      if(pos >= hits.next)
+      {
+        if(hits.count++ == 0)
+          hits.first = pos;
+        hits.next = pos + a.length[a.outputs[o]] + 1;
+      }
+    }
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartDetector::Signatures::find(const uInt8* signature,
+                                      uInt32 sigsize) const
+{
+  if(myHits.empty())
+    return 0;
+
+  const Automaton& a = automaton();
+  uInt32 node = 0;
+  for(uInt32 i = 0; i < sigsize; ++i)
+    node = a.next[node * 256 + signature[i]];
+
+  // Following DFA transitions lands on the signature's own node only if
+  // the signature is in the trie; otherwise we end on a shorter suffix
+  return a.length[node] == sigsize ? node : 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool CartDetector::Signatures::search(const uInt8* signature, uInt32 sigsize,
+                                      uInt32 minhits) const
+{
+  uInt32 node = find(signature, sigsize);
+  if(node == 0)  // not in the tables; fall back to a regular search
+    return searchForBytes(myImage, mySize, signature, sigsize, minhits);
+
+  return myHits[node].count >= minhits;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool CartDetector::Signatures::searchWithin(const uInt8* signature,
+                                            uInt32 sigsize, uInt32 limit) const
+{
+  limit = std::min(limit, mySize);
+  uInt32 node = find(signature, sigsize);
+  if(node == 0)  // not in the tables; fall back to a regular search
+    return searchForBytes(myImage, limit, signature, sigsize, 1);
+
+  return myHits[node].count > 0 && myHits[node].first + sigsize < limit;
+}
@@ -48,7 +48,86 @@ class CartDetector
     static unique_ptr<Cartridge> create(const BytePtr& image, uInt32 size,
                  string& md5, const string& dtype, const OSystem& system);
 
+    /**
+      Try to auto-detect the bankswitching type of the cartridge
+
+      @param image  A pointer to the ROM image
+      @param size   The size of the ROM image
+
+      @return The "best guess" for the cartridge type
+    */
+    static BSType autodetectType(const BytePtr& image, uInt32 size);
+
+    /**
+      Same as autodetectType(), but searches the image separately for each
+      signature using 'searchForBytes', as was done before the single-pass
+      matcher existed.  Much slower; only meant for verifying that both
+      always come to the same result.
+
+      @param image  A pointer to the ROM image
+      @param size   The size of the ROM image
+
+      @return The "best guess" for the cartridge type
+    */
+    static BSType autodetectTypeReference(const BytePtr& image, uInt32 size);
+
   private:
+    /**
+      The results of matching every known bankswitch signature against a
+      ROM image, all gathered in a single pass (using an Aho-Corasick
+      automaton built once from the signature tables).  Each query gives
+      exactly the answer 'searchForBytes' would give for the whole image.
+
+      Without the scan, every query is passed on to 'searchForBytes'.
+    */
+    class Signatures
+    {
+      public:
+        Signatures(const BytePtr& image, uInt32 size, bool scan = true);
+
+        /**
+          Returns true if the signature was found at least 'minhits' times
+          in the image, counted the same way as in 'searchForBytes'
+        */
+        bool search(const uInt8* signature, uInt32 sigsize,
+                    uInt32 minhits = 1) const;
+
+        /**
+          Returns true if the signature was found within the first 'limit'
+          bytes of the image
+        */
+        bool searchWithin(const uInt8* signature, uInt32 sigsize,
+                          uInt32 limit) const;
+
+      private:
+        struct Automaton;
+        static const Automaton& automaton();
+
+        // Per-node state of the last scan; only pattern nodes are used
+        struct Hits {
+          uInt32 first;  // position of the first match
+          uInt32 count;  // number of non-overlapping matches
+          uInt32 next;   // first position at which another match may count
+        };
+
+        // Returns the automaton node for the signature, or 0 if the
+        // signature isn't in the tables (or the image wasn't scanned)
+        uInt32 find(const uInt8* signature, uInt32 sigsize) const;
+
+      private:
+        const uInt8* myImage;
+        uInt32 mySize;
+        vector<Hits> myHits;
+
+      private:
+        // Following constructors and assignment operators not supported
+        Signatures() = delete;
+        Signatures(const Signatures&) = delete;
+        Signatures(Signatures&&) = delete;
+        Signatures& operator=(const Signatures&) = delete;
+        Signatures& operator=(Signatures&&) = delete;
+    };
+
     /**
       Create a cartridge from a multi-cart image pointer; internally this
       takes a slice of the ROM image ues that for the cartridge.
@@ -84,14 +163,10 @@ class CartDetector
                       const string& md5, const OSystem& osystem);
 
     /**
-      Try to auto-detect the bankswitching type of the cartridge
-
-      @param image  A pointer to the ROM image
-      @param size   The size of the ROM image
-
-      @return The "best guess" for the cartridge type
+      Auto-detect the bankswitching type, using the given signature matches
     */
-    static BSType autodetectType(const BytePtr& image, uInt32 size);
+    static BSType autodetectType(const BytePtr& image, uInt32 size,
+                                 const Signatures& sigs);
 
     /**
       Search the image for the specified byte signature
@@ -122,27 +197,27 @@ class CartDetector
     /**
       Returns true if the image probably contains ARM code in the first 1K
     */
-    static bool isProbablyARM(const BytePtr& image, uInt32 size);
+    static bool isProbablyARM(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a 0840 bankswitching cartridge
     */
-    static bool isProbably0840(const BytePtr& image, uInt32 size);
+    static bool isProbably0840(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a 3E bankswitching cartridge
     */
-    static bool isProbably3E(const BytePtr& image, uInt32 size);
+    static bool isProbably3E(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a 3E+ bankswitching cartridge
     */
-    static bool isProbably3EPlus(const BytePtr& image, uInt32 size);
+    static bool isProbably3EPlus(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a 3F bankswitching cartridge
     */
-    static bool isProbably3F(const BytePtr& image, uInt32 size);
+    static bool isProbably3F(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a 4A50 bankswitching cartridge
@@ -157,12 +232,12 @@ class CartDetector
     /**
       Returns true if the image is probably a BUS bankswitching cartridge
     */
-    static bool isProbablyBUS(const BytePtr& image, uInt32 size);
+    static bool isProbablyBUS(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a CDF bankswitching cartridge
     */
-    static bool isProbablyCDF(const BytePtr& image, uInt32 size);
+    static bool isProbablyCDF(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a CTY bankswitching cartridge
@@ -172,7 +247,7 @@ class CartDetector
     /**
       Returns true if the image is probably a CV bankswitching cartridge
     */
-    static bool isProbablyCV(const BytePtr& image, uInt32 size);
+    static bool isProbablyCV(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a CV+ bankswitching cartridge
@@ -182,7 +257,7 @@ class CartDetector
     /**
       Returns true if the image is probably a DASH bankswitching cartridge
     */
-    static bool isProbablyDASH(const BytePtr& image, uInt32 size);
+    static bool isProbablyDASH(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a DF/DFSC bankswitching cartridge
@@ -192,27 +267,28 @@ class CartDetector
     /**
       Returns true if the image is probably a DPC+ bankswitching cartridge
     */
-    static bool isProbablyDPCplus(const BytePtr& image, uInt32 size);
+    static bool isProbablyDPCplus(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a E0 bankswitching cartridge
     */
-    static bool isProbablyE0(const BytePtr& image, uInt32 size);
+    static bool isProbablyE0(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a E7 bankswitching cartridge
     */
-    static bool isProbablyE7(const BytePtr& image, uInt32 size);
+    static bool isProbablyE7(const Signatures& sigs);
 
     /**
     Returns true if the image is probably a E78K bankswitching cartridge
     */
-    static bool isProbablyE78K(const BytePtr& image, uInt32 size);
+    static bool isProbablyE78K(const Signatures& sigs);
 
     /**
       Returns true if the image is probably an EF/EFSC bankswitching cartridge
     */
-    static bool isProbablyEF(const BytePtr& image, uInt32 size, BSType& type);
+    static bool isProbablyEF(const BytePtr& image, uInt32 size,
+                             const Signatures& sigs, BSType& type);
 
     /**
       Returns true if the image is probably an F6 bankswitching cartridge
@@ -227,27 +303,27 @@ class CartDetector
     /**
       Returns true if the image is probably an FE bankswitching cartridge
     */
-    static bool isProbablyFE(const BytePtr& image, uInt32 size);
+    static bool isProbablyFE(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a MDM bankswitching cartridge
     */
-    static bool isProbablyMDM(const BytePtr& image, uInt32 size);
+    static bool isProbablyMDM(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a SB bankswitching cartridge
     */
-    static bool isProbablySB(const BytePtr& image, uInt32 size);
+    static bool isProbablySB(const Signatures& sigs);
 
     /**
       Returns true if the image is probably a UA bankswitching cartridge
     */
-    static bool isProbablyUA(const BytePtr& image, uInt32 size);
+    static bool isProbablyUA(const Signatures& sigs);
 
     /**
       Returns true if the image is probably an X07 bankswitching cartridge
     */
-    static bool isProbablyX07(const BytePtr& image, uInt32 size);
+    static bool isProbablyX07(const Signatures& sigs);
 
   private:
     // Following constructors and assignment operators not supported
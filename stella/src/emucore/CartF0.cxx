@@ -47,6 +47,9 @@ void CartridgeF0::install(System& system)
 {
   mySystem = &system;
 
+  // Precompute the page accesses for all banks
+  createBankPages(myImage, bankCount(), 0x1000, 0x1FF0);
+
   // Install pages for the startup bank
   bank(myStartBank);
 }
@@ -91,24 +94,8 @@ bool CartridgeF0::bank(uInt16 bank)
   // Remember what bank we're in
   myBankOffset = bank << 12;
 
-  System::PageAccess access(this, System::PA_READ);
-
-  // Set the page accessing methods for the hot spots
-  for(uInt16 addr = (0x1FF0 & ~System::PAGE_MASK); addr < 0x2000;
-      addr += System::PAGE_SIZE)
-  {
-    access.codeAccessBase = &myCodeAccessBase[myBankOffset + (addr & 0x0FFF)];
-    mySystem->setPageAccess(addr, access);
-  }
-
-  // Setup the page access methods for the current bank
-  for(uInt16 addr = 0x1000; addr < (0x1FF0U & ~System::PAGE_MASK);
-      addr += System::PAGE_SIZE)
-  {
-    access.directPeekBase = &myImage[myBankOffset + (addr & 0x0FFF)];
-    access.codeAccessBase = &myCodeAccessBase[myBankOffset + (addr & 0x0FFF)];
-    mySystem->setPageAccess(addr, access);
-  }
+  // Install the precomputed page accesses for the bank
+  installBankPages(bank);
 
   return myBankChanged = true;
 }
@@ -82,6 +82,9 @@ void CartridgeFA2::install(System& system)
     mySystem->setPageAccess(addr, access);
   }
 
+  // Precompute the page accesses for all banks
+  createBankPages(myImage, bankCount(), 0x1200, 0x1FF4);
+
   // Install pages for the startup bank
   bank(myStartBank);
 }
@@ -226,24 +229,9 @@ bool CartridgeFA2::bank(uInt16 bank)
   // Remember what bank we're in
   myBankOffset = bank << 12;
 
-  System::PageAccess access(this, System::PA_READ);
+  // Install the precomputed page accesses for the bank
+  installBankPages(bank);
 
-  // Set the page accessing methods for the hot spots
-  for(uInt16 addr = (0x1FF4 & ~System::PAGE_MASK); addr < 0x2000;
-      addr += System::PAGE_SIZE)
-  {
-    access.codeAccessBase = &myCodeAccessBase[myBankOffset + (addr & 0x0FFF)];
-    mySystem->setPageAccess(addr, access);
-  }
-
-  // Setup the page access methods for the current bank
-  for(uInt16 addr = 0x1200; addr < (0x1FF4U & ~System::PAGE_MASK);
-      addr += System::PAGE_SIZE)
-  {
-    access.directPeekBase = &myImage[myBankOffset + (addr & 0x0FFF)];
-    access.codeAccessBase = &myCodeAccessBase[myBankOffset + (addr & 0x0FFF)];
-    mySystem->setPageAccess(addr, access);
-  }
   return myBankChanged = true;
 }
 
@@ -356,7 +344,7 @@ uInt8 CartridgeFA2::ramReadWrite()
   if(myRamAccessTimeout == 0)
   {
     // Remember when the first access was made
-    myRamAccessTimeout = myOSystem.getTicks();
+    myRamAccessTimeout = mySystem->cycles();
 
     // We go ahead and do the access now, and only return when a sufficient
     // amount of time has passed
@@ -373,7 +361,7 @@ uInt8 CartridgeFA2::ramReadWrite()
         {
           memset(myRAM, 0, 256);
         }
-        myRamAccessTimeout += 500;  // Add 0.5 ms delay for read
+        myRamAccessTimeout += 597;  // Add 0.5 ms delay for read
       }
       else if(myRAM[255] == 2)  // write
       {
@@ -386,7 +374,7 @@ uInt8 CartridgeFA2::ramReadWrite()
           // Maybe add logging here that save failed?
           cerr << name() << ": ERROR saving score table" << endl;
         }
-        myRamAccessTimeout += 101000;  // Add 101 ms delay for write
+        myRamAccessTimeout += 120500;  // Add 101 ms delay for write
       }
     }
     // Bit 6 is 1, busy
@@ -395,7 +383,7 @@ uInt8 CartridgeFA2::ramReadWrite()
   else
   {
     // Have we reached the timeout value yet?
-    if(myOSystem.getTicks() >= myRamAccessTimeout)
+    if(mySystem->cycles() >= myRamAccessTimeout)
     {
       myRamAccessTimeout = 0;  // Turn off timer
       myRAM[255] = 0;          // Successful operation
@@ -203,7 +203,8 @@ class CartridgeFA2 : public Cartridge
     // The time after which the first request of a load/save operation
     // will actually be completed
     // Due to flash RAM constraints, a read/write isn't instantaneous,
-    // so we need to emulate the delay as well
+    // so we need to emulate the delay as well (in CPU cycles, so that it
+    // doesn't depend on the speed of the host)
     uInt64 myRamAccessTimeout;
 
     // Full pathname of the file to use when emulating load/save
@@ -65,6 +65,9 @@ void CartridgeSB::install(System& system)
   for(uInt16 addr = 0x0800; addr < 0x0FFF; addr += System::PAGE_SIZE)
     mySystem->setPageAccess(addr, access);
 
+  // Precompute the page accesses for all banks
+  createBankPages(myImage.get(), bankCount());
+
   // Install pages for startup bank
   bank(myStartBank);
 }
@@ -116,16 +119,9 @@ bool CartridgeSB::bank(uInt16 bank)
   // Remember what bank we're in
   myBankOffset = bank << 12;
 
-  // Setup the page access methods for the current bank
-  System::PageAccess access(this, System::PA_READ);
+  // Install the precomputed page accesses for the bank
+  installBankPages(bank);
 
-  // Map ROM image into the system
-  for(uInt16 addr = 0x1000; addr < 0x2000; addr += System::PAGE_SIZE)
-  {
-    access.directPeekBase = &myImage[myBankOffset + (addr & 0x0FFF)];
-    access.codeAccessBase = &myCodeAccessBase[myBankOffset + (addr & 0x0FFF)];
-    mySystem->setPageAccess(addr, access);
-  }
   return myBankChanged = true;
 }
 
@@ -56,6 +56,9 @@ void CartridgeUA::install(System& system)
   mySystem->setPageAccess(0x0220, access);
   mySystem->setPageAccess(0x0240, access);
 
+  // Precompute the page accesses for all banks
+  createBankPages(myImage, bankCount());
+
   // Install pages for the startup bank
   bank(myStartBank);
 }
@@ -125,16 +128,9 @@ bool CartridgeUA::bank(uInt16 bank)
   // Remember what bank we're in
   myBankOffset = bank << 12;
 
-  // Setup the page access methods for the current bank
-  System::PageAccess access(this, System::PA_READ);
+  // Install the precomputed page accesses for the bank
+  installBankPages(bank);
 
-  // Map ROM image into the system
-  for(uInt16 addr = 0x1000; addr < 0x2000; addr += System::PAGE_SIZE)
-  {
-    access.directPeekBase = &myImage[myBankOffset + (addr & 0x0FFF)];
-    access.codeAccessBase = &myCodeAccessBase[myBankOffset + (addr & 0x0FFF)];
-    mySystem->setPageAccess(addr, access);
-  }
   return myBankChanged = true;
 }
 
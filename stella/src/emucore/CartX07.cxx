@@ -53,6 +53,9 @@ void CartridgeX07::install(System& system)
   for(uInt16 addr = 0x00; addr < 0x1000; addr += System::PAGE_SIZE)
     mySystem->setPageAccess(addr, access);
 
+  // Precompute the page accesses for all banks
+  createBankPages(myImage, bankCount());
+
   // Install pages for the startup bank
   bank(myStartBank);
 }
@@ -109,18 +112,10 @@ bool CartridgeX07::bank(uInt16 bank)
 
   // Remember what bank we're in
   myCurrentBank = (bank & 0x0f);
-  uInt32 offset = myCurrentBank << 12;
 
-  // Setup the page access methods for the current bank
-  System::PageAccess access(this, System::PA_READ);
+  // Install the precomputed page accesses for the bank
+  installBankPages(myCurrentBank);
 
-  // Map ROM image into the system
-  for(uInt16 addr = 0x1000; addr < 0x2000; addr += System::PAGE_SIZE)
-  {
-    access.directPeekBase = &myImage[offset + (addr & 0x0FFF)];
-    access.codeAccessBase = &myCodeAccessBase[offset + (addr & 0x0FFF)];
-    mySystem->setPageAccess(addr, access);
-  }
   return myBankChanged = true;
 }
 
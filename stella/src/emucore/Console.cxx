@@ -23,6 +23,7 @@
 #include "Cart.hxx"
 #include "Control.hxx"
 #include "Cart.hxx"
+#include "DetectionCache.hxx"
 #include "Driving.hxx"
 #include "Event.hxx"
 #include "EventHandler.hxx"
@@ -56,8 +57,7 @@
 #include "TIAConstants.hxx"
 #include "FrameLayout.hxx"
 #include "frame-manager/FrameManager.hxx"
-#include "frame-manager/FrameLayoutDetector.hxx"
-#include "frame-manager/YStartDetector.hxx"
+#include "frame-manager/DisplayDetector.hxx"
 
 #ifdef DEBUGGER_SUPPORT
   #include "Debugger.hxx"
@@ -125,19 +125,16 @@ Console::Console(OSystem& osystem, unique_ptr<Cartridge>& cart,
   myOSystem.sound().mute(1);
   myOSystem.frameBuffer().clear();
 
-  if(myDisplayFormat == "AUTO" || myOSystem.settings().getBool("rominfo"))
-  {
-    autodetectFrameLayout();
-
-    if(myProperties.get(Display_Format) == "AUTO")
-    {
-      autodetected = "*";
-      myCurrentFormat = 0;
-    }
-  }
+  bool detectLayout = myDisplayFormat == "AUTO" ||
+                      myOSystem.settings().getBool("rominfo");
+  bool detectYStart = atoi(myProperties.get(Display_YStart).c_str()) == 0;
+  if(detectLayout || detectYStart)
+    autodetectDisplay(detectLayout, detectYStart);
 
-  if (atoi(myProperties.get(Display_YStart).c_str()) == 0) {
-    autodetectYStart();
+  if(detectLayout && myProperties.get(Display_Format) == "AUTO")
+  {
+    autodetected = "*";
+    myCurrentFormat = 0;
   }
 
   myConsoleInfo.DisplayFormat = myDisplayFormat + autodetected;
@@ -182,7 +179,10 @@ Console::Console(OSystem& osystem, unique_ptr<Cartridge>& cart,
   bool joyallow4 = myOSystem.settings().getBool("joyallow4");
   myOSystem.eventHandler().allowAllDirections(joyallow4);
 
-  // Reset the system to its power-on state
+  // Reset the system to its power-on state; autodetection may or may not
+  // have consumed random numbers (depending on the detection cache), so
+  // the generator starts anew for a 'seed' to give reproducible results
+  mySystem->randGenerator().initSeed();
   mySystem->reset();
 
   // Finally, add remaining info about the console
@@ -208,51 +208,55 @@ Console::~Console()
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void Console::autodetectFrameLayout()
-{
-  // Run the TIA, looking for PAL scanline patterns
-  // We turn off the SuperCharger progress bars, otherwise the SC BIOS
-  // will take over 250 frames!
-  // The 'fastscbios' option must be changed before the system is reset
-  bool fastscbios = myOSystem.settings().getBool("fastscbios");
-  myOSystem.settings().setValue("fastscbios", true);
-
-  FrameLayoutDetector frameLayoutDetector;
-  myTIA->setFrameManager(&frameLayoutDetector);
-  mySystem->reset(true);
-
-  for(int i = 0; i < 60; ++i) myTIA->update();
-
-  myTIA->setFrameManager(myFrameManager.get());
-
-  myDisplayFormat = frameLayoutDetector.detectedLayout() == FrameLayout::pal ? "PAL" : "NTSC";
-
-  // Don't forget to reset the SC progress bars again
-  myOSystem.settings().setValue("fastscbios", fastscbios);
-}
-
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void Console::autodetectYStart()
+void Console::autodetectDisplay(bool detectLayout, bool detectYStart)
 {
-  // We turn off the SuperCharger progress bars, otherwise the SC BIOS
-  // will take over 250 frames!
-  // The 'fastscbios' option must be changed before the system is reset
-  bool fastscbios = myOSystem.settings().getBool("fastscbios");
-  myOSystem.settings().setValue("fastscbios", true);
+  // Without layout detection, ystart is detected for the configured layout
+  // (and not cached, since the cache only holds complete results)
+  const FrameLayout configuredLayout =
+    myDisplayFormat == "PAL" ? FrameLayout::pal : FrameLayout::ntsc;
+  const string& md5 = myProperties.get(Cartridge_MD5);
+  DetectionCache& cache = myOSystem.detectionCache();
+  DetectionCache::Entry entry;
 
-  YStartDetector ystartDetector;
-  ystartDetector.setLayout(myDisplayFormat == "PAL" ? FrameLayout::pal : FrameLayout::ntsc);
-  myTIA->setFrameManager(&ystartDetector);
-  mySystem->reset(true);
+  if(!cache.get(md5, myCart->name(), entry) ||
+     (!detectLayout && entry.layout != configuredLayout))
+  {
+    // We turn off the SuperCharger progress bars, otherwise the SC BIOS
+    // will take over 250 frames!
+    // The 'fastscbios' option must be changed before the system is reset
+    bool fastscbios = myOSystem.settings().getBool(Settings::FastSCBios);
+    myOSystem.settings().setValue(Settings::FastSCBios, true);
+
+    // Run the TIA until both results are known; ystart is always detected
+    // along with the layout, so that the entry can be cached
+    DisplayDetector detector;
+    if(!detectLayout)
+      detector.setLayout(configuredLayout);
+    myTIA->setFrameManager(&detector);
+    mySystem->reset(true);
+
+    for(int i = 0; i < 80; ++i)
+    {
+      if(detector.layoutDetected() && detector.ystartDetected())
+        break;
+      myTIA->update();
+    }
 
-  for (int i = 0; i < 80; i++) myTIA->update();
+    myTIA->setFrameManager(myFrameManager.get());
 
-  myTIA->setFrameManager(myFrameManager.get());
+    entry.layout = detector.detectedLayout();
+    entry.ystart = detector.detectedYStart();
+    if(detectLayout)
+      cache.insert(md5, myCart->name(), entry);
 
-  myAutodetectedYstart = ystartDetector.detectedYStart() - YSTART_EXTRA;
+    // Don't forget to reset the SC progress bars again
+    myOSystem.settings().setValue(Settings::FastSCBios, fastscbios);
+  }
 
-  // Don't forget to reset the SC progress bars again
-  myOSystem.settings().setValue("fastscbios", fastscbios);
+  if(detectLayout)
+    myDisplayFormat = entry.layout == FrameLayout::pal ? "PAL" : "NTSC";
+  if(detectYStart)
+    myAutodetectedYstart = entry.ystart - YSTART_EXTRA;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -372,7 +376,7 @@ void Console::toggleColorLoss()
   if(myTIA->enableColorLoss(colorloss))
   {
     myOSystem.settings().setValue(
-      myOSystem.settings().getBool("dev.settings") ? "dev.colorloss" : "plr.colorloss", colorloss);
+      myOSystem.settings().activeId(Settings::PlrColorLoss), colorloss);
 
     string message = string("PAL color-loss ") +
                      (colorloss ? "enabled" : "disabled");
@@ -531,7 +535,6 @@ FBInitStatus Console::initializeVideo(bool full)
 
   if(full)
   {
-    bool devSettings = myOSystem.settings().getBool("dev.settings");
     const string& title = string("Stella ") + STELLA_VERSION +
                    ": \"" + myProperties.get(Cartridge_Name) + "\"";
     fbstatus = myOSystem.frameBuffer().createDisplay(title,
@@ -540,16 +543,16 @@ FBInitStatus Console::initializeVideo(bool full)
       return fbstatus;
 
     myOSystem.frameBuffer().showFrameStats(
-      myOSystem.settings().getBool(devSettings ? "dev.stats" : "plr.stats"));
+      myOSystem.settings().getBool(myOSystem.settings().activeId(Settings::PlrStats)));
     generateColorLossPalette();
   }
-  setPalette(myOSystem.settings().getString("palette"));
+  setPalette(myOSystem.settings().getString(Settings::Palette));
 
   // Set the correct framerate based on the format of the ROM
   // This can be overridden by changing the framerate in the
   // VideoDialog box or on the commandline, but it can't be saved
   // (ie, framerate is now determined based on number of scanlines).
-  int framerate = myOSystem.settings().getInt("framerate");
+  int framerate = myOSystem.settings().getInt(Settings::FrameRate);
   if(framerate > 0) myFramerate = float(framerate);
   myOSystem.setFramerate(myFramerate);
 
@@ -565,7 +568,7 @@ void Console::initializeAudio()
   // Initialize the sound interface.
   // The # of channels can be overridden in the AudioDialog box or on
   // the commandline, but it can't be saved.
-  int framerate = myOSystem.settings().getInt("framerate");
+  int framerate = myOSystem.settings().getInt(Settings::FrameRate);
   if(framerate > 0) myFramerate = float(framerate);
   const string& sound = myProperties.get(Cartridge_Sound);
 
@@ -806,6 +809,7 @@ unique_ptr<Controller> Console::getControllerPort(const string& rommd5,
     else if(controllerName == "PADDLES_IAXDR")
       swapAxis = swapDir = true;
     controller = make_unique<Paddles>(port, myEvent, *mySystem,
+                                      myOSystem.settings(),
                                       swapPaddles, swapAxis, swapDir);
   }
   else if(controllerName == "AMIGAMOUSE")
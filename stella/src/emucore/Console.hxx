@@ -310,14 +310,10 @@ class Console : public Serializable
 
   private:
     /**
-     * Dry-run the emulation and detect the frame layout (PAL / NTSC).
+     * Dry-run the emulation and detect the frame layout (PAL / NTSC) and/or
+     * ystart (the first visible scanline), or take them from the cache.
      */
-    void autodetectFrameLayout();
-
-    /**
-     * Dryrun the emulation and detect ystart (the first visible scanline).
-     */
-    void autodetectYStart();
+    void autodetectDisplay(bool detectLayout, bool detectYStart);
 
     /**
       Sets various properties of the TIA (YStart, Height, etc) based on
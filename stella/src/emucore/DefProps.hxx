@@ -3346,4 +3346,442 @@ static const char* const DefProps[DEF_PROPS_SIZE][21] = {
   { "ffebb0070689b9d322687edd9c0a2bae", "", "", "Spitfire Attack (1983) (Milton Bradley) [h1]", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" }
 };
 
+// Perfect hash of the md5sums; see PropertiesSet::findDefault()
+#define DEF_PROPS_BUCKET_BITS 10
+#define DEF_PROPS_SLOT_BITS 12
+
+static const uInt16 DefPropsDisplace[1 << DEF_PROPS_BUCKET_BITS] = {
+  0, 0, 3, 0, 14, 3, 5, 8, 3, 5, 2, 0,
+  2, 2, 1, 0, 2, 0, 5, 5, 3, 4, 0, 0,
+  3, 2, 7, 55, 1, 3, 2, 6, 3, 1, 1, 0,
+  8, 2, 6, 2, 1, 0, 2, 2, 4, 0, 1, 4,
+  6, 5, 0, 3, 0, 35, 16, 2, 0, 0, 0, 0,
+  0, 14, 1, 8, 0, 2, 16, 6, 1, 2, 0, 0,
+  6, 4, 0, 0, 0, 1, 21, 2, 0, 0, 5, 2,
+  9, 2, 0, 1, 1, 1, 0, 2, 7, 4, 1, 7,
+  11, 2, 5, 12, 11, 8, 0, 4, 5, 11, 23, 3,
+  2, 0, 15, 0, 9, 10, 1, 0, 2, 2, 9, 15,
+  4, 0, 2, 4, 42, 7, 4, 7, 3, 9, 18, 5,
+  10, 8, 6, 0, 25, 14, 2, 6, 0, 6, 3, 1,
+  0, 13, 1, 7, 6, 0, 0, 8, 4, 0, 6, 1,
+  2, 4, 0, 3, 1, 12, 2, 2, 6, 3, 6, 11,
+  5, 7, 2, 30, 2, 13, 0, 6, 15, 8, 0, 4,
+  7, 3, 16, 5, 0, 0, 2, 0, 6, 4, 13, 1,
+  1, 0, 7, 0, 0, 0, 1, 36, 0, 3, 0, 2,
+  8, 16, 0, 1, 0, 30, 0, 5, 5, 6, 0, 23,
+  0, 3, 18, 1, 9, 9, 0, 2, 0, 5, 2, 1,
+  11, 1, 6, 0, 0, 29, 1, 5, 2, 0, 0, 0,
+  34, 7, 26, 3, 0, 0, 0, 0, 0, 17, 14, 2,
+  8, 60, 15, 1, 7, 9, 13, 2, 11, 3, 22, 6,
+  0, 24, 0, 0, 4, 7, 1, 0, 2, 20, 8, 3,
+  1, 7, 5, 1, 0, 30, 14, 0, 6, 19, 1, 4,
+  12, 1, 1, 2, 5, 7, 2, 4, 0, 0, 0, 40,
+  0, 1, 58, 21, 5, 0, 0, 7, 11, 8, 14, 3,
+  1, 1, 10, 0, 9, 5, 5, 1, 3, 6, 0, 0,
+  8, 18, 12, 5, 22, 7, 3, 4, 6, 2, 7, 0,
+  27, 0, 0, 2, 8, 18, 6, 14, 4, 0, 44, 4,
+  6, 5, 1, 21, 9, 43, 0, 11, 0, 0, 5, 2,
+  4, 0, 3, 21, 11, 1, 39, 0, 5, 3, 0, 37,
+  3, 15, 1, 2, 0, 1, 4, 1, 1, 9, 11, 0,
+  18, 1, 2, 4, 16, 1, 1, 0, 4, 0, 3, 0,
+  0, 7, 0, 4, 28, 0, 0, 4, 0, 1, 4, 7,
+  3, 0, 6, 5, 56, 1, 14, 11, 6, 1, 2, 0,
+  0, 6, 3, 10, 2, 12, 1, 1, 19, 0, 0, 1,
+  12, 0, 1, 1, 4, 5, 1, 2, 0, 49, 0, 11,
+  0, 15, 6, 39, 1, 0, 2, 15, 8, 2, 5, 13,
+  0, 34, 16, 3, 1, 3, 4, 12, 0, 1, 7, 5,
+  1, 0, 2, 0, 1, 6, 15, 7, 0, 3, 1, 3,
+  43, 34, 3, 52, 1, 20, 10, 20, 9, 1, 1, 0,
+  1, 4, 3, 36, 0, 11, 3, 6, 6, 15, 2, 45,
+  0, 28, 7, 3, 13, 3, 0, 0, 10, 4, 1, 12,
+  7, 0, 2, 1, 1, 0, 0, 12, 2, 13, 1, 22,
+  43, 41, 7, 0, 16, 0, 0, 1, 4, 2, 11, 20,
+  2, 1, 0, 39, 5, 0, 0, 1, 7, 1, 8, 2,
+  0, 0, 19, 12, 17, 2, 1, 0, 0, 26, 1, 3,
+  8, 2, 0, 1, 1, 16, 4, 13, 55, 0, 7, 0,
+  4, 12, 24, 51, 8, 7, 0, 2, 1, 2, 3, 0,
+  46, 23, 7, 16, 4, 9, 10, 1, 0, 2, 2, 0,
+  0, 2, 20, 4, 4, 0, 0, 3, 14, 11, 9, 4,
+  14, 1, 7, 0, 3, 29, 13, 20, 0, 8, 5, 14,
+  22, 0, 0, 5, 1, 1, 2, 4, 6, 0, 31, 22,
+  7, 4, 1, 0, 36, 1, 2, 17, 34, 31, 41, 29,
+  0, 0, 0, 14, 2, 1, 29, 4, 40, 1, 16, 48,
+  4, 10, 5, 0, 6, 46, 14, 5, 5, 16, 9, 0,
+  0, 20, 5, 0, 2, 1, 0, 1, 10, 4, 1, 14,
+  1, 4, 5, 1, 8, 8, 5, 3, 4, 2, 0, 1,
+  0, 5, 0, 12, 1, 0, 8, 1, 7, 1, 39, 4,
+  8, 4, 1, 36, 13, 0, 10, 0, 6, 0, 4, 58,
+  47, 21, 8, 5, 21, 12, 0, 1, 23, 0, 7, 26,
+  2, 3, 8, 2, 4, 25, 34, 6, 10, 2, 6, 5,
+  7, 41, 27, 7, 6, 4, 6, 10, 9, 3, 24, 0,
+  5, 1, 0, 1, 14, 1, 1, 8, 7, 0, 0, 1,
+  56, 5, 4, 34, 1, 11, 29, 12, 5, 6, 25, 6,
+  21, 18, 17, 0, 5, 0, 8, 0, 0, 29, 8, 3,
+  12, 31, 32, 27, 3, 0, 3, 27, 41, 0, 0, 9,
+  2, 28, 0, 9, 30, 11, 52, 22, 0, 20, 0, 2,
+  36, 7, 2, 69, 0, 7, 70, 11, 13, 2, 8, 17,
+  32, 3, 78, 22, 79, 7, 7, 17, 19, 19, 4, 14,
+  18, 0, 1, 9, 1, 2, 7, 1, 3, 13, 3, 20,
+  1, 6, 0, 11, 2, 4, 22, 23, 29, 52, 3, 17,
+  4, 30, 0, 3, 19, 16, 19, 0, 1, 2, 21, 1,
+  3, 4, 15, 67, 29, 1, 9, 4, 0, 0, 20, 1,
+  5, 6, 5, 2, 23, 2, 0, 0, 0, 7, 39, 2,
+  4, 22, 8, 7, 2, 3, 51, 45, 50, 3, 0, 1,
+  0, 28, 20, 5, 2, 4, 6, 77, 9, 20, 87, 38,
+  1, 22, 0, 0, 0, 47, 10, 11, 16, 7, 2, 3,
+  46, 3, 6, 37, 58, 6, 0, 1, 4, 8, 14, 26,
+  5, 44, 2, 5, 11, 0, 15, 45, 2, 0, 16, 6,
+  21, 0, 15, 1, 67, 113, 4, 0, 30, 0, 49, 2,
+  76, 74, 42, 54, 11, 2, 13, 13, 36, 13, 16, 22,
+  13, 2, 12, 0, 0, 0, 29, 3, 3, 57, 24, 13,
+  0, 109, 5, 4, 8, 13, 7, 6, 33, 38, 3, 33,
+  11, 11, 20, 2, 21, 79, 3, 17, 0, 3, 1, 68,
+  0, 68, 4, 25
+};
+
+static const uInt16 DefPropsSlots[1 << DEF_PROPS_SLOT_BITS] = {
+  1741, 65535, 1262, 2283, 3057, 65535, 2699, 65535, 65535, 175, 3040, 2350,
+  1403, 65535, 572, 112, 1575, 2367, 2194, 65535, 1415, 3063, 598, 65535,
+  2205, 2881, 1558, 3215, 3074, 1954, 879, 848, 65535, 65535, 1984, 2683,
+  1407, 2019, 2616, 858, 2049, 26, 2894, 805, 912, 1169, 354, 3302,
+  330, 2078, 2576, 1643, 1371, 65535, 494, 2620, 1878, 1456, 2086, 1721,
+  107, 659, 2135, 3194, 1366, 65535, 65535, 1800, 1136, 3095, 768, 2081,
+  2985, 1710, 65535, 984, 2316, 65535, 176, 65535, 1497, 65535, 762, 2967,
+  65535, 62, 1221, 1121, 1092, 1871, 1895, 2470, 2374, 635, 3249, 2101,
+  1174, 3004, 3077, 2648, 1012, 2479, 1153, 2195, 646, 678, 2402, 12,
+  3133, 1781, 2442, 640, 2689, 65535, 1572, 1382, 3291, 65535, 1346, 65535,
+  2937, 1897, 1948, 627, 2238, 2017, 1863, 2589, 2219, 1743, 2454, 1990,
+  1745, 2766, 1107, 65535, 3197, 559, 65535, 1691, 811, 2628, 8, 1518,
+  1865, 2830, 3072, 754, 1410, 65535, 65535, 1656, 558, 273, 65535, 1493,
+  65535, 747, 1171, 637, 3121, 1891, 1735, 1368, 65535, 1538, 22, 65535,
+  2321, 1715, 2940, 3134, 1649, 1582, 520, 65535, 65535, 2797, 65535, 1058,
+  65535, 65535, 338, 162, 2117, 2981, 3234, 2505, 1773, 65535, 913, 2553,
+  556, 324, 3313, 1150, 2608, 65535, 65535, 2863, 2177, 2245, 1391, 2221,
+  261, 385, 2131, 125, 2575, 1050, 1469, 501, 430, 862, 934, 1044,
+  2039, 893, 65535, 2379, 2556, 1030, 2825, 65535, 423, 1265, 3180, 444,
+  1168, 1157, 3239, 65535, 65535, 65535, 170, 2598, 1420, 3123, 2973, 3151,
+  803, 581, 1421, 983, 1225, 1950, 3036, 2474, 1500, 675, 3093, 1612,
+  392, 1011, 2685, 65535, 2883, 375, 65535, 1126, 531, 3181, 2034, 65535,
+  51, 1237, 65535, 457, 2590, 3231, 102, 6, 901, 94, 2329, 65535,
+  3205, 663, 524, 2233, 577, 2652, 65535, 65535, 65535, 1324, 65535, 63,
+  802, 9, 65535, 2916, 65535, 65535, 2909, 1615, 1037, 417, 1331, 1065,
+  2244, 1805, 2901, 2010, 908, 244, 1527, 65535, 2465, 2103, 65535, 2376,
+  65535, 2240, 65535, 1069, 1228, 1639, 2494, 65535, 582, 65535, 2414, 2531,
+  904, 1964, 3010, 1289, 2517, 1768, 1617, 311, 575, 1818, 1203, 2371,
+  322, 65535, 1293, 529, 2938, 917, 1501, 65535, 65535, 279, 2069, 909,
+  480, 2677, 65535, 1850, 1487, 1876, 2140, 1521, 785, 2820, 1462, 1893,
+  3173, 2156, 65535, 378, 1001, 379, 65535, 1749, 804, 1692, 1147, 2399,
+  2439, 205, 1670, 2858, 3043, 2305, 1020, 332, 224, 65535, 65535, 1486,
+  65535, 65535, 65535, 1898, 65535, 2721, 196, 202, 1056, 1116, 296, 789,
+  2960, 824, 65535, 1892, 3262, 1188, 1736, 3250, 963, 2957, 2580, 565,
+  907, 1264, 1170, 808, 472, 1432, 310, 2157, 3246, 165, 1156, 3146,
+  1761, 19, 65535, 1184, 65535, 2682, 990, 753, 2320, 65535, 65535, 65535,
+  65535, 361, 65535, 65535, 281, 2841, 2215, 740, 1889, 65535, 43, 2290,
+  3284, 959, 2808, 65535, 522, 1507, 797, 1139, 1508, 2557, 65535, 65535,
+  3282, 2665, 2634, 3105, 1094, 2719, 1084, 65535, 2279, 65535, 1629, 65535,
+  2996, 2022, 1332, 2743, 65535, 560, 2549, 65535, 65535, 976, 65535, 268,
+  576, 814, 65535, 1610, 898, 1253, 3096, 65535, 101, 2303, 1321, 1599,
+  3145, 65535, 3052, 65535, 2972, 1145, 1430, 1631, 65535, 554, 334, 2174,
+  65535, 2020, 1485, 65535, 65535, 2958, 65535, 790, 65535, 3109, 1272, 153,
+  801, 1856, 2082, 1015, 65535, 65535, 2570, 65535, 3171, 65535, 886, 1269,
+  700, 2005, 117, 3226, 1384, 65535, 2890, 525, 491, 65535, 65535, 1299,
+  2604, 510, 1367, 2896, 1142, 71, 1000, 3064, 2633, 1759, 905, 65535,
+  425, 668, 1587, 775, 2834, 1973, 65535, 65535, 2401, 2745, 1757, 1047,
+  698, 1216, 1764, 651, 156, 1268, 65535, 2464, 902, 2763, 2412, 99,
+  3056, 348, 2148, 2351, 3164, 0, 2003, 1341, 1719, 286, 2788, 2192,
+  2631, 2776, 2289, 1952, 1817, 2403, 2314, 2437, 2053, 65535, 65535, 2424,
+  930, 2362, 2200, 65535, 2300, 127, 2504, 3130, 3311, 1411, 2396, 3297,
+  1775, 65535, 1114, 1619, 65535, 2712, 1600, 1509, 1298, 87, 240, 517,
+  708, 65535, 65535, 2491, 1961, 2067, 1540, 2340, 1943, 1983, 2381, 1079,
+  2489, 674, 65535, 625, 2258, 641, 3209, 239, 1522, 1758, 2810, 2077,
+  398, 65535, 2675, 1335, 1779, 1559, 1787, 1040, 64, 65535, 65535, 495,
+  1926, 323, 986, 1201, 65535, 185, 1301, 77, 998, 938, 1835, 1276,
+  859, 2284, 1127, 2031, 687, 65535, 424, 427, 2746, 2423, 547, 1792,
+  2994, 844, 65535, 1177, 2905, 65535, 2407, 3241, 1438, 1676, 65535, 65535,
+  2709, 65535, 1708, 3120, 2201, 2804, 1550, 1051, 1019, 1453, 2132, 1398,
+  65535, 2083, 1823, 2660, 731, 1935, 2334, 383, 2514, 3268, 2959, 1581,
+  91, 991, 2445, 65535, 2011, 1131, 971, 2036, 65535, 2577, 1059, 1809,
+  2907, 249, 1739, 1222, 2409, 3011, 2311, 3305, 65535, 2860, 2024, 2217,
+  1355, 179, 1106, 2976, 321, 1173, 291, 65535, 1839, 98, 2436, 981,
+  2179, 180, 2506, 3029, 65535, 1089, 456, 603, 2534, 65535, 1986, 1569,
+  1409, 2023, 2469, 1946, 1210, 3039, 1240, 454, 884, 349, 1627, 154,
+  561, 2876, 2386, 65535, 220, 65535, 958, 1857, 292, 109, 3070, 2159,
+  65535, 523, 1208, 103, 994, 1584, 65535, 1133, 65535, 65535, 3177, 1922,
+  1529, 665, 1931, 1767, 1046, 65535, 777, 1867, 1416, 813, 2035, 479,
+  2324, 1513, 3069, 65535, 3037, 1338, 1557, 1096, 259, 1463, 3017, 65535,
+  3122, 1491, 3258, 2989, 65535, 46, 215, 526, 2203, 3208, 2310, 65535,
+  2384, 65535, 2831, 2828, 1294, 2939, 833, 1978, 1727, 2771, 65535, 1471,
+  2029, 2848, 416, 701, 1454, 2779, 2146, 65535, 1930, 297, 563, 1459,
+  1965, 815, 1103, 2730, 623, 65535, 533, 3159, 65535, 166, 65535, 615,
+  65535, 65535, 543, 211, 3176, 65535, 3248, 667, 1987, 1161, 1183, 1847,
+  504, 65535, 65535, 446, 212, 798, 1465, 944, 327, 1949, 1267, 2214,
+  1045, 143, 1242, 1972, 2089, 65535, 65535, 830, 65535, 253, 60, 1762,
+  65535, 2107, 1765, 2672, 376, 2533, 1998, 65535, 1646, 3155, 911, 2420,
+  841, 326, 1957, 70, 65535, 2737, 409, 1528, 1419, 301, 2091, 2295,
+  435, 2561, 2945, 65535, 1246, 65535, 65535, 1618, 3124, 216, 2250, 1747,
+  1782, 65535, 2030, 2625, 2471, 1896, 403, 1234, 2734, 2466, 2105, 3255,
+  65535, 308, 1209, 546, 1786, 1152, 770, 3125, 2496, 2028, 2285, 3075,
+  65535, 2385, 2875, 1890, 1123, 1902, 3090, 65535, 65535, 194, 2059, 937,
+  20, 3065, 1628, 591, 719, 1556, 1473, 1603, 2974, 2297, 65535, 1375,
+  2586, 3067, 2656, 65535, 3283, 1859, 728, 2888, 2711, 499, 2286, 2099,
+  1189, 2369, 1517, 65535, 807, 2644, 1356, 146, 65535, 2535, 1154, 467,
+  1102, 1414, 1023, 992, 3172, 2520, 569, 3199, 1716, 436, 2075, 65535,
+  65535, 2434, 65535, 65535, 1534, 65535, 343, 65535, 2202, 3245, 979, 155,
+  3296, 229, 65535, 3061, 1840, 65535, 763, 350, 65535, 1653, 228, 1535,
+  826, 65535, 2000, 2331, 65535, 65535, 1827, 3033, 2449, 1334, 2948, 2415,
+  2087, 1243, 748, 3143, 3168, 2076, 2839, 1671, 3221, 3224, 660, 3260,
+  65535, 453, 1247, 3157, 989, 2618, 935, 2900, 1135, 2857, 2582, 65535,
+  2150, 2965, 2167, 1837, 65535, 2829, 1680, 3001, 2596, 65535, 65535, 2090,
+  65535, 65535, 68, 1933, 2118, 1886, 65535, 2752, 2544, 368, 2206, 65535,
+  2624, 408, 2930, 2061, 3307, 1379, 2511, 119, 496, 270, 541, 3233,
+  389, 306, 3021, 1461, 2661, 1911, 2837, 65535, 1981, 2111, 474, 3186,
+  1320, 65535, 65535, 492, 3138, 2882, 584, 65535, 201, 65535, 2780, 1111,
+  2591, 2422, 658, 1753, 2133, 1801, 65535, 234, 278, 1705, 2889, 1763,
+  100, 65535, 596, 1861, 2359, 65535, 65535, 1544, 92, 2158, 3264, 1702,
+  120, 65535, 1714, 448, 895, 2717, 3182, 1784, 1342, 1440, 65535, 2136,
+  1078, 852, 3160, 243, 1552, 2555, 2614, 2773, 65535, 776, 65535, 2728,
+  578, 1609, 65535, 2521, 1360, 410, 203, 65535, 122, 1620, 65535, 683,
+  1060, 2114, 836, 44, 65535, 1884, 1995, 1224, 2416, 1729, 1740, 1838,
+  1684, 271, 3045, 2040, 2880, 2207, 3126, 2621, 232, 1593, 1520, 727,
+  1172, 605, 65535, 65535, 1351, 3237, 2172, 65535, 358, 80, 1455, 65535,
+  1504, 2706, 2674, 910, 527, 1849, 17, 65535, 3229, 967, 86, 2012,
+  2639, 65535, 397, 65535, 1621, 65535, 568, 78, 3193, 1667, 2255, 3089,
+  65535, 760, 65535, 608, 65535, 2456, 65535, 337, 1113, 344, 65535, 3118,
+  96, 1675, 2885, 429, 65535, 1119, 2239, 1971, 58, 65535, 65535, 1449,
+  2659, 65535, 1640, 65535, 2884, 391, 2666, 1448, 1537, 2922, 634, 2270,
+  1637, 2783, 65535, 2536, 65535, 1674, 3236, 123, 743, 1036, 171, 1623,
+  2428, 1756, 300, 521, 1236, 920, 316, 340, 65535, 65535, 65535, 1494,
+  2740, 914, 95, 1238, 65535, 65535, 3147, 25, 972, 65535, 1052, 1158,
+  65535, 65535, 82, 1009, 39, 2569, 65535, 65535, 1251, 49, 65535, 2933,
+  1034, 1515, 647, 2074, 3178, 1413, 65535, 65535, 2574, 2526, 2532, 1358,
+  1233, 65535, 65535, 2009, 2444, 1633, 2197, 65535, 1302, 2497, 1122, 2378,
+  455, 3310, 1470, 419, 636, 65535, 65535, 2651, 497, 407, 1709, 111,
+  742, 65535, 65535, 1947, 65535, 2670, 2792, 3298, 1679, 65535, 1205, 1934,
+  352, 2404, 2983, 65535, 2098, 2309, 534, 65535, 2583, 1802, 2043, 629,
+  1295, 1175, 1344, 2785, 65535, 538, 11, 315, 721, 65535, 3175, 1303,
+  65535, 645, 2085, 3230, 1038, 2813, 65535, 2, 1616, 1279, 65535, 133,
+  65535, 65535, 3213, 2690, 2455, 3023, 817, 927, 924, 65535, 783, 622,
+  1561, 2354, 65535, 1577, 65535, 2438, 1636, 2257, 65535, 781, 735, 1063,
+  2530, 3188, 1014, 65535, 1082, 1737, 3139, 752, 1353, 1881, 65535, 1595,
+  676, 65535, 65535, 532, 1738, 199, 587, 248, 258, 1919, 65535, 2440,
+  1108, 2481, 1932, 1220, 2462, 65535, 949, 606, 3306, 2501, 1652, 3295,
+  1726, 950, 1129, 1608, 1854, 2070, 1938, 2141, 2397, 2507, 1662, 209,
+  1039, 172, 940, 2714, 1723, 263, 65535, 396, 2979, 183, 65535, 2696,
+  689, 2307, 65535, 1536, 3263, 2911, 2606, 2447, 537, 2410, 3100, 2663,
+  3142, 3267, 2915, 38, 65535, 65535, 1495, 1924, 65535, 65535, 149, 3026,
+  2997, 1347, 2772, 3019, 3018, 580, 65535, 393, 1263, 65535, 2718, 65535,
+  2899, 1032, 508, 2822, 65535, 13, 65535, 65535, 45, 65535, 2790, 2047,
+  1654, 65535, 2701, 2162, 65535, 65535, 65535, 2272, 189, 925, 2467, 65535,
+  1291, 2622, 574, 1717, 2093, 265, 570, 230, 725, 1681, 2391, 2154,
+  432, 65535, 2729, 1571, 2844, 2097, 2050, 772, 142, 2603, 65535, 3261,
+  72, 1363, 1718, 65535, 2735, 1143, 2784, 2724, 649, 2293, 3015, 1350,
+  29, 1400, 2887, 2126, 65535, 871, 1524, 2477, 2041, 65535, 919, 837,
+  65535, 1506, 2169, 2870, 3008, 187, 3281, 65535, 600, 65535, 2509, 599,
+  1601, 1435, 3048, 2498, 1994, 1555, 861, 734, 65535, 2170, 1815, 65535,
+  1066, 730, 2432, 2906, 65535, 1042, 458, 877, 65535, 65535, 3088, 276,
+  662, 2060, 2021, 65535, 1309, 1944, 2016, 251, 821, 2345, 65535, 1481,
+  177, 1271, 1713, 2259, 65535, 65535, 1808, 766, 484, 1780, 65535, 404,
+  274, 819, 2946, 812, 2299, 1192, 65535, 1427, 65535, 1589, 2748, 1018,
+  656, 1516, 65535, 65535, 1213, 65535, 2198, 2543, 3202, 2513, 3161, 1579,
+  1798, 214, 875, 921, 412, 1290, 1825, 1006, 1408, 681, 65535, 1452,
+  65535, 65535, 2853, 65535, 65535, 1846, 1199, 65535, 2673, 793, 1551, 2698,
+  356, 282, 2742, 1417, 1383, 2642, 65535, 2224, 3115, 65535, 2173, 65535,
+  2073, 1974, 1025, 1642, 2697, 1404, 706, 2567, 2927, 69, 1909, 2234,
+  664, 65535, 65535, 616, 65535, 287, 3104, 65535, 299, 1925, 1910, 2823,
+  2609, 52, 648, 3044, 2872, 65535, 638, 159, 1828, 1523, 65535, 36,
+  846, 1526, 892, 65535, 130, 2237, 2032, 1380, 1880, 2990, 1920, 65535,
+  65535, 1337, 65535, 65535, 3129, 108, 2778, 65535, 1594, 2426, 505, 65535,
+  1921, 2487, 65535, 254, 2893, 3073, 1842, 2343, 65535, 2962, 2291, 2318,
+  2750, 65535, 2684, 313, 2365, 2352, 134, 1061, 50, 2578, 65535, 602,
+  1543, 840, 1772, 1311, 1626, 1217, 3152, 931, 703, 2315, 2430, 696,
+  2898, 2680, 1273, 200, 365, 65535, 289, 83, 2249, 2592, 1795, 1433,
+  65535, 1035, 1071, 1658, 1002, 2375, 380, 56, 65535, 2002, 1829, 1655,
+  1963, 1666, 65535, 65535, 2949, 2128, 1088, 2235, 65535, 426, 3003, 2607,
+  618, 639, 2006, 65535, 1024, 367, 65535, 966, 65535, 778, 1816, 1976,
+  2878, 2199, 2395, 550, 3050, 47, 3269, 2869, 2654, 1315, 2119, 218,
+  65535, 1503, 65535, 369, 2966, 2914, 1733, 65535, 3038, 566, 545, 1541,
+  1604, 217, 1746, 3005, 210, 3220, 1512, 1115, 247, 1975, 106, 2854,
+  2313, 3235, 3094, 3131, 1049, 65535, 878, 1953, 2904, 1813, 2895, 1029,
+  438, 65535, 1316, 2798, 2657, 2816, 2112, 65535, 1482, 65535, 428, 65535,
+  2658, 1791, 2524, 2182, 65535, 7, 65535, 2629, 2978, 2707, 65535, 2519,
+  178, 329, 1752, 2720, 65535, 729, 1783, 65535, 2923, 65535, 1833, 3117,
+  2123, 1673, 1041, 1760, 161, 372, 1638, 757, 163, 65535, 2054, 1249,
+  831, 1193, 1539, 2337, 377, 65535, 1993, 65535, 1451, 1081, 463, 478,
+  2282, 1659, 613, 512, 65535, 1668, 65535, 65535, 2686, 65535, 31, 65535,
+  2626, 40, 1352, 2796, 65535, 2382, 661, 65535, 2292, 1191, 328, 1870,
+  65535, 65535, 2643, 3128, 65535, 2527, 2731, 65535, 2052, 65535, 1138, 65535,
+  345, 918, 65535, 2952, 688, 2427, 2551, 65535, 331, 126, 1098, 65535,
+  1021, 1489, 55, 864, 65535, 2116, 277, 671, 65535, 2627, 1941, 1913,
+  2500, 3198, 264, 1211, 1797, 604, 3271, 2692, 65535, 2802, 65535, 65535,
+  513, 2419, 2327, 1027, 65535, 2637, 573, 2226, 3179, 2516, 2433, 1706,
+  65535, 2579, 65535, 160, 2681, 1227, 682, 2155, 476, 246, 65535, 1663,
+  2528, 1322, 589, 597, 654, 2649, 2980, 65535, 2247, 2312, 1109, 3276,
+  3009, 65535, 936, 2102, 473, 1270, 1328, 1900, 2223, 1478, 2812, 3244,
+  30, 136, 3087, 2585, 2855, 2057, 2176, 65535, 1110, 3207, 2545, 65535,
+  18, 490, 65535, 3225, 2275, 65535, 1307, 14, 294, 1274, 65535, 65535,
+  3042, 2294, 65535, 65535, 1336, 617, 2826, 3098, 2418, 65535, 2612, 2921,
+  1339, 874, 1836, 1202, 3227, 65535, 2242, 2908, 3111, 1574, 471, 3034,
+  2910, 73, 2278, 65535, 65535, 65535, 1446, 3294, 1423, 2071, 451, 1064,
+  366, 2817, 724, 697, 1053, 2744, 3150, 2865, 1223, 1005, 3292, 1661,
+  65535, 2144, 2756, 2330, 65535, 65535, 475, 1542, 2339, 65535, 2794, 2800,
+  1578, 2818, 2510, 2862, 405, 2970, 2180, 481, 353, 65535, 2390, 275,
+  116, 65535, 65535, 65535, 3304, 1588, 65535, 1887, 65535, 3149, 237, 685,
+  65535, 3288, 973, 1982, 2014, 390, 65535, 1687, 1894, 65535, 65535, 2056,
+  65535, 2392, 2572, 65535, 65535, 592, 2540, 1296, 34, 65535, 1929, 2806,
+  2919, 539, 2372, 2761, 2304, 1888, 65535, 3270, 1755, 1731, 221, 169,
+  1956, 2066, 2867, 1195, 2715, 1988, 1647, 150, 2088, 733, 65535, 3002,
+  839, 1219, 2398, 219, 2153, 2920, 2647, 2151, 2668, 1698, 65535, 3046,
+  3259, 1732, 3189, 65535, 498, 1724, 769, 2335, 1447, 2705, 2502, 2033,
+  65535, 2288, 630, 885, 65535, 2565, 1694, 1313, 709, 832, 3158, 3076,
+  65535, 1426, 1766, 65535, 2160, 1218, 3092, 65535, 462, 3144, 65535, 899,
+  1072, 838, 1908, 158, 1349, 470, 65535, 65535, 65535, 2276, 2482, 642,
+  65535, 137, 2542, 2188, 65535, 1441, 65535, 2120, 1794, 1182, 1364, 1282,
+  1598, 1985, 1317, 1087, 1405, 2008, 1148, 2518, 3086, 406, 1373, 714,
+  65535, 3218, 3187, 65535, 5, 65535, 3079, 896, 272, 65535, 2228, 1207,
+  1310, 1396, 65535, 3192, 2147, 3053, 2693, 1696, 65535, 716, 853, 2451,
+  1622, 707, 2344, 3141, 213, 65535, 672, 65535, 65535, 942, 2702, 222,
+  957, 506, 2723, 1566, 65535, 2115, 65535, 65535, 2068, 1915, 2393, 2694,
+  65535, 1576, 1374, 15, 764, 2495, 1424, 1977, 2832, 1186, 167, 2431,
+  3242, 304, 3290, 3113, 1230, 806, 1, 1067, 346, 3097, 65535, 443,
+  890, 1120, 65535, 607, 2368, 439, 2741, 3222, 3014, 1357, 1730, 2655,
+  632, 856, 982, 1490, 1365, 1048, 3091, 3272, 2287, 65535, 2220, 132,
+  65535, 144, 850, 1483, 355, 65535, 579, 485, 1532, 1312, 755, 2929,
+  3211, 65535, 3078, 65535, 65535, 2587, 65535, 2995, 1232, 1695, 2342, 916,
+  65535, 65535, 65535, 2264, 2406, 2984, 65535, 1248, 2260, 2725, 2944, 2001,
+  1425, 1132, 2934, 3024, 65, 65535, 1635, 65535, 1318, 65535, 792, 1845,
+  65535, 241, 65535, 3309, 2936, 65535, 2678, 1951, 314, 652, 65535, 1080,
+  2710, 1677, 2971, 2488, 65535, 65535, 191, 609, 2380, 993, 2564, 1280,
+  307, 2931, 1369, 1980, 65535, 891, 1437, 1826, 744, 285, 225, 2443,
+  1277, 1744, 65535, 666, 2130, 65535, 2964, 3020, 65535, 3232, 113, 2669,
+  2795, 3162, 2411, 2387, 65535, 65535, 1255, 295, 65535, 65535, 692, 823,
+  284, 1378, 2775, 1644, 657, 238, 2306, 3030, 1703, 2605, 929, 2336,
+  65535, 1467, 65535, 945, 2227, 1905, 65535, 2515, 1124, 857, 3059, 1428,
+  3058, 309, 2273, 686, 65535, 1475, 65535, 2348, 32, 65535, 585, 65535,
+  1499, 670, 530, 65535, 65535, 2405, 1606, 65535, 65535, 1488, 493, 65535,
+  65535, 1939, 780, 1235, 741, 1164, 3114, 2266, 1937, 883, 65535, 65535,
+  257, 65535, 2998, 65535, 1314, 2490, 2216, 1821, 3293, 3301, 3191, 2539,
+  1281, 2492, 3007, 710, 612, 863, 1204, 2193, 1748, 1146, 1397, 894,
+  2600, 65535, 65535, 65535, 1090, 2594, 319, 65535, 89, 1554, 65535, 2902,
+  1226, 1519, 1492, 519, 2912, 3028, 939, 3166, 583, 3055, 2571, 3277,
+  318, 822, 65535, 624, 2610, 1112, 2859, 2212, 1563, 3312, 2388, 65535,
+  65535, 65535, 2065, 2058, 969, 711, 65535, 3148, 65535, 2175, 1464, 3165,
+  2268, 1591, 3051, 1445, 968, 65535, 65535, 65535, 1231, 2417, 2546, 825,
+  854, 1275, 2037, 1583, 2095, 1394, 65535, 2346, 2653, 1016, 65535, 507,
+  65535, 1197, 964, 1252, 2092, 65535, 1165, 1505, 2046, 65535, 509, 2281,
+  1807, 477, 65535, 1393, 795, 1625, 702, 65535, 2824, 1278, 1834, 65535,
+  2573, 1190, 827, 1613, 65535, 260, 2541, 1546, 65535, 3299, 2503, 2248,
+  518, 2121, 1259, 1239, 2868, 1693, 1431, 3280, 65535, 1390, 1288, 745,
+  965, 1855, 2508, 1564, 1372, 1141, 906, 975, 2522, 2110, 1151, 1979,
+  1912, 207, 915, 65535, 693, 2874, 2463, 65535, 65535, 1596, 3082, 1665,
+  2461, 1770, 65535, 65535, 2645, 1648, 1439, 135, 1062, 3083, 1388, 65535,
+  1450, 1991, 1043, 2988, 610, 381, 2602, 2096, 2722, 2969, 65535, 1882,
+  1389, 65535, 882, 2636, 2113, 65535, 980, 65535, 2400, 3047, 1392, 1330,
+  1634, 1699, 65535, 65535, 540, 351, 336, 3012, 65535, 437, 1917, 2460,
+  441, 2322, 65535, 2124, 347, 1348, 1777, 3167, 1187, 3210, 1630, 1166,
+  562, 1877, 1597, 1261, 1820, 382, 65535, 1996, 65535, 1707, 690, 1641,
+  1742, 3085, 413, 2254, 1611, 325, 1256, 65535, 460, 1479, 3107, 65535,
+  1769, 400, 1460, 2328, 2903, 1607, 722, 2347, 2873, 2429, 2687, 2850,
+  2425, 250, 173, 23, 2478, 3116, 2377, 2547, 387, 65535, 1624, 2550,
+  1476, 782, 33, 1128, 1969, 3016, 65535, 65535, 65535, 3315, 2458, 65535,
+  65535, 1903, 514, 900, 2562, 2840, 1480, 65535, 903, 2483, 65535, 65535,
+  360, 1381, 2584, 182, 2353, 65535, 65535, 3174, 1940, 2484, 1793, 750,
+  65535, 2183, 952, 2635, 2296, 1632, 1013, 65535, 42, 2943, 2013, 1678,
+  1945, 2638, 65535, 317, 961, 2187, 2815, 2338, 2852, 65535, 305, 3303,
+  445, 65535, 962, 2452, 65535, 1650, 2355, 65535, 2168, 2134, 2913, 65535,
+  2191, 774, 1853, 2708, 1824, 2747, 2363, 2145, 145, 3106, 695, 500,
+  339, 394, 65535, 1434, 621, 1689, 65535, 235, 65535, 3196, 65535, 1901,
+  2222, 65535, 24, 2611, 1075, 65535, 371, 1484, 2486, 586, 1458, 2777,
+  1257, 3228, 2632, 1804, 865, 954, 2843, 2588, 364, 27, 1510, 2558,
+  3184, 2774, 1605, 866, 3273, 65535, 141, 684, 715, 384, 67, 1904,
+  1054, 2799, 1241, 3060, 65535, 2662, 65535, 881, 148, 2163, 2274, 2185,
+  65535, 65535, 1831, 1686, 2485, 3049, 2026, 65535, 298, 2991, 3136, 2323,
+  1918, 1077, 35, 440, 2787, 65535, 3140, 65535, 1093, 65535, 174, 65535,
+  65535, 3243, 65535, 1685, 548, 1370, 65535, 800, 65535, 2700, 65535, 860,
+  1712, 65535, 188, 65535, 2108, 3266, 978, 2356, 3238, 1198, 3054, 1502,
+  2042, 557, 1359, 1362, 65535, 2836, 2178, 421, 65535, 3022, 650, 65535,
+  1305, 433, 65535, 1962, 2727, 2851, 1869, 75, 2493, 65535, 1959, 3127,
+  997, 2926, 341, 2764, 65535, 1097, 1958, 1033, 2246, 2138, 290, 974,
+  302, 941, 1810, 65535, 1343, 631, 2457, 999, 65535, 65535, 65535, 486,
+  1960, 761, 1333, 2819, 3031, 787, 2225, 65535, 2472, 746, 450, 2757,
+  2512, 3185, 1664, 2782, 1297, 2256, 65535, 1565, 549, 1916, 1942, 65535,
+  2473, 956, 1406, 3135, 2842, 65535, 2803, 65535, 2601, 1215, 186, 1688,
+  2986, 1181, 1422, 65535, 2267, 2164, 933, 1468, 151, 65535, 1866, 1562,
+  1868, 2004, 65535, 168, 65535, 1553, 1832, 3137, 2261, 3212, 465, 65535,
+  1590, 65535, 2129, 948, 1720, 1545, 65535, 357, 593, 2751, 65535, 65535,
+  1814, 459, 76, 2758, 2349, 65535, 1442, 868, 2759, 2325, 1134, 2251,
+  3287, 1003, 2987, 1928, 1194, 799, 461, 2476, 1436, 1100, 2801, 3,
+  65535, 503, 2641, 2918, 65535, 759, 2231, 2341, 3119, 2619, 1570, 206,
+  669, 1496, 943, 732, 739, 1966, 420, 2166, 828, 1443, 65535, 65535,
+  65535, 1851, 333, 1651, 1329, 1874, 2738, 1214, 65535, 2189, 951, 88,
+  1258, 1843, 65535, 65535, 61, 90, 1466, 65535, 2548, 953, 65535, 1683,
+  1472, 1567, 262, 2333, 3163, 528, 2301, 996, 796, 2941, 65535, 810,
+  65535, 1602, 2838, 737, 280, 65535, 65535, 1402, 65535, 1286, 1212, 65535,
+  2963, 677, 115, 2062, 1530, 65535, 370, 2833, 1200, 717, 2954, 1285,
+  932, 242, 2924, 2982, 2563, 2063, 588, 3081, 2640, 1852, 1923, 65535,
+  65535, 65535, 788, 1091, 1592, 65535, 1010, 2791, 3156, 3223, 65535, 1287,
+  3251, 1872, 4, 2650, 65535, 2389, 1548, 3025, 1004, 65535, 65535, 65535,
+  269, 1848, 65535, 65535, 2789, 1788, 65535, 2499, 995, 65535, 2232, 1074,
+  1008, 2186, 2262, 2767, 65535, 65535, 1385, 233, 231, 2809, 65535, 1125,
+  65535, 536, 1822, 388, 422, 2018, 65535, 2961, 644, 756, 1017, 65535,
+  2038, 415, 2781, 65535, 1095, 3101, 65535, 2326, 2856, 2733, 3066, 3169,
+  1533, 65535, 1429, 1514, 2271, 65535, 1657, 1137, 1361, 1754, 2891, 1573,
+  252, 1806, 65535, 694, 2122, 2204, 3103, 1999, 190, 97, 1118, 342,
+  65535, 1326, 1085, 2269, 855, 699, 65535, 138, 2866, 65535, 10, 2703,
+  1879, 128, 2554, 65535, 2190, 2252, 2210, 312, 2623, 65535, 65535, 1789,
+  2950, 65535, 2100, 977, 2566, 3032, 1308, 1386, 255, 2139, 2617, 1844,
+  511, 79, 2593, 2358, 2835, 466, 65535, 1992, 303, 3068, 1580, 2726,
+  105, 65535, 152, 1180, 713, 2951, 2302, 2181, 1862, 1734, 1070, 3254,
+  2847, 2171, 53, 65535, 718, 849, 2263, 65535, 195, 2704, 845, 65535,
+  1722, 655, 65535, 65535, 2218, 2015, 1250, 65535, 3247, 3000, 633, 118,
+  2196, 65535, 2646, 2755, 65535, 1774, 114, 1997, 2064, 65535, 1283, 65535,
+  204, 765, 809, 2676, 3279, 1790, 1841, 48, 164, 65535, 1325, 726,
+  1864, 65535, 65535, 3265, 2080, 65535, 2864, 1547, 2688, 1725, 1785, 2879,
+  1254, 2165, 2664, 65535, 418, 2383, 65535, 2298, 1099, 1022, 3102, 245,
+  1819, 2861, 198, 3035, 1803, 65535, 1266, 2765, 81, 1875, 1140, 110,
+  1149, 65535, 2975, 926, 2184, 2523, 373, 1989, 59, 1354, 374, 758,
+  3110, 2595, 65535, 2811, 84, 2753, 1068, 3170, 851, 2084, 784, 970,
+  773, 2713, 786, 2277, 1340, 65535, 65535, 791, 2754, 2480, 3099, 3190,
+  720, 794, 988, 3219, 2630, 1101, 1105, 1474, 65535, 65535, 1144, 614,
+  2408, 571, 65535, 65535, 673, 65535, 516, 386, 2044, 3013, 65535, 129,
+  434, 157, 1560, 65535, 74, 54, 551, 1682, 2956, 489, 1155, 65535,
+  65535, 192, 468, 3153, 3314, 2364, 2373, 1967, 628, 1160, 16, 85,
+  2786, 2104, 65535, 1130, 2793, 65535, 867, 2317, 1906, 1711, 65535, 488,
+  65535, 2265, 65535, 3041, 1387, 2137, 181, 65535, 65535, 3132, 236, 2370,
+  897, 320, 1284, 1300, 2525, 402, 288, 835, 2667, 820, 65535, 3289,
+  679, 1645, 2529, 65535, 2892, 1660, 1159, 2236, 2968, 2691, 2760, 65535,
+  3253, 1812, 2599, 2679, 140, 1750, 1327, 37, 3204, 872, 1244, 2280,
+  643, 2568, 411, 2935, 2613, 65535, 1586, 2559, 1076, 65535, 2007, 3278,
+  65535, 2127, 553, 65535, 751, 65535, 65535, 923, 2208, 2149, 65535, 65535,
+  2055, 922, 395, 2671, 2736, 3252, 987, 362, 847, 985, 2947, 65535,
+  1860, 2229, 65535, 66, 483, 223, 1776, 464, 363, 2435, 266, 818,
+  65535, 193, 1955, 594, 502, 65535, 552, 1585, 2977, 1728, 93, 226,
+  3195, 1117, 1306, 65535, 2581, 1525, 2446, 65535, 1614, 1927, 65535, 65535,
+  65535, 65535, 2762, 1968, 2079, 2953, 749, 335, 2993, 515, 3027, 2161,
+  65535, 1185, 2807, 3308, 2357, 1376, 3112, 2243, 442, 3062, 1669, 65535,
+  2241, 1057, 3286, 65535, 65535, 65535, 3240, 65535, 2871, 1418, 3006, 3275,
+  3183, 65535, 482, 3214, 1179, 2027, 1549, 2615, 65535, 2109, 705, 65535,
+  399, 2106, 1531, 2560, 2877, 1690, 1778, 267, 1477, 2932, 842, 3201,
+  1245, 2413, 738, 65535, 544, 65535, 2695, 564, 65535, 65535, 2770, 2552,
+  2448, 3216, 3071, 21, 359, 65535, 401, 1899, 2739, 65535, 2308, 2230,
+  65535, 1176, 1083, 293, 65535, 2805, 1162, 1196, 131, 104, 1323, 595,
+  1031, 2999, 65535, 1970, 723, 3217, 57, 1830, 1412, 1104, 1796, 653,
+  880, 2125, 1377, 2942, 1399, 1873, 960, 2072, 469, 65535, 3274, 65535,
+  2538, 1701, 65535, 1260, 736, 2769, 843, 704, 2361, 2846, 1167, 2025,
+  65535, 620, 65535, 928, 65535, 3300, 2459, 2768, 1319, 1007, 619, 65535,
+  2048, 779, 1907, 2732, 3084, 1229, 1697, 2827, 121, 65535, 870, 65535,
+  65535, 2142, 1885, 414, 2152, 65535, 28, 2045, 65535, 1883, 1395, 1751,
+  65535, 65535, 680, 65535, 771, 2749, 2925, 256, 2450, 2366, 65535, 65535,
+  712, 2094, 139, 65535, 65535, 2849, 1771, 834, 1292, 65535, 1672, 626,
+  555, 1700, 1028, 767, 452, 1055, 2143, 283, 197, 1858, 2845, 946,
+  1206, 542, 65535, 1811, 535, 1163, 955, 227, 2211, 1457, 1704, 124,
+  869, 1936, 1304, 2319, 431, 3285, 65535, 2441, 3257, 65535, 567, 3256,
+  65535, 3206, 65535, 873, 3200, 2886, 41, 447, 449, 2421, 1511, 876,
+  2475, 2537, 65535, 1568, 2917, 1799, 816, 65535, 1444, 65535, 1073, 147,
+  3154, 65535, 1345, 65535, 65535, 65535, 2468, 1498, 65535, 611, 2814, 2360,
+  888, 65535, 487, 691, 829, 2955, 1026, 1401, 2716, 65535, 3203, 2394,
+  2597, 889, 65535, 65535, 208, 1086, 1178, 65535, 184, 2332, 3080, 65535,
+  2213, 887, 601, 2928, 3108, 2992, 2821, 2051, 1914, 590, 65535, 2253,
+  947, 2897, 2453, 2209
+};
+
 #endif
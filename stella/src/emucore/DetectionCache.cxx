@@ -0,0 +1,76 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "DetectionCache.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+DetectionCache::DetectionCache(const string& filename)
+  : myFilename(filename),
+    myFileValid(false)
+{
+  if(myFilename == EmptyString)
+    return;
+
+  ifstream in(myFilename);
+  string tag;
+  uInt32 version = 0;
+  if(!(in >> tag >> version) || tag != "DetectionCache" || version != VERSION)
+    return;
+
+  myFileValid = true;
+
+  // Lines are 'md5 type layout ystart'; later lines replace earlier ones
+  string md5, type, layout;
+  uInt32 ystart;
+  while(in >> md5 >> type >> layout >> ystart)
+    myEntries[md5 + " " + type] =
+      { layout == "PAL" ? FrameLayout::pal : FrameLayout::ntsc, ystart };
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool DetectionCache::get(const string& md5, const string& type,
+                         Entry& entry) const
+{
+  auto iter = myEntries.find(md5 + " " + type);
+  if(iter == myEntries.end())
+    return false;
+
+  entry = iter->second;
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void DetectionCache::insert(const string& md5, const string& type,
+                            const Entry& entry)
+{
+  myEntries[md5 + " " + type] = entry;
+
+  if(myFilename == EmptyString)
+    return;
+
+  // An outdated (or missing) file is started over
+  ofstream out(myFilename, myFileValid ? std::ios::app : std::ios::trunc);
+  if(!out)
+    return;
+  if(!myFileValid)
+    out << "DetectionCache " << VERSION << endl;
+  myFileValid = true;
+
+  out << md5 << " " << type << " "
+      << (entry.layout == FrameLayout::pal ? "PAL" : "NTSC") << " "
+      << entry.ystart << endl;
+}
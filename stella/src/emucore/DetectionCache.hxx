@@ -0,0 +1,93 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef DETECTION_CACHE_HXX
+#define DETECTION_CACHE_HXX
+
+#include <map>
+
+#include "bspf.hxx"
+#include "FrameLayout.hxx"
+
+/**
+  This class remembers the results of the frame layout and ystart
+  autodetection, which otherwise has to emulate a few dozen frames
+  each time a ROM is started.  The results only depend on the ROM
+  image and its bankswitch type, which together form the key.
+
+  Entries are appended to a plain text file as they are found, one per
+  line; the file starts with a version line, and is discarded when the
+  version doesn't match (ie, after changes to the detection).
+*/
+class DetectionCache
+{
+  public:
+    struct Entry {
+      FrameLayout layout;  // the detected frame layout
+      uInt32 ystart;       // the detected ystart, for this layout
+    };
+
+    /**
+      Create a cache from the specified file.  An empty filename gives a
+      cache which is never written to disk.
+    */
+    DetectionCache(const string& filename);
+
+  public:
+    /**
+      Get the entry for the given ROM.
+
+      @param md5    The md5 of the ROM image
+      @param type   The bankswitch type of the cartridge
+      @param entry  The cached entry, if found
+
+      @return  True if an entry was found, else false
+    */
+    bool get(const string& md5, const string& type, Entry& entry) const;
+
+    /**
+      Insert (or replace) the entry for the given ROM, and append it to
+      the file.
+
+      @param md5    The md5 of the ROM image
+      @param type   The bankswitch type of the cartridge
+      @param entry  The entry to insert
+    */
+    void insert(const string& md5, const string& type, const Entry& entry);
+
+  private:
+    // Increase whenever the detection changes, which invalidates the file
+    static constexpr uInt32 VERSION = 1;
+
+    string myFilename;
+
+    // Whether the file exists with the current version (so that entries
+    // can be appended)
+    bool myFileValid;
+
+    std::map<string, Entry> myEntries;
+
+  private:
+    // Following constructors and assignment operators not supported
+    DetectionCache() = delete;
+    DetectionCache(const DetectionCache&) = delete;
+    DetectionCache(DetectionCache&&) = delete;
+    DetectionCache& operator=(const DetectionCache&) = delete;
+    DetectionCache& operator=(DetectionCache&&) = delete;
+};
+
+#endif
@@ -32,7 +32,6 @@
 #include "Menu.hxx"
 #include "OSystem.hxx"
 #include "Joystick.hxx"
-#include "Paddles.hxx"
 #include "PJoystickHandler.hxx"
 #include "PointingDevice.hxx"
 #include "PropsSet.hxx"
@@ -41,6 +40,8 @@
 #include "Settings.hxx"
 #include "Sound.hxx"
 #include "StateManager.hxx"
+#include "EmulationWorker.hxx"
+#include "System.hxx"
 #include "Switches.hxx"
 #include "M6532.hxx"
 #include "MouseControl.hxx"
@@ -63,14 +64,15 @@ EventHandler::EventHandler(OSystem& osystem)
     myState(EventHandlerState::NONE),
     myAllowAllDirectionsFlag(false),
     myFryingFlag(false),
+    myFastForwardFlag(false),
     mySkipMouseMotion(true),
     myIs7800(false)
 {
   // Create keyboard handler (to handle all physical keyboard functionality)
-  myPKeyHandler = make_unique<PhysicalKeyboardHandler>(osystem, *this, myEvent);
+  myPKeyHandler = make_unique<PhysicalKeyboardHandler>(osystem, *this, myHostEvent);
 
   // Create joystick handler (to handle all physical joystick functionality)
-  myPJoyHandler = make_unique<PhysicalJoystickHandler>(osystem, *this, myEvent);
+  myPJoyHandler = make_unique<PhysicalJoystickHandler>(osystem, *this, myHostEvent);
 
   // Erase the 'combo' array
   for(int i = 0; i < kComboSize; ++i)
@@ -93,8 +95,6 @@ void EventHandler::initialize()
   setActionMappings(kMenuMode);
 
   Joystick::setDeadZone(myOSystem.settings().getInt("joydeadzone"));
-  Paddles::setDigitalSensitivity(myOSystem.settings().getInt("dsense"));
-  Paddles::setMouseSensitivity(myOSystem.settings().getInt("msense"));
   PointingDevice::setSensitivity(myOSystem.settings().getInt("tsense"));
 
   // Set quick select delay when typing characters in listwidgets
@@ -195,22 +195,13 @@ void EventHandler::poll(uInt64 time)
 {
   // Process events from the underlying hardware
   pollEvent();
+  publishInput();
 
-  // Update controllers and console switches, and in general all other things
-  // related to emulation
   if(myState == EventHandlerState::EMULATION)
   {
-    myOSystem.console().riot().update();
-
-    // Now check if the StateManager should be saving or loading state
-    // (for rewind and/or movies
-    if(myOSystem.state().mode() != StateManager::Mode::Off)
-      myOSystem.state().update();
-
-  #ifdef CHEATCODE_SUPPORT
-    for(auto& cheat: myOSystem.cheat().perFrame())
-      cheat->evaluate();
-  #endif
+    // A separate emulation thread does this itself, before each frame
+    if(!myOSystem.emulationWorker().enabled())
+      updateEmulation();
 
     // Handle continuous snapshots
     if(myOSystem.png().continuousSnapEnabled())
@@ -223,10 +214,48 @@ void EventHandler::poll(uInt64 time)
     myOverlay->updateTime(time);
   }
 
-  // Turn off all mouse-related items; if they haven't been taken care of
-  // in the previous ::update() methods, they're now invalid
+  // The relative mouse motion has been queued above; collect it anew
+  myHostEvent.set(Event::MouseAxisXValue, 0);
+  myHostEvent.set(Event::MouseAxisYValue, 0);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void EventHandler::publishInput()
+{
+  myInputQueue.publish(myHostEvent);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void EventHandler::applyInput()
+{
+  myInputQueue.apply(myEvent);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void EventHandler::updateEmulation()
+{
+  applyInput();
+
+  // Movies record or replace the inputs before the controllers read them
+  if(myOSystem.state().movieActive())
+    myOSystem.state().update();
+
+  // Update controllers and console switches, and in general all other things
+  // related to emulation
+  myOSystem.console().riot().update();
+
+  // The controllers have consumed the relative mouse motion
   myEvent.set(Event::MouseAxisXValue, 0);
   myEvent.set(Event::MouseAxisYValue, 0);
+
+  // Now check if the StateManager should be saving state (for rewind)
+  if(myOSystem.state().mode() == StateManager::Mode::TimeMachine)
+    myOSystem.state().update();
+
+#ifdef CHEATCODE_SUPPORT
+  for(auto& cheat: myOSystem.cheat().perFrame())
+    cheat->evaluate();
+#endif
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -245,8 +274,11 @@ void EventHandler::handleMouseMotionEvent(int x, int y, int xrel, int yrel)
   {
     if(!mySkipMouseMotion)
     {
-      myEvent.set(Event::MouseAxisXValue, xrel);
-      myEvent.set(Event::MouseAxisYValue, yrel);
+      // Several motion events may arrive before the next poll
+      myHostEvent.set(Event::MouseAxisXValue,
+                      myHostEvent.get(Event::MouseAxisXValue) + xrel);
+      myHostEvent.set(Event::MouseAxisYValue,
+                      myHostEvent.get(Event::MouseAxisYValue) + yrel);
     }
     mySkipMouseMotion = false;
   }
@@ -264,10 +296,10 @@ void EventHandler::handleMouseButtonEvent(MouseButton b, bool pressed,
     switch(b)
     {
       case MouseButton::LEFT:
-        myEvent.set(Event::MouseButtonLeftValue, int(pressed));
+        myHostEvent.set(Event::MouseButtonLeftValue, int(pressed));
         break;
       case MouseButton::RIGHT:
-        myEvent.set(Event::MouseButtonRightValue, int(pressed));
+        myHostEvent.set(Event::MouseButtonRightValue, int(pressed));
         break;
       default:
         return;
@@ -314,42 +346,42 @@ void EventHandler::handleEvent(Event::Type event, Int32 state)
     // If enabled, make sure 'impossible' joystick directions aren't allowed
     case Event::JoystickZeroUp:
       if(!myAllowAllDirectionsFlag && state)
-        myEvent.set(Event::JoystickZeroDown, 0);
+        myHostEvent.set(Event::JoystickZeroDown, 0);
       break;
 
     case Event::JoystickZeroDown:
       if(!myAllowAllDirectionsFlag && state)
-        myEvent.set(Event::JoystickZeroUp, 0);
+        myHostEvent.set(Event::JoystickZeroUp, 0);
       break;
 
     case Event::JoystickZeroLeft:
       if(!myAllowAllDirectionsFlag && state)
-        myEvent.set(Event::JoystickZeroRight, 0);
+        myHostEvent.set(Event::JoystickZeroRight, 0);
       break;
 
     case Event::JoystickZeroRight:
       if(!myAllowAllDirectionsFlag && state)
-        myEvent.set(Event::JoystickZeroLeft, 0);
+        myHostEvent.set(Event::JoystickZeroLeft, 0);
       break;
 
     case Event::JoystickOneUp:
       if(!myAllowAllDirectionsFlag && state)
-        myEvent.set(Event::JoystickOneDown, 0);
+        myHostEvent.set(Event::JoystickOneDown, 0);
       break;
 
     case Event::JoystickOneDown:
       if(!myAllowAllDirectionsFlag && state)
-        myEvent.set(Event::JoystickOneUp, 0);
+        myHostEvent.set(Event::JoystickOneUp, 0);
       break;
 
     case Event::JoystickOneLeft:
       if(!myAllowAllDirectionsFlag && state)
-        myEvent.set(Event::JoystickOneRight, 0);
+        myHostEvent.set(Event::JoystickOneRight, 0);
       break;
 
     case Event::JoystickOneRight:
       if(!myAllowAllDirectionsFlag && state)
-        myEvent.set(Event::JoystickOneLeft, 0);
+        myHostEvent.set(Event::JoystickOneLeft, 0);
       break;
     ////////////////////////////////////////////////////////////////////////
 
@@ -357,6 +389,10 @@ void EventHandler::handleEvent(Event::Type event, Int32 state)
       if(myPKeyHandler->useCtrlKey()) myFryingFlag = bool(state);
       return;
 
+    case Event::FastForward:
+      enableFastForward(bool(state));
+      return;
+
     case Event::VolumeDecrease:
       if(state) myOSystem.sound().adjustVolume(-1);
       return;
@@ -377,6 +413,14 @@ void EventHandler::handleEvent(Event::Type event, Int32 state)
       if(state) myOSystem.state().loadState();
       return;
 
+    case Event::ToggleMovieRecord:
+      if(state) myOSystem.state().toggleRecordMode();
+      return;
+
+    case Event::ToggleMoviePlayback:
+      if(state) myOSystem.state().togglePlaybackMode();
+      return;
+
     case Event::TakeSnapshot:
       if(state) myOSystem.png().takeSnapshot();
       return;
@@ -433,14 +477,14 @@ void EventHandler::handleEvent(Event::Type event, Int32 state)
     case Event::ConsoleColor:
       if(state && !myIs7800)
       {
-        myEvent.set(Event::ConsoleBlackWhite, 0);
+        myHostEvent.set(Event::ConsoleBlackWhite, 0);
         myOSystem.frameBuffer().showMessage("Color Mode");
       }
       break;
     case Event::ConsoleBlackWhite:
       if(state && !myIs7800)
       {
-        myEvent.set(Event::ConsoleColor, 0);
+        myHostEvent.set(Event::ConsoleColor, 0);
         myOSystem.frameBuffer().showMessage("BW Mode");
       }
       break;
@@ -449,14 +493,14 @@ void EventHandler::handleEvent(Event::Type event, Int32 state)
       {
         if(myOSystem.console().switches().tvColor())
         {
-          myEvent.set(Event::ConsoleBlackWhite, 1);
-          myEvent.set(Event::ConsoleColor, 0);
+          myHostEvent.set(Event::ConsoleBlackWhite, 1);
+          myHostEvent.set(Event::ConsoleColor, 0);
           myOSystem.frameBuffer().showMessage("BW Mode");
         }
         else
         {
-          myEvent.set(Event::ConsoleBlackWhite, 0);
-          myEvent.set(Event::ConsoleColor, 1);
+          myHostEvent.set(Event::ConsoleBlackWhite, 0);
+          myHostEvent.set(Event::ConsoleColor, 1);
           myOSystem.frameBuffer().showMessage("Color Mode");
         }
         myOSystem.console().switches().update();
@@ -466,14 +510,14 @@ void EventHandler::handleEvent(Event::Type event, Int32 state)
     case Event::ConsoleLeftDiffA:
       if(state)
       {
-        myEvent.set(Event::ConsoleLeftDiffB, 0);
+        myHostEvent.set(Event::ConsoleLeftDiffB, 0);
         myOSystem.frameBuffer().showMessage("Left Difficulty A");
       }
       break;
     case Event::ConsoleLeftDiffB:
       if(state)
       {
-        myEvent.set(Event::ConsoleLeftDiffA, 0);
+        myHostEvent.set(Event::ConsoleLeftDiffA, 0);
         myOSystem.frameBuffer().showMessage("Left Difficulty B");
       }
       break;
@@ -482,14 +526,14 @@ void EventHandler::handleEvent(Event::Type event, Int32 state)
       {
         if(myOSystem.console().switches().leftDifficultyA())
         {
-          myEvent.set(Event::ConsoleLeftDiffA, 0);
-          myEvent.set(Event::ConsoleLeftDiffB, 1);
+          myHostEvent.set(Event::ConsoleLeftDiffA, 0);
+          myHostEvent.set(Event::ConsoleLeftDiffB, 1);
           myOSystem.frameBuffer().showMessage("Left Difficulty B");
         }
         else
         {
-          myEvent.set(Event::ConsoleLeftDiffA, 1);
-          myEvent.set(Event::ConsoleLeftDiffB, 0);
+          myHostEvent.set(Event::ConsoleLeftDiffA, 1);
+          myHostEvent.set(Event::ConsoleLeftDiffB, 0);
           myOSystem.frameBuffer().showMessage("Left Difficulty A");
         }
         myOSystem.console().switches().update();
@@ -499,14 +543,14 @@ void EventHandler::handleEvent(Event::Type event, Int32 state)
     case Event::ConsoleRightDiffA:
       if(state)
       {
-        myEvent.set(Event::ConsoleRightDiffB, 0);
+        myHostEvent.set(Event::ConsoleRightDiffB, 0);
         myOSystem.frameBuffer().showMessage("Right Difficulty A");
       }
       break;
     case Event::ConsoleRightDiffB:
       if(state)
       {
-        myEvent.set(Event::ConsoleRightDiffA, 0);
+        myHostEvent.set(Event::ConsoleRightDiffA, 0);
         myOSystem.frameBuffer().showMessage("Right Difficulty B");
       }
       break;
@@ -515,14 +559,14 @@ void EventHandler::handleEvent(Event::Type event, Int32 state)
       {
         if(myOSystem.console().switches().rightDifficultyA())
         {
-          myEvent.set(Event::ConsoleRightDiffA, 0);
-          myEvent.set(Event::ConsoleRightDiffB, 1);
+          myHostEvent.set(Event::ConsoleRightDiffA, 0);
+          myHostEvent.set(Event::ConsoleRightDiffB, 1);
           myOSystem.frameBuffer().showMessage("Right Difficulty B");
         }
         else
         {
-          myEvent.set(Event::ConsoleRightDiffA, 1);
-          myEvent.set(Event::ConsoleRightDiffB, 0);
+          myHostEvent.set(Event::ConsoleRightDiffA, 1);
+          myHostEvent.set(Event::ConsoleRightDiffB, 0);
           myOSystem.frameBuffer().showMessage("Right Difficulty A");
         }
         myOSystem.console().switches().update();
@@ -538,7 +582,7 @@ void EventHandler::handleEvent(Event::Type event, Int32 state)
   }
 
   // Otherwise, pass it to the emulation core
-  myEvent.set(event, state);
+  myHostEvent.set(event, state);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1148,9 +1192,22 @@ void EventHandler::enterTimeMachineMenuMode(uInt32 numWinds, bool unwind)
   enterMenuMode(EventHandlerState::TIMEMACHINE);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void EventHandler::enableFastForward(bool enable)
+{
+  if(enable == myFastForwardFlag)
+    return;
+
+  myFastForwardFlag = enable;
+
+  // While muted, the sound device only tracks the audio registers
+  myOSystem.sound().mute(enable);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void EventHandler::setState(EventHandlerState state)
 {
+  enableFastForward(false);
   myState = state;
 
   // Normally, the usage of Control key is determined by 'ctrlcombo'
@@ -1193,7 +1250,9 @@ void EventHandler::setState(EventHandlerState state)
     case EventHandlerState::LAUNCHER:
       myOverlay = &myOSystem.launcher();
       enableTextEvents(true);
+      myHostEvent.clear();
       myEvent.clear();
+      myInputQueue.reset();
       break;
 
     case EventHandlerState::DEBUGGER:
@@ -1236,8 +1295,11 @@ EventHandler::ActionList EventHandler::ourEmulActionList[kEmulActionListSize] =
   { Event::SaveState,              "Save State",               "", false },
   { Event::ChangeState,            "Change State",             "", false },
   { Event::LoadState,              "Load State",               "", false },
+  { Event::ToggleMovieRecord,      "Toggle movie recording",   "", false },
+  { Event::ToggleMoviePlayback,    "Toggle movie playback",    "", false },
   { Event::TakeSnapshot,           "Snapshot",                 "", false },
   { Event::Fry,                    "Fry cartridge",            "", false },
+  { Event::FastForward,            "Fast-forward",             "", false },
   { Event::VolumeDecrease,         "Decrease volume",          "", false },
   { Event::VolumeIncrease,         "Increase volume",          "", false },
   { Event::PauseMode,              "Pause",                    "", false },
@@ -32,6 +32,7 @@ class PhysicalJoystick;
 #include "StellaKeys.hxx"
 #include "PKeyboardHandler.hxx"
 #include "PJoystickHandler.hxx"
+#include "InputQueue.hxx"
 #include "Variant.hxx"
 #include "bspf.hxx"
 
@@ -60,10 +61,13 @@ class EventHandler
 
     /**
       Returns the event object associated with this handler class.
+      This is the one the emulation reads from; input from the physical
+      devices only reaches it through publishInput() and applyInput().
 
       @return The event object
     */
     const Event& event() const { return myEvent; }
+    Event& event() { return myEvent; }
 
     /**
       Initialize state of this eventhandler.
@@ -97,6 +101,26 @@ class EventHandler
     */
     void poll(uInt64 time);
 
+    /**
+      Hands the input collected from the physical devices (and through
+      handleEvent) over to the emulation.  Called by poll().
+    */
+    void publishInput();
+
+    /**
+      Makes the input handed over by publishInput() visible to the
+      emulation.  Called by updateEmulation(), on the thread running
+      the emulation.
+    */
+    void applyInput();
+
+    /**
+      Updates the controllers, console switches and everything else which
+      happens once per frame, before the frame is emulated.  Called by
+      poll(), unless the emulation runs on a thread of its own.
+    */
+    void updateEmulation();
+
     /**
       Get/set the current state of the EventHandler
 
@@ -149,6 +173,7 @@ class EventHandler
     void handleConsoleStartupEvents();
 
     bool frying() const { return myFryingFlag; }
+    bool fastForward() const { return myFastForwardFlag; }
 
     StringList getActionList(EventMode mode) const;
     VariantList getComboList(EventMode mode) const;
@@ -363,10 +388,16 @@ class EventHandler
     enum {
       kComboSize          = 16,
       kEventsPerCombo     = 8,
-      kEmulActionListSize = 80 + kComboSize,
+      kEmulActionListSize = 83 + kComboSize,
       kMenuActionListSize = 14
     };
 
+    /**
+      Start/stop running the emulation as fast as the host allows (as long
+      as the fast-forward key is held).  Sound is muted meanwhile.
+    */
+    void enableFastForward(bool enable);
+
     /**
       The following methods take care of assigning action mappings.
     */
@@ -389,6 +420,11 @@ class EventHandler
     // Global Event object
     Event myEvent;
 
+    // Event object the physical devices write into, and the queue which
+    // carries its changes to myEvent
+    Event myHostEvent;
+    InputQueue myInputQueue;
+
     // Indicates current overlay object
     DialogContainer* myOverlay;
 
@@ -414,6 +450,9 @@ class EventHandler
     // Indicates whether or not we're in frying mode
     bool myFryingFlag;
 
+    // Indicates whether or not the emulation runs as fast as possible
+    bool myFastForwardFlag;
+
     // Sometimes an extraneous mouse motion event occurs after a video
     // state change; we detect when this happens and discard the event
     bool mySkipMouseMotion;
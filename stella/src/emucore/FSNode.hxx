@@ -250,6 +250,17 @@ class FilesystemNode
      */
     virtual uInt32 read(BytePtr& buffer) const;
 
+    /**
+     * Get the size and the time of last modification of the file, which
+     * together can be used to tell whether the file has changed.
+     *
+     * @param size     The size of the file, in bytes
+     * @param modtime  The time of last modification (in seconds since epoch)
+     *
+     * @return  True if the information is available, else false
+     */
+    virtual bool getStats(uInt64& size, uInt64& modtime) const;
+
     /**
      * The following methods are almost exactly the same as the various
      * getXXXX() methods above.  Internally, they call the respective methods
@@ -399,6 +410,13 @@ class AbstractFSNode
      */
     virtual uInt32 read(BytePtr& buffer) const { return 0; }
 
+    /**
+     * Get the size and the time of last modification of the file.
+     *
+     * @return  True if the information is available, else false
+     */
+    virtual bool getStats(uInt64& size, uInt64& modtime) const { return false; }
+
     /**
      * The parent node of this directory.
      * The parent of the root is the root itself.
@@ -35,6 +35,9 @@
 
 #include "FBSurface.hxx"
 #include "TIASurface.hxx"
+#include "EmulationWorker.hxx"
+#include "StateManager.hxx"
+#include "RunAheadManager.hxx"
 #include "FrameBuffer.hxx"
 
 #ifdef DEBUGGER_SUPPORT
@@ -233,7 +236,7 @@ FBInitStatus FrameBuffer::createDisplay(const string& title,
   // Create surfaces for TIA statistics and general messages
   myStatsMsg.color = kColorInfo;
   myStatsMsg.w = font().getMaxCharWidth() * 30 + 3;
-  myStatsMsg.h = (font().getFontHeight() + 2) * 2;
+  myStatsMsg.h = (font().getFontHeight() + 2) * 3;
 
   if(!myStatsMsg.surface)
   {
@@ -273,25 +276,62 @@ void FrameBuffer::update()
   {
     case EventHandlerState::EMULATION:
     {
-      // Run the console for one frame
-      // Note that the debugger can cause a breakpoint to occur, which changes
-      // the EventHandler state 'behind our back' - we need to check for that
-      myOSystem.console().tia().update();
-  #ifdef DEBUGGER_SUPPORT
-      if(myOSystem.eventHandler().state() != EventHandlerState::EMULATION) break;
-  #endif
-      if(myOSystem.eventHandler().frying())
-        myOSystem.console().fry();
-
-      // And update the screen
-      myTIASurface->render();
+      EmulationWorker::FrameInfo localInfo;
+      const EmulationWorker::FrameInfo* info = &localInfo;
+      EmulationWorker& worker = myOSystem.emulationWorker();
+      if(worker.enabled())
+      {
+        // The console runs on the emulation thread; show its newest frame,
+        // together with the statistics taken there
+        if(worker.acquireFrame())
+          myTIASurface->render(worker.frame().pixels, worker.frame().height);
+        else
+          myTIASurface->redraw();
+        info = &worker.frame().info;
+      }
+      else
+      {
+        // Run the console for one frame
+        // Note that the debugger can cause a breakpoint to occur, which changes
+        // the EventHandler state 'behind our back' - we need to check for that
+        EventHandler& handler = myOSystem.eventHandler();
+        if(handler.fastForward())
+        {
+          // Emulate as many frames as fit into most of one frame period;
+          // only the last one is drawn
+          TIA& tia = myOSystem.console().tia();
+          const uInt64 deadline = myOSystem.getTicks() +
+                                  uInt64(750000.0 / myOSystem.frameRate());
+          for(;;)
+          {
+            const bool last = myOSystem.getTicks() >= deadline;
+            tia.enableRendering(last);
+            tia.update();
+            if(last || handler.state() != EventHandlerState::EMULATION)
+              break;
+            handler.updateEmulation();
+          }
+          tia.enableRendering(true);
+        }
+        else
+          myOSystem.state().runAheadManager().emulateFrame();
+    #ifdef DEBUGGER_SUPPORT
+        if(myOSystem.eventHandler().state() != EventHandlerState::EMULATION) break;
+    #endif
+        if(myOSystem.eventHandler().frying())
+          myOSystem.console().fry();
+
+        // And update the screen
+        myTIASurface->render();
+        localInfo.capture(myOSystem);
+      }
 
       // Show frame statistics
       if(myStatsMsg.enabled)
-        drawFrameStats();
+        drawFrameStats(*info);
       else
-        myLastFrameRate = myOSystem.console().getFramerate();
-      myLastScanlines = myOSystem.console().tia().scanlinesLastFrame();
+        myLastFrameRate = info->frameRate;
+      myLastScanlines = info->scanlines;
       myPausedCount = 0;
       break;  // EventHandlerState::EMULATION
     }
@@ -349,8 +389,11 @@ void FrameBuffer::update()
   }
 
   // Draw any pending messages
-  if(myMsg.enabled)
-    drawMessage();
+  {
+    std::lock_guard<std::mutex> lock(myMsgMutex);
+    if(myMsg.enabled)
+      drawMessage();
+  }
 
   // Do any post-frame stuff
   postFrameUpdate();
@@ -361,9 +404,12 @@ void FrameBuffer::showMessage(const string& message, MessagePosition position,
                               bool force)
 {
   // Only show messages if they've been enabled
-  if(myMsg.surface == nullptr || !(force || myOSystem.settings().getBool("uimessages")))
+  if(myMsg.surface == nullptr || !(force || myOSystem.settings().getBool(Settings::UIMessages)))
     return;
 
+  // Messages may also come from the emulation thread
+  std::lock_guard<std::mutex> lock(myMsgMutex);
+
   // Precompute the message coordinates
   myMsg.text    = message;
   myMsg.counter = uInt32(myOSystem.frameRate()) << 1; // Show message for 2 seconds
@@ -378,9 +424,8 @@ void FrameBuffer::showMessage(const string& message, MessagePosition position,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void FrameBuffer::drawFrameStats()
+void FrameBuffer::drawFrameStats(const EmulationWorker::FrameInfo& info)
 {
-  const ConsoleInfo& info = myOSystem.console().about();
   char msg[30];
   uInt32 color;
   const int XPOS = 2, YPOS = 0;
@@ -389,15 +434,14 @@ void FrameBuffer::drawFrameStats()
   myStatsMsg.surface->invalidate();
 
   // draw scanlines
-  color = myOSystem.console().tia().scanlinesLastFrame() != myLastScanlines ?
-      uInt32(kDbgColorRed) : myStatsMsg.color;
-  std::snprintf(msg, 30, "%3u", myOSystem.console().tia().scanlinesLastFrame());
+  color = info.scanlines != myLastScanlines ? uInt32(kDbgColorRed) : myStatsMsg.color;
+  std::snprintf(msg, 30, "%3u", info.scanlines);
   myStatsMsg.surface->drawString(font(), msg, xPos, YPOS,
                                  myStatsMsg.w, color, TextAlign::Left, 0, true, kBGColor);
   xPos += font().getStringWidth(msg);
 
   // draw frequency
-  std::snprintf(msg, 30, " => %s", info.DisplayFormat.c_str());
+  std::snprintf(msg, 30, " => %s", info.displayFormat.c_str());
   myStatsMsg.surface->drawString(font(), msg, xPos, YPOS,
                                  myStatsMsg.w, myStatsMsg.color, TextAlign::Left, 0, true, kBGColor);
   xPos += font().getStringWidth(msg);
@@ -408,7 +452,7 @@ void FrameBuffer::drawFrameStats()
   if(ti.totalFrames - myTotalFrames >= myLastFrameRate)
   {
     frameRate = 1000000.0 * (ti.totalFrames - myTotalFrames) / (ti.totalTime - myTotalTime);
-    if(frameRate > myOSystem.console().getFramerate() + 1)
+    if(frameRate > info.frameRate + 1)
       frameRate = 1;
     myTotalFrames = ti.totalFrames;
     myTotalTime = ti.totalTime;
@@ -421,11 +465,22 @@ void FrameBuffer::drawFrameStats()
   myLastFrameRate = frameRate;
 
   // draw bankswitching type
-  string bsinfo = info.BankSwitch +
-    (myOSystem.settings().getBool("dev.settings") ? "| Developer" : "");
+  string bsinfo = info.bankSwitch +
+    (myOSystem.settings().getBool(Settings::DevSettings) ? "| Developer" : "");
+
   myStatsMsg.surface->drawString(font(), bsinfo, XPOS, YPOS + font().getFontHeight(),
                                  myStatsMsg.w, myStatsMsg.color, TextAlign::Left, 0, true, kBGColor);
 
+  // draw the time spent running ahead
+  if(info.runAheadFrames > 0)
+  {
+    char ramsg[40];
+    std::snprintf(ramsg, 40, "Run-ahead %u => %.2fms", info.runAheadFrames,
+                  info.runAheadOverhead / 1000.0);
+    myStatsMsg.surface->drawString(font(), ramsg, XPOS, YPOS + font().getFontHeight() * 2,
+                                   myStatsMsg.w, myStatsMsg.color, TextAlign::Left, 0, true, kBGColor);
+  }
+
   myStatsMsg.surface->setDirty();
   myStatsMsg.surface->setDstPos(myImageRect.x() + 10, myImageRect.y() + 8);
   myStatsMsg.surface->render();
@@ -436,7 +491,7 @@ void FrameBuffer::toggleFrameStats()
 {
   showFrameStats(!myStatsEnabled);
   myOSystem.settings().setValue(
-    myOSystem.settings().getBool("dev.settings") ? "dev.stats" : "plr.stats", myStatsEnabled);
+    myOSystem.settings().activeId(Settings::PlrStats), myStatsEnabled);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
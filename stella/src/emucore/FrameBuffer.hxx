@@ -19,6 +19,7 @@
 #define FRAMEBUFFER_HXX
 
 #include <map>
+#include <mutex>
 
 class OSystem;
 class Console;
@@ -35,6 +36,7 @@ namespace GUI {
 #include "TIAConstants.hxx"
 #include "FrameBufferConstants.hxx"
 #include "EventHandlerConstants.hxx"
+#include "EmulationWorker.hxx"
 #include "bspf.hxx"
 
 // Contains all relevant info for the dimensions of a video screen
@@ -453,8 +455,8 @@ class FrameBuffer
     string myScreenTitle;
 
   private:
-    // Draws the frame stats overlay
-    void drawFrameStats();
+    // Draws the frame stats overlay (for a frame with the given properties)
+    void drawFrameStats(const EmulationWorker::FrameInfo& info);
 
     // Indicates the number of times the framebuffer was initialized
     uInt32 myInitializedCount;
@@ -510,6 +512,7 @@ class FrameBuffer
           color(0), enabled(false) { }
     };
     Message myMsg;
+    std::mutex myMsgMutex;
     Message myStatsMsg;
     bool myStatsEnabled;
     uInt32 myLastScanlines;
@@ -69,6 +69,7 @@ M6502::M6502(const Settings& settings)
     myDataAddressForPoke(0),
     myOnHaltCallback(nullptr),
     myHaltRequested(false),
+    myTrackDistinctAccesses(false),
     myGhostReadsTrap(true),
     myStepStateByInstruction(false)
 {
@@ -92,8 +93,8 @@ void M6502::reset()
   myExecutionStatus = 0;
 
   // Set registers to random or default values
-  bool devSettings = mySettings.getBool("dev.settings");
-  const string& cpurandom = mySettings.getString(devSettings ? "dev.cpurandom" : "plr.cpurandom");
+  const string& cpurandom =
+    mySettings.getString(mySettings.activeId(Settings::PlrCpuRandom));
   SP = BSPF::containsIgnoreCase(cpurandom, "S") ?
           mySystem->randGenerator().next() : 0xfd;
   A  = BSPF::containsIgnoreCase(cpurandom, "A") ?
@@ -116,29 +117,27 @@ void M6502::reset()
   myDataAddressForPoke = 0;
 
   myHaltRequested = false;
-  myGhostReadsTrap = mySettings.getBool("dbg.ghostreadstrap");
+  myGhostReadsTrap = mySettings.getBool(Settings::GhostReadsTrap);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+template<class Policy>
 inline uInt8 M6502::peek(uInt16 address, uInt8 flags)
 {
   handleHalt();
 
-  ////////////////////////////////////////////////
-  // TODO - move this logic directly into CartAR
-  if(address != myLastAddress)
+  if(Policy::Distinct && address != myLastAddress)
   {
     myNumberOfDistinctAccesses++;
     myLastAddress = address;
   }
-  ////////////////////////////////////////////////
   mySystem->incrementCycles(SYSTEM_CYCLES_PER_CPU);
   icycles += SYSTEM_CYCLES_PER_CPU;
   uInt8 result = mySystem->peek(address, flags);
   myLastPeekAddress = address;
 
 #ifdef DEBUGGER_SUPPORT
-  if(myReadTraps.isInitialized() && myReadTraps.isSet(address)
+  if(Policy::Hooks && myReadTraps.isInitialized() && myReadTraps.isSet(address)
      && (myGhostReadsTrap || flags != DISASM_NONE))
   {
     myLastPeekBaseAddress = myDebugger->getBaseAddress(myLastPeekAddress, true); // mirror handling
@@ -159,23 +158,21 @@ inline uInt8 M6502::peek(uInt16 address, uInt8 flags)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+template<class Policy>
 inline void M6502::poke(uInt16 address, uInt8 value, uInt8 flags)
 {
-  ////////////////////////////////////////////////
-  // TODO - move this logic directly into CartAR
-  if(address != myLastAddress)
+  if(Policy::Distinct && address != myLastAddress)
   {
     myNumberOfDistinctAccesses++;
     myLastAddress = address;
   }
-  ////////////////////////////////////////////////
   mySystem->incrementCycles(SYSTEM_CYCLES_PER_CPU);
   icycles += SYSTEM_CYCLES_PER_CPU;
   mySystem->poke(address, value, flags);
   myLastPokeAddress = address;
 
 #ifdef DEBUGGER_SUPPORT
-  if(myWriteTraps.isInitialized() && myWriteTraps.isSet(address))
+  if(Policy::Hooks && myWriteTraps.isInitialized() && myWriteTraps.isSet(address))
   {
     myLastPokeBaseAddress = myDebugger->getBaseAddress(myLastPokeAddress, false); // mirror handling
     int cond = evalCondTraps();
@@ -210,7 +207,21 @@ inline void M6502::handleHalt()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool M6502::execute(uInt32 number)
 {
-  const bool status = _execute(number);
+#ifdef DEBUGGER_SUPPORT
+  const bool hooks = debuggerHooksArmed();
+#else
+  constexpr bool hooks = false;
+#endif
+
+  bool status;
+  if(hooks)
+    status = myTrackDistinctAccesses ?
+      _execute<ExecPolicy<true, true>>(number) :
+      _execute<ExecPolicy<true, false>>(number);
+  else
+    status = myTrackDistinctAccesses ?
+      _execute<ExecPolicy<false, true>>(number) :
+      _execute<ExecPolicy<false, false>>(number);
 
 #ifdef DEBUGGER_SUPPORT
   // Debugger hack: this ensures that stepping a "STA WSYNC" will actually end at the
@@ -229,6 +240,7 @@ bool M6502::execute(uInt32 number)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+template<class Policy>
 inline bool M6502::_execute(uInt32 number)
 {
   // Clear all of the execution status bits except for the fatal error bit
@@ -245,31 +257,34 @@ inline bool M6502::_execute(uInt32 number)
     for(; !myExecutionStatus && (number != 0); --number)
     {
   #ifdef DEBUGGER_SUPPORT
-      if(myJustHitReadTrapFlag || myJustHitWriteTrapFlag)
-      {
-        bool read = myJustHitReadTrapFlag;
-        myJustHitReadTrapFlag = myJustHitWriteTrapFlag = false;
-
-        if (startDebugger(myHitTrapInfo.message, myHitTrapInfo.address, read)) return true;
-      }
-
-      if(myBreakPoints.isInitialized() && myBreakPoints.isSet(PC) && startDebugger("BP: ", PC))
-        return true;
-
-      int cond = evalCondBreaks();
-      if(cond > -1)
-      {
-        stringstream msg;
-        msg << "CBP[" << Common::Base::HEX2 << cond << "]: " << myCondBreakNames[cond];
-        if (startDebugger(msg.str())) return true;
-      }
-
-      cond = evalCondSaveStates();
-      if(cond > -1)
+      if(Policy::Hooks)
       {
-        stringstream msg;
-        msg << "conditional savestate [" << Common::Base::HEX2 << cond << "]";
-        myDebugger->addState(msg.str());
+        if(myJustHitReadTrapFlag || myJustHitWriteTrapFlag)
+        {
+          bool read = myJustHitReadTrapFlag;
+          myJustHitReadTrapFlag = myJustHitWriteTrapFlag = false;
+
+          if (startDebugger(myHitTrapInfo.message, myHitTrapInfo.address, read)) return true;
+        }
+
+        if(myBreakPoints.isInitialized() && myBreakPoints.isSet(PC) && startDebugger("BP: ", PC))
+          return true;
+
+        int cond = evalCondBreaks();
+        if(cond > -1)
+        {
+          stringstream msg;
+          msg << "CBP[" << Common::Base::HEX2 << cond << "]: " << myCondBreakNames[cond];
+          if (startDebugger(msg.str())) return true;
+        }
+
+        cond = evalCondSaveStates();
+        if(cond > -1)
+        {
+          stringstream msg;
+          msg << "conditional savestate [" << Common::Base::HEX2 << cond << "]";
+          myDebugger->addState(msg.str());
+        }
       }
   #endif  // DEBUGGER_SUPPORT
 
@@ -281,7 +296,7 @@ inline bool M6502::_execute(uInt32 number)
 
       icycles = 0;
       // Fetch instruction at the program counter
-      IR = peek(PC++, DISASM_CODE);  // This address represents a code section
+      IR = peek<Policy>(PC++, DISASM_CODE);  // This address represents a code section
 
       // Call code to execute the instruction
       switch(IR)
@@ -295,7 +310,7 @@ inline bool M6502::_execute(uInt32 number)
       }
 
   #ifdef DEBUGGER_SUPPORT
-      if(myStepStateByInstruction)
+      if(Policy::Hooks && myStepStateByInstruction)
       {
         // Check out M6502::execute for an explanation.
         handleHalt();
@@ -481,6 +496,7 @@ uInt32 M6502::addCondBreak(Expression* e, const string& name)
 {
   myCondBreaks.emplace_back(e);
   myCondBreakNames.push_back(name);
+  myCompiledCondBreaks.compile(myCondBreaks);
 
   updateStepStateByInstruction();
 
@@ -494,6 +510,7 @@ bool M6502::delCondBreak(uInt32 idx)
   {
     Vec::removeAt(myCondBreaks, idx);
     Vec::removeAt(myCondBreakNames, idx);
+    myCompiledCondBreaks.compile(myCondBreaks);
 
     updateStepStateByInstruction();
 
@@ -507,6 +524,7 @@ void M6502::clearCondBreaks()
 {
   myCondBreaks.clear();
   myCondBreakNames.clear();
+  myCompiledCondBreaks.compile(myCondBreaks);
 
   updateStepStateByInstruction();
 }
@@ -522,6 +540,7 @@ uInt32 M6502::addCondSaveState(Expression* e, const string& name)
 {
   myCondSaveStates.emplace_back(e);
   myCondSaveStateNames.push_back(name);
+  myCompiledCondSaveStates.compile(myCondSaveStates);
 
   updateStepStateByInstruction();
 
@@ -535,6 +554,7 @@ bool M6502::delCondSaveState(uInt32 idx)
   {
     Vec::removeAt(myCondSaveStates, idx);
     Vec::removeAt(myCondSaveStateNames, idx);
+    myCompiledCondSaveStates.compile(myCondSaveStates);
 
     updateStepStateByInstruction();
 
@@ -548,6 +568,7 @@ void M6502::clearCondSaveStates()
 {
   myCondSaveStates.clear();
   myCondSaveStateNames.clear();
+  myCompiledCondSaveStates.compile(myCondSaveStates);
 
   updateStepStateByInstruction();
 }
@@ -563,6 +584,7 @@ uInt32 M6502::addCondTrap(Expression* e, const string& name)
 {
   myTrapConds.emplace_back(e);
   myTrapCondNames.push_back(name);
+  myCompiledTrapConds.compile(myTrapConds);
 
   updateStepStateByInstruction();
 
@@ -576,6 +598,7 @@ bool M6502::delCondTrap(uInt32 brk)
   {
     Vec::removeAt(myTrapConds, brk);
     Vec::removeAt(myTrapCondNames, brk);
+    myCompiledTrapConds.compile(myTrapConds);
 
     updateStepStateByInstruction();
 
@@ -589,6 +612,7 @@ void M6502::clearCondTraps()
 {
   myTrapConds.clear();
   myTrapCondNames.clear();
+  myCompiledTrapConds.compile(myTrapConds);
 
   updateStepStateByInstruction();
 }
@@ -28,6 +28,7 @@ class System;
   class CpuDebug;
 
   #include "Expression.hxx"
+  #include "ExpressionProgram.hxx"
   #include "PackedBitArray.hxx"
   #include "TrapArray.hxx"
 #endif
@@ -193,6 +194,14 @@ class M6502 : public Serializable
     */
     uInt32 distinctAccesses() const { return myNumberOfDistinctAccesses; }
 
+    /**
+      Enable/disable counting of memory accesses to distinct memory
+      locations.  This is off by default, since only the AR cart needs it.
+
+      @param enable  Whether to count distinct memory accesses
+    */
+    void trackDistinctAccesses(bool enable) { myTrackDistinctAccesses = enable; }
+
     /**
       Saves the current state of this device to the given Serializer.
 
@@ -259,6 +268,7 @@ class M6502 : public Serializable
 
       @return The byte at the specified address
     */
+    template<class Policy>
     uInt8 peek(uInt16 address, uInt8 flags);
 
     /**
@@ -268,6 +278,7 @@ class M6502 : public Serializable
       @param address  The address where the value should be stored
       @param value    The value to be stored at the address
     */
+    template<class Policy>
     void poke(uInt16 address, uInt8 value, uInt8 flags = 0);
 
     /**
@@ -314,10 +325,27 @@ class M6502 : public Serializable
     */
     void handleHalt();
 
+    /**
+      Selects at compile time the optional work done by _execute for every
+      instruction and memory access.  M6502::execute picks the cheapest
+      instantiation for the current state, so normal emulation pays
+      nothing for debugger hooks or distinct-access counting.
+
+      Hooks     Check breakpoints, traps and conditional breaks/saves
+      Distinct  Count accesses to distinct memory locations
+    */
+    template<bool hooks, bool distinct>
+    struct ExecPolicy
+    {
+      static constexpr bool Hooks = hooks;
+      static constexpr bool Distinct = distinct;
+    };
+
     /**
       This is the actual dispatch function that does the grunt work. M6502::execute
       wraps it and makes sure that any pending halt is processed before returning.
     */
+    template<class Policy>
     bool _execute(uInt32 number);
 
 #ifdef DEBUGGER_SUPPORT
@@ -405,6 +433,9 @@ class M6502 : public Serializable
     /// Indicates whether RDY was pulled low
     bool myHaltRequested;
 
+    /// Indicates whether distinct memory accesses are counted
+    bool myTrackDistinctAccesses;
+
 #ifdef DEBUGGER_SUPPORT
     enum CondAction
     {
@@ -413,29 +444,28 @@ class M6502 : public Serializable
     };
 
     Int32 evalCondBreaks() {
-      for(uInt32 i = 0; i < myCondBreaks.size(); i++)
-        if(myCondBreaks[i]->evaluate())
-          return i;
-
-      return -1; // no break hit
+      return myCompiledCondBreaks.firstHit(); // -1 if no break hit
     }
 
     Int32 evalCondSaveStates()
     {
-      for(uInt32 i = 0; i < myCondSaveStates.size(); i++)
-        if(myCondSaveStates[i]->evaluate())
-          return i;
+      return myCompiledCondSaveStates.firstHit(); // -1 if no save state point hit
+    }
 
-      return -1; // no save state point hit
+    /**
+      Answers whether any debugger hooks are active; if not, the hook-free
+      instantiation of _execute can be used.
+    */
+    bool debuggerHooksArmed() const {
+      return !myBreakPoints.isEmpty() || !myReadTraps.isEmpty() ||
+             !myWriteTraps.isEmpty() || !myCondBreaks.empty() ||
+             !myCondSaveStates.empty() || myJustHitReadTrapFlag ||
+             myJustHitWriteTrapFlag || myStepStateByInstruction;
     }
 
     Int32 evalCondTraps()
     {
-      for(uInt32 i = 0; i < myTrapConds.size(); i++)
-        if(myTrapConds[i]->evaluate())
-          return i;
-
-      return -1; // no trapif hit
+      return myCompiledTrapConds.firstHit(); // -1 if no trapif hit
     }
 
     /// Pointer to the debugger for this processor or the null pointer
@@ -460,6 +490,12 @@ class M6502 : public Serializable
     StringList myCondSaveStateNames;
     vector<unique_ptr<Expression>> myTrapConds;
     StringList myTrapCondNames;
+
+    // The conditions above, compiled to bytecode for evaluation on every
+    // instruction (or memory access, for traps); rebuilt on every change
+    CompiledConditions myCompiledCondBreaks;
+    CompiledConditions myCompiledCondSaveStates;
+    CompiledConditions myCompiledTrapConds;
 #endif  // DEBUGGER_SUPPORT
 
     // These are both used only by the debugger, but since they're included
@@ -55,11 +55,10 @@ void M6532::reset()
   };
 
   // Initialize the 128 bytes of memory
-  bool devSettings = mySettings.getBool("dev.settings");
-  if(mySettings.getString(devSettings ? "dev.console" : "plr.console") == "7800")
+  if(mySettings.getString(mySettings.activeId(Settings::PlrConsole)) == "7800")
     for(uInt32 t = 0; t < 128; ++t)
       myRAM[t] = RAM_7800[t];
-  else if(mySettings.getBool(devSettings ? "dev.ramrandom" : "plr.ramrandom"))
+  else if(mySettings.getBool(mySettings.activeId(Settings::PlrRamRandom)))
     for(uInt32 t = 0; t < 128; ++t)
       myRAM[t] = mySystem->randGenerator().next();
   else
@@ -65,6 +65,11 @@ class M6532 : public Device
     */
     void update();
 
+    /**
+      Get a pointer to the 128 bytes of RAM, without any side effects.
+    */
+    const uInt8* getRAM() const { return myRAM; }
+
     /**
       Install 6532 in the specified system.  Invoked by the system
       when the 6532 is attached to it.
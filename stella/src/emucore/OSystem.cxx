@@ -18,6 +18,10 @@
 #include <cassert>
 
 #include <ctime>
+#ifdef HEADLESS
+  #include <chrono>
+  #include <thread>
+#endif
 #ifdef HAVE_GETTIMEOFDAY
   #include <sys/time.h>
 #endif
@@ -43,6 +47,7 @@
 #include "TIASurface.hxx"
 #include "Settings.hxx"
 #include "PropsSet.hxx"
+#include "DetectionCache.hxx"
 #include "EventHandler.hxx"
 #include "Menu.hxx"
 #include "CommandMenu.hxx"
@@ -52,8 +57,10 @@
 #include "Widget.hxx"
 #include "Console.hxx"
 #include "Random.hxx"
+#include "RomIndex.hxx"
 #include "SerialPort.hxx"
 #include "StateManager.hxx"
+#include "EmulationWorker.hxx"
 #include "Version.hxx"
 
 #include "OSystem.hxx"
@@ -82,12 +89,16 @@ OSystem::OSystem()
 
   // Get build info
   ostringstream info;
+#ifndef HEADLESS
   SDL_version ver;
   SDL_GetVersion(&ver);
 
   info << "Build " << STELLA_BUILD << ", using SDL " << int(ver.major)
        << "." << int(ver.minor) << "."<< int(ver.patch)
        << " [" << BSPF::ARCH << "]";
+#else
+  info << "Build " << STELLA_BUILD << ", headless [" << BSPF::ARCH << "]";
+#endif
   myBuildInfo = info.str();
 
   mySettings = MediaFactory::createSettings(*this);
@@ -131,6 +142,7 @@ bool OSystem::create()
 
   // Create a properties set for us to use and set it up
   myPropSet = make_unique<PropertiesSet>(propertiesFile());
+  myDetectionCache = make_unique<DetectionCache>(myBaseDir + "autodetect.cache");
 
 #ifdef CHEATCODE_SUPPORT
   myCheatManager = make_unique<CheatManager>(*this);
@@ -141,8 +153,10 @@ bool OSystem::create()
   myMenu = make_unique<Menu>(*this);
   myCommandMenu = make_unique<CommandMenu>(*this);
   myTimeMachine = make_unique<TimeMachine>(*this);
+  myRomIndex = make_unique<RomIndex>(*this, myBaseDir + "romindex.txt");
   myLauncher = make_unique<Launcher>(*this);
   myStateManager = make_unique<StateManager>(*this);
+  myEmulationWorker = make_unique<EmulationWorker>(*this);
 
   // Create the sound object; the sound subsystem isn't actually
   // opened until needed, so this is non-blocking (on those systems
@@ -671,7 +685,31 @@ uInt64 OSystem::getTicks() const
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void OSystem::mainLoop()
 {
-  if(mySettings->getString("timing") == "sleep")
+  myEmulationWorker->enable(mySettings->getBool("emuthread"));
+
+  if(myEmulationWorker->enabled())
+  {
+    // Separate emulation thread: it does the timing itself, so we only
+    // present whatever frame it finished last (or wait for one frame
+    // period, when there's nothing to emulate)
+    for(;;)
+    {
+      myTimingInfo.start = getTicks();
+      {
+        auto lock = myEmulationWorker->lock();
+        myEventHandler->poll(myTimingInfo.start);
+        if(myQuitLoop) break;  // Exit if the user wants to quit
+        myEmulationWorker->update();
+      }
+      myFrameBuffer->update();
+      myEmulationWorker->waitForFrame(myTimePerFrame);
+
+      myTimingInfo.totalTime += (getTicks() - myTimingInfo.start);
+      myTimingInfo.totalFrames++;
+    }
+    myEmulationWorker->enable(false);
+  }
+  else if(mySettings->getString("timing") == "sleep")
   {
     // Sleep-based wait: good for CPU, bad for graphical sync
     for(;;)
@@ -693,7 +731,12 @@ void OSystem::mainLoop()
       }
 
       if(myTimingInfo.current < myTimingInfo.virt)
+      #ifndef HEADLESS
         SDL_Delay(uInt32(myTimingInfo.virt - myTimingInfo.current) / 1000);
+      #else
+        std::this_thread::sleep_for(
+          std::chrono::microseconds(myTimingInfo.virt - myTimingInfo.current));
+      #endif
 
       myTimingInfo.totalTime += (getTicks() - myTimingInfo.start);
       myTimingInfo.totalFrames++;
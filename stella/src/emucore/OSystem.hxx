@@ -24,6 +24,8 @@ class CheatManager;
 class CommandMenu;
 class Console;
 class Debugger;
+class DetectionCache;
+class EmulationWorker;
 class Launcher;
 class Menu;
 class TimeMachine;
@@ -33,6 +35,7 @@ class PNGLibrary;
 class Properties;
 class PropertiesSet;
 class Random;
+class RomIndex;
 class SerialPort;
 class Settings;
 class Sound;
@@ -123,6 +126,13 @@ class OSystem
     */
     void saveGamePropSet(const string& md5);
 
+    /**
+      Get the cache of frame layout and ystart autodetection results.
+
+      @return The detection cache object
+    */
+    DetectionCache& detectionCache() const { return *myDetectionCache; }
+
     /**
       Get the console of the system.  The console won't always exist,
       so we should test if it's available.
@@ -160,6 +170,13 @@ class OSystem
     */
     Launcher& launcher() const { return *myLauncher; }
 
+    /**
+      Get the index of ROM files (md5, type, etc) used by the launcher.
+
+      @return The ROM index object
+    */
+    RomIndex& romIndex() const { return *myRomIndex; }
+
     /**
       Get the time machine of the system (manages state files).
 
@@ -174,6 +191,13 @@ class OSystem
     */
     StateManager& state() const { return *myStateManager; }
 
+    /**
+      Get the worker running the emulation on a separate thread.
+
+      @return The emulation worker object
+    */
+    EmulationWorker& emulationWorker() const { return *myEmulationWorker; }
+
     /**
       Get the PNG handler of the system.
 
@@ -463,6 +487,9 @@ class OSystem
     // Pointer to the game's PropertiesSet object
     unique_ptr<PropertiesSet> myGamePropSet;
 
+    // Pointer to the DetectionCache object
+    unique_ptr<DetectionCache> myDetectionCache;
+
     // MD5 of the currently loaded  game PropertiesSet object
     string myGamePropSetMD5;
 
@@ -482,6 +509,9 @@ class OSystem
     unique_ptr<Launcher> myLauncher;
     bool myLauncherUsed;
 
+    // Pointer to the RomIndex object
+    unique_ptr<RomIndex> myRomIndex;
+
     // Pointer to the TimeMachine object
     unique_ptr<TimeMachine> myTimeMachine;
 
@@ -498,6 +528,9 @@ class OSystem
     // Pointer to the StateManager object
     unique_ptr<StateManager> myStateManager;
 
+    // Runs the emulation on a separate thread (if enabled)
+    unique_ptr<EmulationWorker> myEmulationWorker;
+
     // PNG object responsible for loading/saving PNG images
     unique_ptr<PNGLibrary> myPNGLib;
 
@@ -16,16 +16,23 @@
 //============================================================================
 
 #include "Event.hxx"
+#include "Settings.hxx"
 #include "Paddles.hxx"
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Paddles::Paddles(Jack jack, const Event& event, const System& system,
+                 const Settings& settings,
                  bool swappaddle, bool swapaxis, bool swapdir)
   : Controller(jack, event, system, Controller::Paddles),
     myMPaddleID(-1),
     myMPaddleIDX(-1),
-    myMPaddleIDY(-1)
+    myMPaddleIDY(-1),
+    myTrigRange(TRIGMAX),
+    myMouseSensitivity(1)
 {
+  setDigitalSensitivity(settings.getInt("dsense"));
+  setMouseSensitivity(settings.getInt("msense"));
+
   // We must start with minimum resistance; see commit
   // 38b452e1a047a0dca38c5bcce7c271d40f76736e for more information
   updateAnalogPin(Five, minimumResistance);
@@ -199,8 +206,8 @@ Paddles::Paddles(Jack jack, const Event& event, const System& system,
 
   // The following are independent of whether or not the port
   // is left or right
-  MOUSE_SENSITIVITY = swapdir ? -abs(MOUSE_SENSITIVITY) :
-                                 abs(MOUSE_SENSITIVITY);
+  myMouseSensitivity = swapdir ? -abs(myMouseSensitivity) :
+                                  abs(myMouseSensitivity);
   if(!swapaxis)
   {
     myAxisMouseMotion = Event::MouseAxisXValue;
@@ -223,7 +230,7 @@ Paddles::Paddles(Jack jack, const Event& event, const System& system,
   myKeyRepeat0 = myKeyRepeat1 = false;
   myPaddleRepeat0 = myPaddleRepeat1 = myLastAxisX = myLastAxisY = 0;
 
-  myCharge[0] = myCharge[1] = TRIGRANGE / 2;
+  myCharge[0] = myCharge[1] = myTrigRange / 2;
   myLastCharge[0] = myLastCharge[1] = 0;
 }
 
@@ -280,8 +287,8 @@ void Paddles::update()
   {
     // We're in auto mode, where a single axis is used for one paddle only
     myCharge[myMPaddleID] = BSPF::clamp(myCharge[myMPaddleID] -
-        (myEvent.get(myAxisMouseMotion) * MOUSE_SENSITIVITY),
-        TRIGMIN, TRIGRANGE);
+        (myEvent.get(myAxisMouseMotion) * myMouseSensitivity),
+        TRIGMIN, myTrigRange);
     if(myEvent.get(Event::MouseButtonLeftValue) ||
        myEvent.get(Event::MouseButtonRightValue))
       myDigitalPinState[ourButtonPin[myMPaddleID]] = false;
@@ -293,16 +300,16 @@ void Paddles::update()
     if(myMPaddleIDX > -1)
     {
       myCharge[myMPaddleIDX] = BSPF::clamp(myCharge[myMPaddleIDX] -
-          (myEvent.get(Event::MouseAxisXValue) * MOUSE_SENSITIVITY),
-          TRIGMIN, TRIGRANGE);
+          (myEvent.get(Event::MouseAxisXValue) * myMouseSensitivity),
+          TRIGMIN, myTrigRange);
       if(myEvent.get(Event::MouseButtonLeftValue))
         myDigitalPinState[ourButtonPin[myMPaddleIDX]] = false;
     }
     if(myMPaddleIDY > -1)
     {
       myCharge[myMPaddleIDY] = BSPF::clamp(myCharge[myMPaddleIDY] -
-          (myEvent.get(Event::MouseAxisYValue) * MOUSE_SENSITIVITY),
-          TRIGMIN, TRIGRANGE);
+          (myEvent.get(Event::MouseAxisYValue) * myMouseSensitivity),
+          TRIGMIN, myTrigRange);
       if(myEvent.get(Event::MouseButtonRightValue))
         myDigitalPinState[ourButtonPin[myMPaddleIDY]] = false;
     }
@@ -313,14 +320,14 @@ void Paddles::update()
   if(myKeyRepeat0)
   {
     myPaddleRepeat0++;
-    if(myPaddleRepeat0 > DIGITAL_SENSITIVITY)
-      myPaddleRepeat0 = DIGITAL_DISTANCE;
+    if(myPaddleRepeat0 > myDigitalSensitivity)
+      myPaddleRepeat0 = myDigitalDistance;
   }
   if(myKeyRepeat1)
   {
     myPaddleRepeat1++;
-    if(myPaddleRepeat1 > DIGITAL_SENSITIVITY)
-      myPaddleRepeat1 = DIGITAL_DISTANCE;
+    if(myPaddleRepeat1 > myDigitalSensitivity)
+      myPaddleRepeat1 = myDigitalDistance;
   }
 
   myKeyRepeat0 = false;
@@ -335,7 +342,7 @@ void Paddles::update()
   if(myEvent.get(myP0IncEvent1) || myEvent.get(myP0IncEvent2))
   {
     myKeyRepeat0 = true;
-    if((myCharge[myAxisDigitalZero] + myPaddleRepeat0) < TRIGRANGE)
+    if((myCharge[myAxisDigitalZero] + myPaddleRepeat0) < myTrigRange)
       myCharge[myAxisDigitalZero] += myPaddleRepeat0;
   }
   if(myEvent.get(myP1DecEvent1) || myEvent.get(myP1DecEvent2))
@@ -347,7 +354,7 @@ void Paddles::update()
   if(myEvent.get(myP1IncEvent1) || myEvent.get(myP1IncEvent2))
   {
     myKeyRepeat1 = true;
-    if((myCharge[myAxisDigitalOne] + myPaddleRepeat1) < TRIGRANGE)
+    if((myCharge[myAxisDigitalOne] + myPaddleRepeat1) < myTrigRange)
       myCharge[myAxisDigitalOne] += myPaddleRepeat1;
   }
 
@@ -398,28 +405,24 @@ bool Paddles::setMouseControl(
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Paddles::setDigitalSensitivity(int sensitivity)
 {
-  DIGITAL_SENSITIVITY = BSPF::clamp(sensitivity, 1, MAX_DIGITAL_SENSE);
-  DIGITAL_DISTANCE = 20 + (DIGITAL_SENSITIVITY << 3);
+  myDigitalSensitivity = BSPF::clamp(sensitivity, 1, MAX_DIGITAL_SENSE);
+  myDigitalDistance = 20 + (myDigitalSensitivity << 3);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Paddles::setMouseSensitivity(int sensitivity)
 {
-  MOUSE_SENSITIVITY = BSPF::clamp(sensitivity, 1, MAX_MOUSE_SENSE);
+  // Keep the direction, which is set from the properties in the c'tor
+  sensitivity = BSPF::clamp(sensitivity, 1, MAX_MOUSE_SENSE);
+  myMouseSensitivity = myMouseSensitivity < 0 ? -sensitivity : sensitivity;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Paddles::setPaddleRange(int range)
 {
   range = BSPF::clamp(range, 1, 100);
-  TRIGRANGE = int(TRIGMAX * (range / 100.0));
+  myTrigRange = int(TRIGMAX * (range / 100.0));
 }
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-int Paddles::TRIGRANGE = Paddles::TRIGMAX;
-int Paddles::DIGITAL_SENSITIVITY = -1;
-int Paddles::DIGITAL_DISTANCE = -1;
-int Paddles::MOUSE_SENSITIVITY = -1;
-
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 const Controller::DigitalPin Paddles::ourButtonPin[2] = { Four, Three };
@@ -18,6 +18,8 @@
 #ifndef PADDLES_HXX
 #define PADDLES_HXX
 
+class Settings;
+
 #include "bspf.hxx"
 #include "Control.hxx"
 #include "Event.hxx"
@@ -33,9 +35,10 @@ class Paddles : public Controller
     /**
       Create a new pair of paddle controllers plugged into the specified jack
 
-      @param jack   The jack the controller is plugged into
-      @param event  The event object to use for events
-      @param system The system using this controller
+      @param jack     The jack the controller is plugged into
+      @param event    The event object to use for events
+      @param system   The system using this controller
+      @param settings The settings used for digital/mouse sensitivity
 
       @param swappaddle Whether to swap the paddles plugged into this jack
       @param swapaxis   Whether to swap the axis on the paddle (x <-> y)
@@ -44,6 +47,7 @@ class Paddles : public Controller
                         resistance to decrease instead of increase)
     */
     Paddles(Jack jack, const Event& event, const System& system,
+            const Settings& settings,
             bool swappaddle, bool swapaxis, bool swapdir);
     virtual ~Paddles() = default;
 
@@ -87,7 +91,7 @@ class Paddles : public Controller
       @param sensitivity  Value from 1 to MAX_DIGITAL_SENSE, with larger
                           values causing more movement
     */
-    static void setDigitalSensitivity(int sensitivity);
+    void setDigitalSensitivity(int sensitivity);
 
     /**
       Sets the sensitivity for analog emulation of paddle movement
@@ -96,7 +100,7 @@ class Paddles : public Controller
       @param sensitivity  Value from 1 to MAX_MOUSE_SENSE, with larger
                           values causing more movement
     */
-    static void setMouseSensitivity(int sensitivity);
+    void setMouseSensitivity(int sensitivity);
 
     /**
       Sets the maximum upper range for digital/mouse emulation of paddle
@@ -107,7 +111,7 @@ class Paddles : public Controller
       @param range  Value from 1 to 100, representing the percentage
                     of the range to use
     */
-    static void setPaddleRange(int range);
+    void setPaddleRange(int range);
 
     static constexpr double MAX_RESISTANCE = 1400000.0;
 
@@ -134,12 +138,12 @@ class Paddles : public Controller
     // to paddle resistance
     static constexpr int TRIGMIN = 1;
     static constexpr int TRIGMAX = 4096;
-    static int TRIGRANGE;  // This one is variable for the upper range
+    int myTrigRange;  // This one is variable for the upper range
 
     static constexpr int MAX_DIGITAL_SENSE = 20;
     static constexpr int MAX_MOUSE_SENSE = 20;
-    static int DIGITAL_SENSITIVITY, DIGITAL_DISTANCE;
-    static int MOUSE_SENSITIVITY;
+    int myDigitalSensitivity, myDigitalDistance;
+    int myMouseSensitivity;
 
     // Lookup table for associating paddle buttons with controller pins
     // Yes, this is hideously complex
@@ -144,6 +144,15 @@ class Properties
     */
     static void setDefault(PropertyType key, const string& value);
 
+    /**
+      Get the default value associated with key.
+
+      @param key  The key of the property to get
+    */
+    static const string& getDefault(PropertyType key) {
+      return ourDefaultProperties[key];
+    }
+
   private:
     /**
       Helper function to perform a deep copy of the specified
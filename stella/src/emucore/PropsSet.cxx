@@ -89,34 +89,63 @@ bool PropertiesSet::getMD5(const string& md5, Properties& properties,
     }
   }
 
-  // Otherwise, search the internal database using binary search
+  // Otherwise, look in the internal database
   if(!found)
   {
-    int low = 0, high = DEF_PROPS_SIZE - 1;
-    while(low <= high)
+    int i = findDefault(md5);
+    if(i >= 0)
     {
-      int i = (low + high) / 2;
-      int cmp = BSPF::compareIgnoreCase(md5, DefProps[i][Cartridge_MD5]);
+      for(int p = 0; p < LastPropType; ++p)
+        if(DefProps[i][p][0] != 0)
+          properties.set(PropertyType(p), DefProps[i][p]);
 
-      if(cmp == 0)  // found it
-      {
-        for(int p = 0; p < LastPropType; ++p)
-          if(DefProps[i][p][0] != 0)
-            properties.set(PropertyType(p), DefProps[i][p]);
-
-        found = true;
-        break;
-      }
-      else if(cmp < 0)
-        high = i - 1; // look at lower range
-      else
-        low = i + 1;  // look at upper range
+      found = true;
     }
   }
 
   return found;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const char* PropertiesSet::getDefault(const string& md5, PropertyType key) const
+{
+  if(myExternalProps.count(md5) > 0 || myTempProps.count(md5) > 0)
+    return nullptr;
+
+  int i = findDefault(md5);
+  return i >= 0 && key != LastPropType ? DefProps[i][key] : nullptr;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+int PropertiesSet::findDefault(const string& md5)
+{
+  if(md5.length() != 32)
+    return -1;
+
+  // The hash uses the first 64 bits of the md5, as two 32-bit words
+  uInt32 word[2] = { 0, 0 };
+  for(int i = 0; i < 16; ++i)
+  {
+    char c = md5[i];
+    uInt32 nibble;
+    if(c >= '0' && c <= '9')       nibble = c - '0';
+    else if(c >= 'a' && c <= 'f')  nibble = c - 'a' + 10;
+    else if(c >= 'A' && c <= 'F')  nibble = c - 'A' + 10;
+    else return -1;
+
+    word[i >> 3] = (word[i >> 3] << 4) | nibble;
+  }
+
+  // See 'create_props.pl' for how the tables are built
+  uInt32 bucket = word[0] & ((1 << DEF_PROPS_BUCKET_BITS) - 1);
+  uInt32 slot = ((word[1] ^ DefPropsDisplace[bucket]) * 0x9e3779b1u) >>
+                (32 - DEF_PROPS_SLOT_BITS);
+  int i = DefPropsSlots[slot];
+
+  return i < DEF_PROPS_SIZE &&
+         BSPF::compareIgnoreCase(md5.c_str(), DefProps[i][Cartridge_MD5]) == 0 ? i : -1;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void PropertiesSet::getMD5WithInsert(const FilesystemNode& rom,
                                      const string& md5, Properties& properties)
@@ -77,6 +77,19 @@ class PropertiesSet
     bool getMD5(const string& md5, Properties& properties,
                 bool useDefaults = false) const;
 
+    /**
+      Get a single property of a ROM from the built-in database, without
+      creating a Properties object.
+
+      @param md5  The md5 of the ROM
+      @param key  The property to get
+
+      @return  The (static) value of the property, empty if it has the
+               default value, or nullptr if the ROM isn't in the database
+               or has properties from an external file or inserted ones
+    */
+    const char* getDefault(const string& md5, PropertyType key) const;
+
     /**
       Get the property from the set with the given MD5, at the same time
       checking if it exists.  If it doesn't, insert a temporary copy into
@@ -117,6 +130,15 @@ class PropertiesSet
     */
     uInt32 size() { return myExternalProps.size(); }
 
+  private:
+    /**
+      Find the row of the given MD5 in the built-in database, using the
+      perfect hash generated along with it.
+
+      @return  The row, or -1 if the MD5 isn't in the database
+    */
+    static int findDefault(const string& md5);
+
   private:
     using PropsList = std::map<string, Properties>;
 
@@ -20,6 +20,7 @@
 
 #include "bspf.hxx"
 #include "OSystem.hxx"
+#include "Settings.hxx"
 #include "Serializable.hxx"
 
 /**
@@ -39,11 +40,14 @@ class Random : public Serializable
 
     /**
       Re-initialize the random number generator with a new seed,
-      to generate a different set of random numbers.
+      to generate a different set of random numbers.  This is the 'seed'
+      setting if it's non-zero (making the emulation reproducible),
+      otherwise the current time.
     */
     void initSeed()
     {
-      myValue = uInt32(myOSystem.getTicks());
+      uInt32 seed = uInt32(myOSystem.settings().getInt("seed"));
+      myValue = seed != 0 ? seed : uInt32(myOSystem.getTicks());
     }
 
     /**
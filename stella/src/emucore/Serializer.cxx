@@ -23,7 +23,12 @@ using std::ios_base;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Serializer::Serializer(const string& filename, bool readonly)
-  : myStream(nullptr)
+  : myStream(nullptr),
+    myCapacity(0),
+    mySize(0),
+    myReadPos(0),
+    myWritePos(0),
+    myTransient(false)
 {
   if(readonly)
   {
@@ -62,49 +67,99 @@ Serializer::Serializer(const string& filename, bool readonly)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-Serializer::Serializer()
-  : myStream(nullptr)
+Serializer::Serializer(uInt32 capacity)
+  : myStream(nullptr),
+    myCapacity(0),
+    mySize(0),
+    myReadPos(0),
+    myWritePos(0),
+    myTransient(false)
 {
-  myStream = make_unique<stringstream>(ios::in | ios::out | ios::binary);
+  reserve(std::max(capacity, 1u));
+}
 
-  // For some reason, Windows and possibly OSX needs to store something in
-  // the stream before it is used for the first time
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Serializer::rewind()
+{
   if(myStream)
   {
-    myStream->exceptions( ios_base::failbit | ios_base::badbit | ios_base::eofbit );
-    putBool(true);
-    rewind();
+    myStream->clear();
+    myStream->seekg(ios_base::beg);
+    myStream->seekp(ios_base::beg);
   }
+  myReadPos = myWritePos = 0;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void Serializer::rewind()
+void Serializer::reserve(uInt32 capacity)
+{
+  if(capacity <= myCapacity)
+    return;
+
+  // Grow geometrically, so that a state which is built up piece by piece
+  // only causes a few reallocations (and none once the size is known)
+  uInt32 newCapacity = std::max(capacity, myCapacity * 2);
+  BytePtr buffer = make_unique<uInt8[]>(newCapacity);
+  if(mySize)
+    memcpy(buffer.get(), myBuffer.get(), mySize);
+
+  myBuffer = std::move(buffer);
+  myCapacity = newCapacity;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline void Serializer::read(void* data, uInt32 size) const
+{
+  if(myStream)
+    myStream->read(static_cast<char*>(data), size);
+  else
+  {
+    // Reading past the data written is an error, the same as reading
+    // past the end of a file stream
+    if(uInt64(myReadPos) + size > mySize)
+      throw runtime_error("Serializer: read past end of data");
+
+    memcpy(data, myBuffer.get() + myReadPos, size);
+    myReadPos += size;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline void Serializer::write(const void* data, uInt32 size)
 {
-  myStream->clear();
-  myStream->seekg(ios_base::beg);
-  myStream->seekp(ios_base::beg);
+  if(myStream)
+    myStream->write(static_cast<const char*>(data), size);
+  else
+  {
+    if(uInt64(myWritePos) + size > myCapacity)
+      reserve(myWritePos + size);
+
+    memcpy(myBuffer.get() + myWritePos, data, size);
+    myWritePos += size;
+    mySize = myWritePos;
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt8 Serializer::getByte() const
 {
-  char buf;
-  myStream->read(&buf, 1);
+  uInt8 val = 0;
+  read(&val, 1);
 
-  return buf;
+  return val;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::getByteArray(uInt8* array, uInt32 size) const
 {
-  myStream->read(reinterpret_cast<char*>(array), size);
+  read(array, size);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt16 Serializer::getShort() const
 {
   uInt16 val = 0;
-  myStream->read(reinterpret_cast<char*>(&val), sizeof(uInt16));
+  read(&val, sizeof(uInt16));
 
   return val;
 }
@@ -112,14 +167,14 @@ uInt16 Serializer::getShort() const
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::getShortArray(uInt16* array, uInt32 size) const
 {
-  myStream->read(reinterpret_cast<char*>(array), sizeof(uInt16)*size);
+  read(array, sizeof(uInt16)*size);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt32 Serializer::getInt() const
 {
   uInt32 val = 0;
-  myStream->read(reinterpret_cast<char*>(&val), sizeof(uInt32));
+  read(&val, sizeof(uInt32));
 
   return val;
 }
@@ -127,14 +182,14 @@ uInt32 Serializer::getInt() const
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::getIntArray(uInt32* array, uInt32 size) const
 {
-  myStream->read(reinterpret_cast<char*>(array), sizeof(uInt32)*size);
+  read(array, sizeof(uInt32)*size);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt64 Serializer::getLong() const
 {
   uInt64 val = 0;
-  myStream->read(reinterpret_cast<char*>(&val), sizeof(uInt64));
+  read(&val, sizeof(uInt64));
 
   return val;
 }
@@ -143,7 +198,7 @@ uInt64 Serializer::getLong() const
 double Serializer::getDouble() const
 {
   double val = 0.0;
-  myStream->read(reinterpret_cast<char*>(&val), sizeof(double));
+  read(&val, sizeof(double));
 
   return val;
 }
@@ -154,7 +209,7 @@ string Serializer::getString() const
   int len = getInt();
   string str;
   str.resize(len);
-  myStream->read(&str[0], len);
+  read(&str[0], len);
 
   return str;
 }
@@ -168,49 +223,49 @@ bool Serializer::getBool() const
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putByte(uInt8 value)
 {
-  myStream->write(reinterpret_cast<char*>(&value), 1);
+  write(&value, 1);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putByteArray(const uInt8* array, uInt32 size)
 {
-  myStream->write(reinterpret_cast<const char*>(array), size);
+  write(array, size);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putShort(uInt16 value)
 {
-  myStream->write(reinterpret_cast<char*>(&value), sizeof(uInt16));
+  write(&value, sizeof(uInt16));
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putShortArray(const uInt16* array, uInt32 size)
 {
-  myStream->write(reinterpret_cast<const char*>(array), sizeof(uInt16)*size);
+  write(array, sizeof(uInt16)*size);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putInt(uInt32 value)
 {
-  myStream->write(reinterpret_cast<char*>(&value), sizeof(uInt32));
+  write(&value, sizeof(uInt32));
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putIntArray(const uInt32* array, uInt32 size)
 {
-  myStream->write(reinterpret_cast<const char*>(array), sizeof(uInt32)*size);
+  write(array, sizeof(uInt32)*size);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putLong(uInt64 value)
 {
-  myStream->write(reinterpret_cast<char*>(&value), sizeof(uInt64));
+  write(&value, sizeof(uInt64));
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putDouble(double value)
 {
-  myStream->write(reinterpret_cast<char*>(&value), sizeof(double));
+  write(&value, sizeof(double));
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -218,7 +273,7 @@ void Serializer::putString(const string& str)
 {
   int len = int(str.length());
   putInt(len);
-  myStream->write(str.data(), len);
+  write(str.data(), len);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -25,6 +25,11 @@
   read from/written to a binary stream in a system-independent way.  The
   stream can be either an actual file, or an in-memory structure.
 
+  In-memory streams are kept in one contiguous, growable buffer, and don't
+  go through iostreams at all.  This makes them suitable for frequent state
+  saves (ie, rewind), and the resulting data can be accessed directly using
+  data() and size().
+
   Bytes are written as characters, shorts as 2 characters (16-bits),
   integers as 4 characters (32-bits), long integers as 8 bytes (64-bits),
   strings are written as characters prepended by the length of the string,
@@ -39,7 +44,8 @@ class Serializer
       Creates a new Serializer device for streaming binary data.
 
       If a filename is provided, the stream will be to the given
-      filename.  Otherwise, the stream will be in memory.
+      filename.  Otherwise, the stream will be in memory, with room for
+      'capacity' bytes before the buffer needs to grow.
 
       If a file is opened readonly, we can never write to it.
 
@@ -47,20 +53,38 @@ class Serializer
       was correctly initialized.
     */
     Serializer(const string& filename, bool readonly = false);
-    Serializer();
+    Serializer(uInt32 capacity = 4096);
 
   public:
     /**
       Answers whether the serializer is currently initialized for reading
       and writing.
     */
-    explicit operator bool() const { return myStream != nullptr; }
+    explicit operator bool() const {
+      return myStream != nullptr || myBuffer != nullptr;
+    }
 
     /**
       Resets the read/write location to the beginning of the stream.
     */
     void rewind();
 
+    /**
+      The data written to an in-memory stream, ie. everything up to the
+      end of the last write.  For file streams, this is empty.
+    */
+    const uInt8* data() const { return myBuffer.get(); }
+    uInt32 size() const       { return mySize; }
+
+    /**
+      Marks an in-memory stream as a short-lived snapshot of the emulation,
+      which is saved and loaded again by the same owner (ie, run-ahead) and
+      never written to a file.  Host devices such as the sound output are
+      neither saved to nor restored from such a stream.
+    */
+    void setTransient(bool transient) { myTransient = transient; }
+    bool isTransient() const          { return myTransient; }
+
     /**
       Reads a byte value (unsigned 8-bit) from the current input stream.
 
@@ -208,9 +232,26 @@ class Serializer
     void putBool(bool b);
 
   private:
-    // The stream to send the serialized data to.
+    // Low-level access to the stream, used by all the get/put methods
+    void read(void* data, uInt32 size) const;
+    void write(const void* data, uInt32 size);
+
+    // Make room for at least 'capacity' bytes in the in-memory buffer
+    void reserve(uInt32 capacity);
+
+  private:
+    // The stream to send the serialized data to (file streams only)
     unique_ptr<iostream> myStream;
 
+    // The buffer holding the serialized data (in-memory streams only)
+    BytePtr myBuffer;
+    uInt32 myCapacity, mySize;
+    mutable uInt32 myReadPos;
+    uInt32 myWritePos;
+
+    // Whether host devices are skipped (see setTransient())
+    bool myTransient;
+
     enum {
       TruePattern  = 0xfe,
       FalsePattern = 0x01
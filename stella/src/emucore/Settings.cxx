@@ -28,6 +28,20 @@
 
 #include "Settings.hxx"
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const char* const Settings::ourIdKeys[NumIds] = {
+  "dev.settings", "fastscbios", "framerate", "palette", "uimessages",
+  "runahead", "tia.spans", "tia.dbgcolors", "dbg.ghostreadstrap",
+
+  "plr.stats", "plr.bankrandom", "plr.ramrandom", "plr.cpurandom",
+  "plr.colorloss", "plr.tv.jitter", "plr.tv.jitter_recovery",
+  "plr.debugcolors", "plr.tiadriven", "plr.console",
+
+  "dev.stats", "dev.bankrandom", "dev.ramrandom", "dev.cpurandom",
+  "dev.colorloss", "dev.tv.jitter", "dev.tv.jitter_recovery",
+  "dev.debugcolors", "dev.tiadriven", "dev.console"
+};
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Settings::Settings(OSystem& osystem)
   : myOSystem(osystem)
@@ -40,6 +54,8 @@ Settings::Settings(OSystem& osystem)
   setInternal("center", "false");
   setInternal("palette", "standard");
   setInternal("timing", "sleep");
+  setInternal("emuthread", "false");
+  setInternal("runahead", "0");
   setInternal("uimessages", "true");
 
   // TIA specific options
@@ -49,6 +65,7 @@ Settings::Settings(OSystem& osystem)
   setInternal("tia.aspectp", "109");
   setInternal("tia.fsfill", "false");
   setInternal("tia.dbgcolors", "roygpb");
+  setInternal("tia.spans", "true");
 
   // TV filtering options
   setInternal("tv.filter", "0");
@@ -130,7 +147,9 @@ Settings::Settings(OSystem& osystem)
   setInternal("logtoconsole", "0");
   setInternal("avoxport", "");
   setInternal("fastscbios", "true");
+  setInternal("seed", "0");
   setInternal("threads", "false");
+  setInternal("threadcount", "0");
   setExternal("romloadcount", "0");
   setExternal("maxres", "");
 
@@ -186,6 +205,14 @@ Settings::Settings(OSystem& osystem)
   // Thumb ARM emulation options
   setInternal("dev.thumb.trapfatal", "true");
   setInternal("dev.eepromaccess", "true");
+
+  // Find the settings with a fixed id; those not available in this build
+  // are added as (empty) external settings
+  for(uInt32 id = 0; id < NumIds; ++id)
+  {
+    int idx = getPos(ourIdKeys[id]);
+    myIdPos[id] = idx != -1 ? idx : setExternal(ourIdKeys[id], EmptyVariant);
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -302,6 +329,9 @@ void Settings::validate()
   s = getString("timing");
   if(s != "sleep" && s != "busy")  setInternal("timing", "sleep");
 
+  i = getInt("runahead");
+  if(i < 0 || i > 6)  setInternal("runahead", "0");
+
   i = getInt("tia.aspectn");
   if(i < 80 || i > 120)  setInternal("tia.aspectn", "90");
   i = getInt("tia.aspectp");
@@ -320,11 +350,14 @@ void Settings::validate()
   i = getInt("tv.filter");
   if(i < 0 || i > 5)  setInternal("tv.filter", "0");
 
+  i = getInt("threadcount");
+  if(i < 0 || i > 64)  setInternal("threadcount", "0");
+
   i = getInt("dev.tv.jitter_recovery");
   if(i < 1 || i > 20) setInternal("dev.tv.jitter_recovery", "2");
 
   int size = getInt("dev.tm.size");
-  if(size < 20 || size > 1000)
+  if(size < 20 || size > 50000)
   {
     setInternal("dev.tm.size", 20);
     size = 20;
@@ -343,7 +376,7 @@ void Settings::validate()
   if(i < 1 || i > 20) setInternal("plr.tv.jitter_recovery", "10");
 
   size = getInt("plr.tm.size");
-  if(size < 20 || size > 1000)
+  if(size < 20 || size > 50000)
   {
     setInternal("plr.tm.size", 20);
     size = 20;
@@ -440,6 +473,8 @@ void Settings::usage() const
     << "                 user>\n"
     << "  -framerate    <number>       Display the given number of frames per second (0 to auto-calculate)\n"
     << "  -timing       <sleep|busy>   Use the given type of wait between frames\n"
+    << "  -emuthread    <1|0>          Run the emulation on a thread separate from video and input\n"
+    << "  -runahead     <0-6>          Run the emulation this many frames ahead, to hide input lag\n"
     << "  -uimessages   <1|0>          Show onscreen UI messages for different events\n"
     << endl
   #ifdef SOUND_SUPPORT
@@ -455,6 +490,7 @@ void Settings::usage() const
     << "  -tia.aspectp   <number>       Scale TIA width by the given percentage in PAL mode\n"
     << "  -tia.fsfill    <1|0>          Stretch TIA image to fill fullscreen mode\n"
     << "  -tia.dbgcolors <string>       Debug colors to use for each object (see manual for description)\n"
+    << "  -tia.spans     <1|0>          Render runs of clocks without register writes as spans\n"
     << endl
     << "  -tv.filter    <0-5>          Set TV effects off (0) or to specified mode (1-5)\n"
     << "  -tv.phosphor  <always|byrom> When to use phosphor mode\n"
@@ -489,7 +525,9 @@ void Settings::usage() const
     << "  -ctrlcombo    <1|0>          Use key combos involving the Control key (Control-Q for quit may be disabled!)\n"
     << "  -autoslot     <1|0>          Automatically switch to next save slot when state saving\n"
     << "  -fastscbios   <1|0>          Disable Supercharger BIOS progress loading bars\n"
+    << "  -seed         <number>       Seed for all randomness in the emulation (0 for the current time)\n"
     << "  -threads      <1|0>          Whether to using multi-threading during emulation\n"
+    << "  -threadcount  <number>       Number of threads to use when multi-threading (0 for all cores, up to 4)\n"
     << "  -snapsavedir  <path>         The directory to save snapshot files to\n"
     << "  -snaploaddir  <path>         The directory to load snapshot files from\n"
     << "  -snapname     <int|rom>      Name snapshots according to internal database or ROM\n"
@@ -598,33 +636,43 @@ void Settings::usage() const
 const Variant& Settings::value(const string& key) const
 {
   // Try to find the named setting and answer its value
-  int idx = -1;
-  if((idx = getInternalPos(key)) != -1)
-    return myInternalSettings[idx].value;
-  else if((idx = getExternalPos(key)) != -1)
-    return myExternalSettings[idx].value;
-  else
-    return EmptyVariant;
+  int idx = getPos(key);
+  return idx != -1 ? mySettings[idx].value : EmptyVariant;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Settings::setValue(const string& key, const Variant& value)
 {
-  if(int idx = getInternalPos(key) != -1)
-    setInternal(key, value, idx);
+  int idx = getPos(key);
+  if(idx != -1)
+    set(idx, value);
   else
     setExternal(key, value);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Settings::addListener(Id id, const void* owner, const Listener& listener)
+{
+  myListeners.push_back({ myIdPos[id], owner, listener });
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Settings::removeListeners(const void* owner)
+{
+  myListeners.erase(std::remove_if(myListeners.begin(), myListeners.end(),
+      [owner](const ListenerEntry& l) { return l.owner == owner; }),
+    myListeners.end());
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Settings::saveConfig()
 {
   // Do a quick scan of the internal settings to see if any have
   // changed.  If not, we don't need to save them at all.
   bool settingsChanged = false;
-  for(const auto& s: myInternalSettings)
+  for(const auto& s: mySettings)
   {
-    if(s.value != s.initialValue)
+    if(s.internal && s.value != s.initialValue)
     {
       settingsChanged = true;
       break;
@@ -657,130 +705,79 @@ void Settings::saveConfig()
       << ";" << endl;
 
   // Write out each of the key and value pairs
-  for(const auto& s: myInternalSettings)
-    out << s.key << " = " << s.value << endl;
+  for(const auto& s: mySettings)
+    if(s.internal)
+      out << s.key << " = " << s.value << endl;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-int Settings::getInternalPos(const string& key) const
+int Settings::getPos(const string& key) const
 {
-  for(uInt32 i = 0; i < myInternalSettings.size(); ++i)
-    if(myInternalSettings[i].key == key)
-      return i;
+  auto iter = myPositions.find(key);
+  return iter != myPositions.end() ? int(iter->second) : -1;
+}
 
-  return -1;
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+int Settings::getInternalPos(const string& key) const
+{
+  int idx = getPos(key);
+  return idx != -1 && mySettings[idx].internal ? idx : -1;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int Settings::getExternalPos(const string& key) const
 {
-  for(uInt32 i = 0; i < myExternalSettings.size(); ++i)
-    if(myExternalSettings[i].key == key)
-      return i;
-
-  return -1;
+  int idx = getPos(key);
+  return idx != -1 && !mySettings[idx].internal ? idx : -1;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int Settings::setInternal(const string& key, const Variant& value,
                           int pos, bool useAsInitial)
 {
-  int idx = -1;
-
-  if(pos >= 0 && pos < int(myInternalSettings.size()) &&
-     myInternalSettings[pos].key == key)
-  {
-    idx = pos;
-  }
-  else
-  {
-    for(uInt32 i = 0; i < myInternalSettings.size(); ++i)
-    {
-      if(myInternalSettings[i].key == key)
-      {
-        idx = i;
-        break;
-      }
-    }
-  }
-
-  if(idx != -1)
-  {
-    myInternalSettings[idx].key   = key;
-    myInternalSettings[idx].value = value;
-    if(useAsInitial) myInternalSettings[idx].initialValue = value;
-
-    /*cerr << "modify internal: key = " << key
-         << ", value  = " << value
-         << ", ivalue = " << myInternalSettings[idx].initialValue
-         << " @ index = " << idx
-         << endl;*/
-  }
-  else
-  {
-    Setting setting(key, value);
-    if(useAsInitial) setting.initialValue = value;
-
-    myInternalSettings.push_back(setting);
-    idx = int(myInternalSettings.size()) - 1;
-
-    /*cerr << "insert internal: key = " << key
-         << ", value  = " << value
-         << ", ivalue = " << setting.initialValue
-         << " @ index = " << idx
-         << endl;*/
-  }
-
-  return idx;
+  return add(key, value, true, useAsInitial);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int Settings::setExternal(const string& key, const Variant& value,
                           int pos, bool useAsInitial)
 {
-  int idx = -1;
+  return add(key, value, false, useAsInitial);
+}
 
-  if(pos >= 0 && pos < int(myExternalSettings.size()) &&
-     myExternalSettings[pos].key == key)
-  {
-    idx = pos;
-  }
-  else
-  {
-    for(uInt32 i = 0; i < myExternalSettings.size(); ++i)
-    {
-      if(myExternalSettings[i].key == key)
-      {
-        idx = i;
-        break;
-      }
-    }
-  }
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+int Settings::add(const string& key, const Variant& value, bool internal,
+                  bool useAsInitial)
+{
+  int idx = getPos(key);
 
   if(idx != -1)
   {
-    myExternalSettings[idx].key   = key;
-    myExternalSettings[idx].value = value;
-    if(useAsInitial) myExternalSettings[idx].initialValue = value;
-
-    /*cerr << "modify external: key = " << key
-         << ", value = " << value
-         << " @ index = " << idx
-         << endl;*/
+    // A setting can become internal, but never goes back to external
+    mySettings[idx].internal |= internal;
+    set(idx, value, useAsInitial);
   }
   else
   {
-    Setting setting(key, value);
-    if(useAsInitial) setting.initialValue = value;
-
-    myExternalSettings.push_back(setting);
-    idx = int(myExternalSettings.size()) - 1;
-
-    /*cerr << "insert external: key = " << key
-         << ", value = " << value
-         << " @ index = " << idx
-         << endl;*/
+    idx = int(mySettings.size());
+    mySettings.emplace_back(key, value, internal);
+    if(useAsInitial) mySettings[idx].initialValue = value;
+    myPositions[key] = idx;
   }
 
   return idx;
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Settings::set(uInt32 pos, const Variant& value, bool useAsInitial)
+{
+  Setting& setting = mySettings[pos];
+  if(useAsInitial) setting.initialValue = value;
+  if(setting.value == value)
+    return;
+
+  setting.assign(value);
+  for(const auto& l: myListeners)
+    if(l.pos == pos)
+      l.listener(setting.value);
+}
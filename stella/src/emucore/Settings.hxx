@@ -20,12 +20,20 @@
 
 class OSystem;
 
+#include <functional>
+#include <unordered_map>
+
 #include "Variant.hxx"
 #include "bspf.hxx"
 
 /**
   This class provides an interface for accessing frontend specific settings.
 
+  Settings are normally accessed by key; those read while creating and
+  resetting a console, or on each frame, also have a fixed id, which
+  avoids looking up the key.  The value of each setting is kept converted
+  to the basic types, so that the typed accessors don't parse it again.
+
   @author  Stephen Anthony
 */
 class Settings
@@ -33,6 +41,31 @@ class Settings
   friend class OSystem;
 
   public:
+    /**
+      Ids of the settings which can be accessed without a key lookup.  The
+      developer variant of each player setting is at a fixed distance from
+      it (see activeId()).
+    */
+    enum Id: uInt32 {
+      DevSettings, FastSCBios, FrameRate, Palette, UIMessages, RunAhead,
+      TIASpans, TIADbgColors, GhostReadsTrap,
+
+      PlrStats, PlrBankRandom, PlrRamRandom, PlrCpuRandom, PlrColorLoss,
+      PlrTVJitter, PlrTVJitterRecovery, PlrDebugColors, PlrTIADriven,
+      PlrConsole,
+
+      DevStats, DevBankRandom, DevRamRandom, DevCpuRandom, DevColorLoss,
+      DevTVJitter, DevTVJitterRecovery, DevDebugColors, DevTIADriven,
+      DevConsole,
+
+      NumIds
+    };
+
+    /**
+      Called with the new value whenever a setting changes.
+    */
+    using Listener = std::function<void(const Variant&)>;
+
     /**
       Create a new settings abstract class
     */
@@ -80,12 +113,54 @@ class Settings
       @param key The key of the setting to lookup
       @return The specific type value of the setting
     */
-    int getInt(const string& key) const     { return value(key).toInt();   }
-    float getFloat(const string& key) const { return value(key).toFloat(); }
-    bool getBool(const string& key) const   { return value(key).toBool();  }
+    int getInt(const string& key) const {
+      int pos = getPos(key);  return pos >= 0 ? mySettings[pos].intValue : 0;
+    }
+    float getFloat(const string& key) const {
+      int pos = getPos(key);  return pos >= 0 ? mySettings[pos].floatValue : 0.0f;
+    }
+    bool getBool(const string& key) const {
+      int pos = getPos(key);  return pos >= 0 && mySettings[pos].boolValue;
+    }
     const string& getString(const string& key) const { return value(key).toString(); }
     const GUI::Size getSize(const string& key) const { return value(key).toSize();   }
 
+    /**
+      The same accessors, for the settings with a fixed id.
+    */
+    const Variant& value(Id id) const { return mySettings[myIdPos[id]].value; }
+    void setValue(Id id, const Variant& value) { set(myIdPos[id], value); }
+
+    int getInt(Id id) const     { return mySettings[myIdPos[id]].intValue;   }
+    float getFloat(Id id) const { return mySettings[myIdPos[id]].floatValue; }
+    bool getBool(Id id) const   { return mySettings[myIdPos[id]].boolValue;  }
+    const string& getString(Id id) const { return value(id).toString(); }
+
+    /**
+      Get the id of the player setting, or of its developer variant when
+      the developer settings are enabled.
+
+      @param plrId  The id of a player ('plr.') setting
+      @return  The id of the setting currently in effect
+    */
+    Id activeId(Id plrId) const {
+      return getBool(DevSettings) ? Id(plrId + (DevStats - PlrStats)) : plrId;
+    }
+
+    /**
+      Register a function to be called whenever the given setting changes.
+
+      @param id        The setting to listen to
+      @param owner     Identifies the listener, for removing it later
+      @param listener  The function to call with the new value
+    */
+    void addListener(Id id, const void* owner, const Listener& listener);
+
+    /**
+      Remove all listeners registered by the given owner.
+    */
+    void removeListeners(const void* owner);
+
   protected:
     /**
       This method will be called to load the current settings from an rc file.
@@ -116,17 +191,29 @@ class Settings
       Variant value;
       Variant initialValue;
 
-      Setting(const string& k, const Variant& v, const Variant& i = EmptyVariant)
-        : key(k), value(v), initialValue(i) { }
+      // Internal settings are necessary for Stella to function and are
+      // saved on each program exit; external ones are auxiliary
+      bool internal;
+
+      // The value converted to the basic types
+      Int32 intValue;
+      float floatValue;
+      bool boolValue;
+
+      Setting(const string& k, const Variant& v, bool i)
+        : key(k), initialValue(EmptyVariant), internal(i) { assign(v); }
+
+      void assign(const Variant& v) {
+        value = v;
+        intValue = v.toInt();  floatValue = v.toFloat();  boolValue = v.toBool();
+      }
     };
     using SettingsArray = vector<Setting>;
 
-    const SettingsArray& getInternalSettings() const
-      { return myInternalSettings; }
-    const SettingsArray& getExternalSettings() const
-      { return myExternalSettings; }
+    // Both internal and external settings
+    const SettingsArray& getSettings() const { return mySettings; }
 
-    /** Get position in specified array of 'key' */
+    /** Get position of 'key' in the (internal or external) settings */
     int getInternalPos(const string& key) const;
     int getExternalPos(const string& key) const;
 
@@ -137,13 +224,33 @@ class Settings
                     int pos = -1, bool useAsInitial = false);
 
   private:
-    // Holds key,value pairs that are necessary for Stella to
-    // function and must be saved on each program exit.
-    SettingsArray myInternalSettings;
+    // Get the position of 'key', or -1 if it isn't known
+    int getPos(const string& key) const;
+
+    // Add (or change) a setting, and answer its position
+    int add(const string& key, const Variant& value, bool internal,
+            bool useAsInitial);
+
+    // Change the setting at the given position, and notify its listeners
+    void set(uInt32 pos, const Variant& value, bool useAsInitial = false);
+
+  private:
+    // Holds all key,value pairs, and the position of each key
+    SettingsArray mySettings;
+    std::unordered_map<string, uInt32> myPositions;
+
+    // Position of each setting with a fixed id
+    uInt32 myIdPos[NumIds];
 
-    // Holds auxiliary key,value pairs that shouldn't be saved on
-    // program exit.
-    SettingsArray myExternalSettings;
+    // The keys of the settings with a fixed id
+    static const char* const ourIdKeys[NumIds];
+
+    struct ListenerEntry {
+      uInt32 pos;
+      const void* owner;
+      Listener listener;
+    };
+    vector<ListenerEntry> myListeners;
 
   private:
     // Following constructors and assignment operators not supported
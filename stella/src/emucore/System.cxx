@@ -108,67 +108,6 @@ void System::clearDirtyPages()
     myPageIsDirtyTable[i] = false;
 }
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8 System::peek(uInt16 addr, uInt8 flags)
-{
-  const PageAccess& access = getPageAccess(addr);
-
-#ifdef DEBUGGER_SUPPORT
-  // Set access type
-  if(access.codeAccessBase)
-    *(access.codeAccessBase + (addr & PAGE_MASK)) |= flags;
-  else
-    access.device->setAccessFlags(addr, flags);
-#endif
-
-  // See if this page uses direct accessing or not
-  uInt8 result;
-  if(access.directPeekBase)
-    result = *(access.directPeekBase + (addr & PAGE_MASK));
-  else
-    result = access.device->peek(addr);
-
-#ifdef DEBUGGER_SUPPORT
-  if(!myDataBusLocked)
-#endif
-    myDataBusState = result;
-
-  return result;
-}
-
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void System::poke(uInt16 addr, uInt8 value, uInt8 flags)
-{
-  uInt16 page = (addr & ADDRESS_MASK) >> PAGE_SHIFT;
-  const PageAccess& access = myPageAccessTable[page];
-
-#ifdef DEBUGGER_SUPPORT
-  // Set access type
-  if (access.codeAccessBase)
-    *(access.codeAccessBase + (addr & PAGE_MASK)) |= flags;
-  else
-    access.device->setAccessFlags(addr, flags);
-#endif
-
-  // See if this page uses direct accessing or not
-  if(access.directPokeBase)
-  {
-    // Since we have direct access to this poke, we can dirty its page
-    *(access.directPokeBase + (addr & PAGE_MASK)) = value;
-    myPageIsDirtyTable[page] = true;
-  }
-  else
-  {
-    // The specific device informs us if the poke succeeded
-    myPageIsDirtyTable[page] = access.device->poke(addr, value);
-  }
-
-#ifdef DEBUGGER_SUPPORT
-  if(!myDataBusLocked)
-#endif
-    myDataBusState = value;
-}
-
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt8 System::getAccessFlags(uInt16 addr) const
 {
@@ -317,6 +317,18 @@ class System : public Serializable
       myPageAccessTable[(addr & ADDRESS_MASK) >> PAGE_SHIFT] = access;
     }
 
+    /**
+      Set the page accessing methods for consecutive pages at once.
+
+      @param addr    The address of the first page
+      @param access  The accessing methods, one entry per page
+      @param pages   The number of pages to set
+    */
+    void setPageAccess(uInt16 addr, const PageAccess* access, uInt16 pages) {
+      std::copy_n(access, pages,
+                  &myPageAccessTable[(addr & ADDRESS_MASK) >> PAGE_SHIFT]);
+    }
+
     /**
       Get the page accessing method for the specified address.
 
@@ -432,4 +444,65 @@ class System : public Serializable
     System& operator=(System&&) = delete;
 };
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline uInt8 System::peek(uInt16 addr, uInt8 flags)
+{
+  const PageAccess& access = getPageAccess(addr);
+
+#ifdef DEBUGGER_SUPPORT
+  // Set access type
+  if(access.codeAccessBase)
+    *(access.codeAccessBase + (addr & PAGE_MASK)) |= flags;
+  else
+    access.device->setAccessFlags(addr, flags);
+#endif
+
+  // See if this page uses direct accessing or not
+  uInt8 result;
+  if(access.directPeekBase)
+    result = *(access.directPeekBase + (addr & PAGE_MASK));
+  else
+    result = access.device->peek(addr);
+
+#ifdef DEBUGGER_SUPPORT
+  if(!myDataBusLocked)
+#endif
+    myDataBusState = result;
+
+  return result;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline void System::poke(uInt16 addr, uInt8 value, uInt8 flags)
+{
+  uInt16 page = (addr & ADDRESS_MASK) >> PAGE_SHIFT;
+  const PageAccess& access = myPageAccessTable[page];
+
+#ifdef DEBUGGER_SUPPORT
+  // Set access type
+  if (access.codeAccessBase)
+    *(access.codeAccessBase + (addr & PAGE_MASK)) |= flags;
+  else
+    access.device->setAccessFlags(addr, flags);
+#endif
+
+  // See if this page uses direct accessing or not
+  if(access.directPokeBase)
+  {
+    // Since we have direct access to this poke, we can dirty its page
+    *(access.directPokeBase + (addr & PAGE_MASK)) = value;
+    myPageIsDirtyTable[page] = true;
+  }
+  else
+  {
+    // The specific device informs us if the poke succeeded
+    myPageIsDirtyTable[page] = access.device->poke(addr, value);
+  }
+
+#ifdef DEBUGGER_SUPPORT
+  if(!myDataBusLocked)
+#endif
+    myDataBusState = value;
+}
+
 #endif
@@ -57,7 +57,8 @@ TIASurface::TIASurface(OSystem& system)
   memset(myRGBFramebuffer, 0, sizeof(myRGBFramebuffer));
 
   // Enable/disable threading in the NTSC TV effects renderer
-  myNTSCFilter.enableThreading(myOSystem.settings().getBool("threads"));
+  myNTSCFilter.enableThreading(myOSystem.settings().getBool("threads"),
+                               myOSystem.settings().getInt("threadcount"));
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -313,8 +314,13 @@ string TIASurface::effectsInfo() const
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void TIASurface::render()
 {
-  uInt32 width  = myTIA->width();
-  uInt32 height = myTIA->height();
+  render(myTIA->frameBuffer(), myTIA->height());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void TIASurface::render(const uInt8* frame, uInt32 height)
+{
+  uInt32 width = myTIA->width();
 
   uInt32 *out, outPitch;
   myTiaSurface->basePtr(out, outPitch);
@@ -323,7 +329,7 @@ void TIASurface::render()
   {
     case Filter::Normal:
     {
-      uInt8* tiaIn = myTIA->frameBuffer();
+      const uInt8* tiaIn = frame;
 
       uInt32 bufofs = 0, screenofsY = 0, pos;
       for(uInt32 y = 0; y < height; ++y)
@@ -341,7 +347,7 @@ void TIASurface::render()
 
     case Filter::Phosphor:
     {
-      uInt8*  tiaIn = myTIA->frameBuffer();
+      const uInt8* tiaIn = frame;
       uInt32* rgbIn = myRGBFramebuffer;
 
       uInt32 bufofs = 0, screenofsY = 0, pos;
@@ -363,17 +369,23 @@ void TIASurface::render()
 
     case Filter::BlarggNormal:
     {
-      myNTSCFilter.render(myTIA->frameBuffer(), width, height, out, outPitch << 2);
+      myNTSCFilter.render(frame, width, height, out, outPitch << 2);
       break;
     }
 
     case Filter::BlarggPhosphor:
     {
-      myNTSCFilter.render(myTIA->frameBuffer(), width, height, out, outPitch << 2, myRGBFramebuffer);
+      myNTSCFilter.render(frame, width, height, out, outPitch << 2, myRGBFramebuffer);
       break;
     }
   }
 
+  redraw();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void TIASurface::redraw()
+{
   // Draw TIA image
   myTiaSurface->setDirty();
   myTiaSurface->render();
@@ -418,16 +430,5 @@ void TIASurface::reRender()
   }
 
   if (myUsePhosphor)
-  {
-    // Draw TIA image
-    myTiaSurface->setDirty();
-    myTiaSurface->render();
-
-    // Draw overlaying scanlines
-    if (myScanlinesEnabled)
-    {
-      mySLineSurface->setDirty();
-      mySLineSurface->render();
-    }
-  }
+    redraw();
 }
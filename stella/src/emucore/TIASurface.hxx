@@ -151,11 +151,25 @@ class TIASurface
     */
     void render();
 
+    /**
+      Draw the given frame instead of the one in the TIA (ie, a copy
+      made by the emulation thread).
+
+      @param frame   The TIA pixels of the frame
+      @param height  The number of lines in the frame
+    */
+    void render(const uInt8* frame, uInt32 height);
+
     /**
       This method renders the current frame again.
     */
     void reRender();
 
+    /**
+      Draw the frame last rendered again, without converting it anew.
+    */
+    void redraw();
+
   private:
     OSystem& myOSystem;
     FrameBuffer& myFB;
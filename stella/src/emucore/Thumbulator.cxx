@@ -22,6 +22,8 @@
 // Code is public domain and used with the author's consent
 //============================================================================
 
+#include <array>
+
 #include "bspf.hxx"
 #include "Base.hxx"
 #include "Cart.hxx"
@@ -59,11 +61,16 @@ Thumbulator::Thumbulator(const uInt16* rom_ptr, uInt16* ram_ptr, bool traponfata
     ram(ram_ptr),
     T1TCR(0),
     T1TC(0),
+    trapOnFatal(traponfatal),
     configuration(configurefor),
-    myCartridge(cartridge)
+    myCartridge(cartridge),
+    decodeTable(buildDecodeTable()),
+    useTranslations(true),
+    ramTranslated(true),
+    liveFlags(~0u)
 {
+  invalidateTranslations();
   setConsoleTiming(ConsoleTiming::ntsc);
-  trapFatalErrors(traponfatal);
   reset();
 }
 
@@ -71,12 +78,11 @@ Thumbulator::Thumbulator(const uInt16* rom_ptr, uInt16* ram_ptr, bool traponfata
 string Thumbulator::run()
 {
   reset();
-  for(;;)
-  {
-    if(execute()) break;
-    if(instructions > 500000) // way more than would otherwise be possible
-      throw runtime_error("instructions > 500000");
-  }
+
+  // The cartridge may have changed RAM since the last call
+  invalidateRamTranslations();
+
+  execute();
 #if defined(THUMB_DISS) || defined(THUMB_DBUG)
   dump_counters();
   cout << statusMsg.str() << endl;
@@ -146,7 +152,9 @@ void Thumbulator::dump_counters()
        << "reads        " << reads << endl
        << "writes       " << writes << endl
        << "memcycles    " << (fetches+reads+writes) << endl
-       << "systick_ints " << systick_ints << endl;
+       << "systick_ints " << systick_ints << endl
+       << "flag_reads   " << flag_reads << endl
+       << "flag_evals   " << flag_evals << endl;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -239,6 +247,8 @@ void Thumbulator::write16(uInt32 addr, uInt32 data)
       addr &= RAMADDMASK;
       addr >>= 1;
       ram[addr] = CONV_DATA(data);
+      if(ramCode[addr].op != Op::untranslated)
+        invalidateRamTranslations();
       return;
 
     case 0xE0000000: //MAMCR
@@ -476,1842 +486,2107 @@ void Thumbulator::write_register(uInt32 reg, uInt32 data)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void Thumbulator::do_zflag(uInt32 x)
+inline void Thumbulator::do_nzflags(uInt32 x)
 {
-  if(x == 0) cpsr |= CPSR_Z;  else cpsr &= ~CPSR_Z;
+  flagResult = x;
+  lazyFlags |= CPSR_N | CPSR_Z;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void Thumbulator::do_nflag(uInt32 x)
+inline void Thumbulator::do_cvflags(uInt32 a, uInt32 b, uInt32 c)
 {
-  if(x & 0x80000000) cpsr|=CPSR_N;  else cpsr&=~CPSR_N;
+  // Dead flags are left alone entirely; they're overwritten before
+  // anything reads them
+  flagA = a;  flagB = b;  flagCarry = c;
+  lazyFlags = (lazyFlags & ~(CPSR_C | CPSR_V)) | (liveFlags & (CPSR_C | CPSR_V));
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void Thumbulator::do_cflag(uInt32 a, uInt32 b, uInt32 c)
+inline void Thumbulator::updateFlags(uInt32 flags)
 {
-  uInt32 rc;
+  flag_reads++;
+  flags &= lazyFlags;
+  if(!flags)
+    return;
 
-  cpsr &= ~CPSR_C;
-  rc = (a & 0x7FFFFFFF) + (b & 0x7FFFFFFF) + c; //carry in
-  rc = (rc >> 31) + (a >> 31) + (b >> 31);      //carry out
-  if(rc & 2)
-    cpsr |= CPSR_C;
-}
+  if(flags & CPSR_N)
+  {
+    if(flagResult & 0x80000000) cpsr |= CPSR_N;  else cpsr &= ~CPSR_N;
+    flag_evals++;
+  }
+  if(flags & CPSR_Z)
+  {
+    if(flagResult == 0) cpsr |= CPSR_Z;  else cpsr &= ~CPSR_Z;
+    flag_evals++;
+  }
+  if(flags & (CPSR_C | CPSR_V))
+  {
+    uInt32 a = flagA, b = flagB, rc, rd;
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void Thumbulator::do_vflag(uInt32 a, uInt32 b, uInt32 c)
-{
-  uInt32 rc, rd;
-
-  cpsr &= ~CPSR_V;
-  rc = (a & 0x7FFFFFFF) + (b & 0x7FFFFFFF) + c; //carry in
-  rc >>= 31; //carry in in lsbit
-  rd = (rc & 1) + ((a >> 31) & 1) + ((b >> 31) & 1); //carry out
-  rd >>= 1; //carry out in lsbit
-  rc = (rc^rd) & 1; //if carry in != carry out then signed overflow
-  if(rc)
-    cpsr |= CPSR_V;
+    rc = (a & 0x7FFFFFFF) + (b & 0x7FFFFFFF) + flagCarry; //carry in
+    rc >>= 31; //carry in in lsbit
+    rd = (rc & 1) + ((a >> 31) & 1) + ((b >> 31) & 1); //carry out
+    if(flags & CPSR_C)
+    {
+      if(rd & 2) cpsr |= CPSR_C;  else cpsr &= ~CPSR_C;
+      flag_evals++;
+    }
+    if(flags & CPSR_V)
+    {
+      rd >>= 1; //carry out in lsbit
+      rc = (rc^rd) & 1; //if carry in != carry out then signed overflow
+      if(rc) cpsr |= CPSR_V;  else cpsr &= ~CPSR_V;
+      flag_evals++;
+    }
+  }
+  lazyFlags &= ~flags;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void Thumbulator::do_cflag_bit(uInt32 x)
+inline void Thumbulator::do_cflag_bit(uInt32 x)
 {
+  lazyFlags &= ~CPSR_C;
   if(x) cpsr |= CPSR_C;  else cpsr &= ~CPSR_C;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void Thumbulator::do_vflag_bit(uInt32 x)
+inline void Thumbulator::do_vflag_bit(uInt32 x)
 {
+  lazyFlags &= ~CPSR_V;
   if(x) cpsr |= CPSR_V;  else cpsr &= ~CPSR_V;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-int Thumbulator::execute()
+Thumbulator::Op Thumbulator::decodeInstructionWord(uInt16 inst)
 {
-  uInt32 pc, sp, inst, ra, rb, rc, rm, rd, rn, rs, op;
+  // Patterns are tested in the order execute() originally tested them, so
+  // that overlapping encodings (ADD(1)/MOV(2), B(1)/SWI, B(2)/BL) resolve
+  // to the same handler
+  static constexpr struct { uInt16 mask, pattern; Op op; } ourPatterns[] = {
+    { 0xFFC0, 0x4140, Op::adc }, { 0xFE00, 0x1C00, Op::add1 }, { 0xF800, 0x3000, Op::add2 },
+    { 0xFE00, 0x1800, Op::add3 }, { 0xFF00, 0x4400, Op::add4 }, { 0xF800, 0xA000, Op::add5 },
+    { 0xF800, 0xA800, Op::add6 }, { 0xFF80, 0xB000, Op::add7 }, { 0xFFC0, 0x4000, Op::and_ },
+    { 0xF800, 0x1000, Op::asr1 }, { 0xFFC0, 0x4100, Op::asr2 }, { 0xF000, 0xD000, Op::b1 },
+    { 0xF800, 0xE000, Op::b2 }, { 0xFFC0, 0x4380, Op::bic }, { 0xFF00, 0xBE00, Op::bkpt },
+    { 0xE000, 0xE000, Op::bl }, { 0xFF87, 0x4780, Op::blx2 }, { 0xFF87, 0x4700, Op::bx },
+    { 0xFFC0, 0x42C0, Op::cmn }, { 0xF800, 0x2800, Op::cmp1 }, { 0xFFC0, 0x4280, Op::cmp2 },
+    { 0xFF00, 0x4500, Op::cmp3 }, { 0xFFE8, 0xB660, Op::cps }, { 0xFFC0, 0x4600, Op::cpy },
+    { 0xFFC0, 0x4040, Op::eor }, { 0xF800, 0xC800, Op::ldmia }, { 0xF800, 0x6800, Op::ldr1 },
+    { 0xFE00, 0x5800, Op::ldr2 }, { 0xF800, 0x4800, Op::ldr3 }, { 0xF800, 0x9800, Op::ldr4 },
+    { 0xF800, 0x7800, Op::ldrb1 }, { 0xFE00, 0x5C00, Op::ldrb2 }, { 0xF800, 0x8800, Op::ldrh1 },
+    { 0xFE00, 0x5A00, Op::ldrh2 }, { 0xFE00, 0x5600, Op::ldrsb }, { 0xFE00, 0x5E00, Op::ldrsh },
+    { 0xF800, 0x0000, Op::lsl1 }, { 0xFFC0, 0x4080, Op::lsl2 }, { 0xF800, 0x0800, Op::lsr1 },
+    { 0xFFC0, 0x40C0, Op::lsr2 }, { 0xF800, 0x2000, Op::mov1 }, { 0xFFC0, 0x1C00, Op::mov2 },
+    { 0xFF00, 0x4600, Op::mov3 }, { 0xFFC0, 0x4340, Op::mul }, { 0xFFC0, 0x43C0, Op::mvn },
+    { 0xFFC0, 0x4240, Op::neg }, { 0xFFC0, 0x4300, Op::orr }, { 0xFE00, 0xBC00, Op::pop },
+    { 0xFE00, 0xB400, Op::push }, { 0xFFC0, 0xBA00, Op::rev }, { 0xFFC0, 0xBA40, Op::rev16 },
+    { 0xFFC0, 0xBAC0, Op::revsh }, { 0xFFC0, 0x41C0, Op::ror }, { 0xFFC0, 0x4180, Op::sbc },
+    { 0xFFF7, 0xB650, Op::setend }, { 0xF800, 0xC000, Op::stmia }, { 0xF800, 0x6000, Op::str1 },
+    { 0xFE00, 0x5000, Op::str2 }, { 0xF800, 0x9000, Op::str3 }, { 0xF800, 0x7000, Op::strb1 },
+    { 0xFE00, 0x5400, Op::strb2 }, { 0xF800, 0x8000, Op::strh1 }, { 0xFE00, 0x5200, Op::strh2 },
+    { 0xFE00, 0x1E00, Op::sub1 }, { 0xF800, 0x3800, Op::sub2 }, { 0xFE00, 0x1A00, Op::sub3 },
+    { 0xFF80, 0xB080, Op::sub4 }, { 0xFF00, 0xDF00, Op::swi }, { 0xFFC0, 0xB240, Op::sxtb },
+    { 0xFFC0, 0xB200, Op::sxth }, { 0xFFC0, 0x4200, Op::tst }, { 0xFFC0, 0xB2C0, Op::uxtb },
+    { 0xFFC0, 0xB280, Op::uxth }
+  };
+
+  for(const auto& p: ourPatterns)
+  {
+    if((inst & p.mask) != p.pattern)
+      continue;
+
+    // ADD(1) with a zero immediate is handled as MOV(2)
+    if(p.op == Op::add1 && ((inst >> 6) & 0x7) == 0)
+      continue;
+    // Conditions 0xE and 0xF aren't branches; 0xDFxx is SWI, 0xDExx undefined
+    if(p.op == Op::b1 && ((inst >> 8) & 0xF) >= 0xE)
+      continue;
+
+    return p.op;
+  }
+  return Op::invalid;
+}
 
-  pc = read_register(15);
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const Thumbulator::Op* Thumbulator::buildDecodeTable()
+{
+  // The table only depends on the instruction word, so it's built once and
+  // shared (read-only) between all instances
+  static const std::array<Op, 0x10000> table = [] {
+    std::array<Op, 0x10000> t;
+    for(uInt32 inst = 0; inst < t.size(); ++inst)
+      t[inst] = decodeInstructionWord(inst);
+    return t;
+  }();
+
+  return table.data();
+}
 
-#if 0
-  if(handler_mode)
-  {
-    if((pc & 0xF0000000) == 0xF0000000)
-    {
-      uInt32 sp = read_register(13);
-      handler_mode = false;
-      write_register(0,  read32(sp)); sp += 4;
-      write_register(1,  read32(sp)); sp += 4;
-      write_register(2,  read32(sp)); sp += 4;
-      write_register(3,  read32(sp)); sp += 4;
-      write_register(12, read32(sp)); sp += 4;
-      write_register(14, read32(sp)); sp += 4;
-      pc = read32(sp); sp += 4;
-      cpsr = read32(sp); sp += 4;
-      write_register(13, sp);
-    }
-  }
-  if(systick_ctrl & 1)
-  {
-    if(systick_count)
-    {
-      systick_count--;
-    }
-    else
-    {
-      systick_count = systick_reload;
-      systick_ctrl |= 0x00010000;
-    }
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool Thumbulator::endsBlock(Op op, uInt16 inst)
+{
+  switch(op)
+  {
+    // Anything which may change the PC or stop execution
+    case Op::b1:
+    case Op::b2:
+    case Op::bkpt:
+    case Op::bl:
+    case Op::blx2:
+    case Op::bx:
+    case Op::cps:
+    case Op::setend:
+    case Op::swi:
+    case Op::invalid:
+      return true;
+
+    // High register operations, with the PC as destination
+    case Op::add4:
+    case Op::cpy:
+    case Op::mov3:
+      return ((inst & 0x7) | ((inst >> 4) & 0x8)) == 15;
+
+    // POP with the PC in the register list
+    case Op::pop:
+      return inst & 0x100;
+
+    default:
+      return false;
   }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Thumbulator::flagUsage(Op op, uInt8& read, uInt8& written)
+{
+  // Flags in upper nibble format (CPSR >> 28); only flags which an
+  // instruction *always* sets count as written
+  constexpr uInt8 N = 0x8, Z = 0x4, C = 0x2, V = 0x1;
 
-  if((systick_ctrl & 3) == 3)
+  read = written = 0;
+  switch(op)
   {
-    if(systick_ctrl & 0x00010000)
-    {
-      if(!handler_mode)
-      {
-        systick_ints++;
-        uInt32 sp = read_register(13);
-        sp -= 4; write32(sp, cpsr);
-        sp -= 4; write32(sp, pc);
-        sp -= 4; write32(sp, read_register(14));
-        sp -= 4; write32(sp, read_register(12));
-        sp -= 4; write32(sp, read_register(3));
-        sp -= 4; write32(sp, read_register(2));
-        sp -= 4; write32(sp, read_register(1));
-        sp -= 4; write32(sp, read_register(0));
-        write_register(13, sp);
-        pc = fetch32(0x0000003C); //systick vector
-        pc += 2;
-        //write_register(14, 0xFFFFFF00);
-        write_register(14, 0xFFFFFFF9);
+    case Op::adc:
+    case Op::sbc:
+      read = C;
+      written = N | Z | C | V;
+      break;
 
-        handler_mode = true;
-      }
-    }
-  }
-#endif
+    case Op::add1:  case Op::add2:  case Op::add3:  case Op::cmn:
+    case Op::cmp1:  case Op::cmp2:  case Op::cmp3:  case Op::mov2:
+    case Op::neg:   case Op::sub1:  case Op::sub2:  case Op::sub3:
+      written = N | Z | C | V;
+      break;
 
-  inst = fetch16(pc-2);
-  pc += 2;
-  write_register(15, pc);
-  DO_DISS(statusMsg << Base::HEX8 << (pc-5) << ": " << Base::HEX4 << inst << " ");
+    // Shifts leave C unchanged for a shift amount of zero
+    case Op::and_:  case Op::asr1:  case Op::asr2:  case Op::bic:
+    case Op::eor:   case Op::lsl1:  case Op::lsl2:  case Op::lsr1:
+    case Op::lsr2:  case Op::mov1:  case Op::mul:   case Op::mvn:
+    case Op::orr:   case Op::ror:   case Op::tst:
+      written = N | Z;
+      break;
 
-  instructions++;
+    case Op::b1:
+    case Op::swi:
+      read = N | Z | C | V;
+      break;
 
-  //ADC
-  if((inst & 0xFFC0) == 0x4140)
-  {
-    rd = (inst >> 0) & 0x07;
-    rm = (inst >> 3) & 0x07;
-    DO_DISS(statusMsg << "adc r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rd);
-    rb = read_register(rm);
-    rc = ra + rb;
-    if(cpsr & CPSR_C)
-      rc++;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    if(cpsr & CPSR_C) { do_cflag(ra, rb, 1); do_vflag(ra, rb, 1); }
-    else              { do_cflag(ra, rb, 0); do_vflag(ra, rb, 0); }
-    return 0;
+    default:
+      break;
   }
+}
 
-  //ADD(1) small immediate two registers
-  if((inst & 0xFE00) == 0x1C00)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rb = (inst >> 6) & 0x7;
-    if(rb)
-    {
-      DO_DISS(statusMsg << "adds r" << dec << rd << ",r" << dec << rn << ","
-                        << "#0x" << Base::HEX2 << rb << endl);
-      ra = read_register(rn);
-      rc = ra + rb;
-      //fprintf(stderr,"0x%08X = 0x%08X + 0x%08X\n",rc,ra,rb);
-      write_register(rd, rc);
-      do_nflag(rc);
-      do_zflag(rc);
-      do_cflag(ra, rb, 0);
-      do_vflag(ra, rb, 0);
-      return 0;
-    }
-    else
-    {
-      //this is a mov
-    }
-  }
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Thumbulator::cacheTranslations(bool enable)
+{
+  useTranslations = enable;
+  invalidateTranslations();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Thumbulator::invalidateTranslations()
+{
+  for(auto& uop: romCode)
+    uop.op = Op::untranslated;
 
-  //ADD(2) big immediate one register
-  if((inst & 0xF800) == 0x3000)
+  ramTranslated = true;
+  invalidateRamTranslations();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Thumbulator::invalidateRamTranslations()
+{
+  // Flag liveness depends on the instructions that follow, so a single
+  // modified instruction invalidates everything translated from RAM
+  if(ramTranslated)
   {
-    rb = (inst >> 0) & 0xFF;
-    rd = (inst >> 8) & 0x7;
-    DO_DISS(statusMsg << "adds r" << dec << rd << ",#0x" << Base::HEX2 << rb << endl);
-    ra = read_register(rd);
-    rc = ra + rb;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag(ra, rb, 0);
-    do_vflag(ra, rb, 0);
-    return 0;
+    for(auto& uop: ramCode)
+      uop.op = Op::untranslated;
+    ramTranslated = false;
   }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline const Thumbulator::MicroOp* Thumbulator::translatedInstruction(uInt32 addr)
+{
+  MicroOp* code;
+  const uInt16* mem;
+  uInt32 size;
 
-  //ADD(3) three registers
-  if((inst & 0xFE00) == 0x1800)
+  switch(addr & 0xF0000000)
   {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rm = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "adds r" << dec << rd << ",r" << dec << rn << ",r" << rm << endl);
-    ra = read_register(rn);
-    rb = read_register(rm);
-    rc = ra + rb;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag(ra, rb, 0);
-    do_vflag(ra, rb, 0);
-    return 0;
+    case 0x00000000: //ROM
+      addr &= ROMADDMASK;
+      if(addr < 0x50)
+        return nullptr;  // let fetch16 deal with it
+
+      code = romCode;  mem = rom;  size = ROMSIZE/2;
+      break;
+
+    case 0x40000000: //RAM
+      addr &= RAMADDMASK;
+      code = ramCode;  mem = ram;  size = RAMSIZE/2;
+      ramTranslated = true;
+      break;
+
+    default:
+      return nullptr;
   }
 
-  //ADD(4) two registers one or both high no flags
-  if((inst & 0xFF00) == 0x4400)
+  addr >>= 1;
+  if(code[addr].op == Op::untranslated)
+    translateBlock(code, mem, addr, size);
+
+  return &code[addr];
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Thumbulator::translateBlock(MicroOp* code, const uInt16* mem,
+                                 uInt32 index, uInt32 size)
+{
+  constexpr uInt32 MAX_BLOCK_SIZE = 64;
+
+  // Decode forward up to (and including) the first instruction that may
+  // leave the straight line
+  uInt32 end = index;
+  bool chained = false;
+  for(;;)
   {
-    if((inst >> 6) & 3)
-    {
-      //UNPREDICTABLE
-    }
-    rd  = (inst >> 0) & 0x7;
-    rd |= (inst >> 4) & 0x8;
-    rm  = (inst >> 3) & 0xF;
-    DO_DISS(statusMsg << "add r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rd);
-    rb = read_register(rm);
-    rc = ra + rb;
-    if(rd == 15)
-    {
-      if((rc & 1) == 0)
-        fatalError("add pc", pc, rc, " produced an arm address");
+    uInt32 inst = CONV_RAMROM(mem[end]);
+    Op op = decodeTable[inst];
+    code[end].inst = inst;
+    code[end++].op = op;
 
-      rc &= ~1; //write_register may do this as well
-      rc += 2;  //The program counter is special
+    if(endsBlock(op, inst) || end == size || end - index == MAX_BLOCK_SIZE)
+      break;
+    if(code[end].op != Op::untranslated)
+    {
+      chained = true;  // ran into an earlier translation
+      break;
     }
-    //fprintf(stderr,"0x%08X = 0x%08X + 0x%08X\n",rc,ra,rb);
-    write_register(rd, rc);
-    return 0;
   }
 
-  //ADD(5) rd = pc plus immediate
-  if((inst & 0xF800) == 0xA000)
+  // Then propagate flag liveness backwards; everything is considered live
+  // at the end of the block, unless it continues into an earlier one
+  uInt8 live = 0xF, read, written;
+  if(chained)
   {
-    rb = (inst >> 0) & 0xFF;
-    rd = (inst >> 8) & 0x7;
-    rb <<= 2;
-    DO_DISS(statusMsg << "add r" << dec << rd << ",PC,#0x" << Base::HEX2 << rb << endl);
-    ra = read_register(15);
-    rc = (ra & (~3u)) + rb;
-    write_register(rd, rc);
-    return 0;
+    flagUsage(code[end].op, read, written);
+    live = (code[end].liveFlags & ~written) | read;
   }
-
-  //ADD(6) rd = sp plus immediate
-  if((inst & 0xF800) == 0xA800)
+  for(uInt32 i = end; i-- > index; )
   {
-    rb = (inst >> 0) & 0xFF;
-    rd = (inst >> 8) & 0x7;
-    rb <<= 2;
-    DO_DISS(statusMsg << "add r" << dec << rd << ",SP,#0x" << Base::HEX2 << rb << endl);
-    ra = read_register(13);
-    rc = ra + rb;
-    write_register(rd, rc);
-    return 0;
+    flagUsage(code[i].op, read, written);
+    code[i].liveFlags = live;
+    live = (live & ~written) | read;
   }
+}
 
-  //ADD(7) sp plus immediate
-  if((inst & 0xFF80) == 0xB000)
-  {
-    rb = (inst >> 0) & 0x7F;
-    rb <<= 2;
-    DO_DISS(statusMsg << "add SP,#0x" << Base::HEX2 << rb << endl);
-    ra = read_register(13);
-    rc = ra + rb;
-    write_register(13, rc);
-    return 0;
-  }
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+int Thumbulator::execute()
+{
+  uInt32 pc, sp, inst, ra, rb, rc, rm, rd, rn, rs, op;
 
-  //AND
-  if((inst & 0xFFC0) == 0x4000)
+  // Instructions are executed back-to-back, until one of them stops
+  // execution (or an exception is thrown)
+  for(;;)
   {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "ands r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rd);
-    rb = read_register(rm);
-    rc = ra & rb;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+    if(instructions > 500000) // way more than would otherwise be possible
+      throw runtime_error("instructions > 500000");
 
-  //ASR(1) two register immediate
-  if((inst & 0xF800) == 0x1000)
-  {
-    rd = (inst >> 0) & 0x07;
-    rm = (inst >> 3) & 0x07;
-    rb = (inst >> 6) & 0x1F;
-    DO_DISS(statusMsg << "asrs r" << dec << rd << ",r" << dec << rm << ",#0x" << Base::HEX2 << rb << endl);
-    rc = read_register(rm);
-    if(rb == 0)
+    pc = read_register(15);
+
+#if 0
+    if(handler_mode)
+    {
+      if((pc & 0xF0000000) == 0xF0000000)
+      {
+        uInt32 sp = read_register(13);
+        handler_mode = false;
+        write_register(0,  read32(sp)); sp += 4;
+        write_register(1,  read32(sp)); sp += 4;
+        write_register(2,  read32(sp)); sp += 4;
+        write_register(3,  read32(sp)); sp += 4;
+        write_register(12, read32(sp)); sp += 4;
+        write_register(14, read32(sp)); sp += 4;
+        pc = read32(sp); sp += 4;
+        cpsr = read32(sp); sp += 4;
+        lazyFlags = 0;
+        write_register(13, sp);
+      }
+    }
+    if(systick_ctrl & 1)
     {
-      if(rc & 0x80000000)
+      if(systick_count)
       {
-        do_cflag_bit(1);
-        rc = ~0;
+        systick_count--;
       }
       else
       {
-        do_cflag_bit(0);
-        rc = 0;
+        systick_count = systick_reload;
+        systick_ctrl |= 0x00010000;
       }
     }
-    else
-    {
-      do_cflag_bit(rc & (1 << (rb-1)));
-      ra = rc & 0x80000000;
-      rc >>= rb;
-      if(ra) //asr, sign is shifted in
-        rc |= (~0u) << (32-rb);
-    }
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
 
-  //ASR(2) two register
-  if((inst & 0xFFC0) == 0x4100)
-  {
-    rd = (inst >> 0) & 0x07;
-    rs = (inst >> 3) & 0x07;
-    DO_DISS(statusMsg << "asrs r" << dec << rd << ",r" << dec << rs << endl);
-    rc = read_register(rd);
-    rb = read_register(rs);
-    rb &= 0xFF;
-    if(rb == 0)
-    {
-    }
-    else if(rb < 32)
+    if((systick_ctrl & 3) == 3)
     {
-      do_cflag_bit(rc & (1 << (rb-1)));
-      ra = rc & 0x80000000;
-      rc >>= rb;
-      if(ra) //asr, sign is shifted in
+      if(systick_ctrl & 0x00010000)
       {
-        rc |= (~0u) << (32-rb);
+        if(!handler_mode)
+        {
+          systick_ints++;
+          uInt32 sp = read_register(13);
+          updateFlags();
+          sp -= 4; write32(sp, cpsr);
+          sp -= 4; write32(sp, pc);
+          sp -= 4; write32(sp, read_register(14));
+          sp -= 4; write32(sp, read_register(12));
+          sp -= 4; write32(sp, read_register(3));
+          sp -= 4; write32(sp, read_register(2));
+          sp -= 4; write32(sp, read_register(1));
+          sp -= 4; write32(sp, read_register(0));
+          write_register(13, sp);
+          pc = fetch32(0x0000003C); //systick vector
+          pc += 2;
+          //write_register(14, 0xFFFFFF00);
+          write_register(14, 0xFFFFFFF9);
+
+          handler_mode = true;
+        }
       }
     }
-    else
+#endif
+
+    Op opcode;
+    const MicroOp* uop = useTranslations ? translatedInstruction(pc-2) : nullptr;
+    if(uop)
     {
-      if(rc & 0x80000000)
-      {
-        do_cflag_bit(1);
-        rc = (~0u);
-      }
-      else
-      {
-        do_cflag_bit(0);
-        rc = 0;
-      }
+      fetches++;
+      inst = uop->inst;
+      opcode = uop->op;
+      liveFlags = uInt32(uop->liveFlags) << 28;
     }
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
-
-  //B(1) conditional branch
-  if((inst & 0xF000) == 0xD000)
-  {
-    rb = (inst >> 0) & 0xFF;
-    if(rb & 0x80)
-      rb |= (~0u) << 8;
-    op=(inst >> 8) & 0xF;
-    rb <<= 1;
-    rb += pc;
-    rb += 2;
-    switch(op)
+    else
     {
-      case 0x0: //b eq  z set
-        DO_DISS(statusMsg << "beq 0x" << Base::HEX8 << (rb-3) << endl);
-        if(cpsr & CPSR_Z)
-          write_register(15, rb);
-        return 0;
+      inst = fetch16(pc-2);
+      opcode = decodeTable[inst];
+      liveFlags = ~0u;
+    }
+    pc += 2;
+    write_register(15, pc);
+    DO_DISS(statusMsg << Base::HEX8 << (pc-5) << ": " << Base::HEX4 << inst << " ");
 
-      case 0x1: //b ne  z clear
-        DO_DISS(statusMsg << "bne 0x" << Base::HEX8 << (rb-3) << endl);
-        if(!(cpsr & CPSR_Z))
-          write_register(15, rb);
-        return 0;
+    instructions++;
 
-      case 0x2: //b cs c set
-        DO_DISS(statusMsg << "bcs 0x" << Base::HEX8 << (rb-3) << endl);
+    switch(opcode)
+    {
+      //ADC
+      case Op::adc:
+      {
+        rd = (inst >> 0) & 0x07;
+        rm = (inst >> 3) & 0x07;
+        DO_DISS(statusMsg << "adc r" << dec << rd << ",r" << dec << rm << endl);
+        updateFlags();
+        ra = read_register(rd);
+        rb = read_register(rm);
+        rc = ra + rb;
         if(cpsr & CPSR_C)
-          write_register(15, rb);
-        return 0;
-
-      case 0x3: //b cc c clear
-        DO_DISS(statusMsg << "bcc 0x" << Base::HEX8 << (rb-3) << endl);
-        if(!(cpsr & CPSR_C))
-          write_register(15, rb);
-        return 0;
-
-      case 0x4: //b mi n set
-        DO_DISS(statusMsg << "bmi 0x" << Base::HEX8 << (rb-3) << endl);
-        if(cpsr & CPSR_N)
-          write_register(15, rb);
-        return 0;
-
-      case 0x5: //b pl n clear
-        DO_DISS(statusMsg << "bpl 0x" << Base::HEX8 << (rb-3) << endl);
-        if(!(cpsr & CPSR_N))
-          write_register(15, rb);
-        return 0;
-
-      case 0x6: //b vs v set
-        DO_DISS(statusMsg << "bvs 0x" << Base::HEX8 << (rb-3) << endl);
-        if(cpsr & CPSR_V)
-          write_register(15,rb);
-        return 0;
-
-      case 0x7: //b vc v clear
-        DO_DISS(statusMsg << "bvc 0x" << Base::HEX8 << (rb-3) << endl);
-        if(!(cpsr & CPSR_V))
-          write_register(15, rb);
-        return 0;
+          rc++;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        if(cpsr & CPSR_C) do_cvflags(ra, rb, 1);
+        else              do_cvflags(ra, rb, 0);
+        continue;
+      }
 
-      case 0x8: //b hi c set z clear
-        DO_DISS(statusMsg << "bhi 0x" << Base::HEX8 << (rb-3) << endl);
-        if((cpsr & CPSR_C) && (!(cpsr & CPSR_Z)))
-          write_register(15, rb);
-        return 0;
+      //ADD(1) small immediate two registers
+      case Op::add1:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rb = (inst >> 6) & 0x7;
+        if(rb)
+        {
+          DO_DISS(statusMsg << "adds r" << dec << rd << ",r" << dec << rn << ","
+                            << "#0x" << Base::HEX2 << rb << endl);
+          ra = read_register(rn);
+          rc = ra + rb;
+          //fprintf(stderr,"0x%08X = 0x%08X + 0x%08X\n",rc,ra,rb);
+          write_register(rd, rc);
+          do_nzflags(rc);
+          do_cvflags(ra, rb, 0);
+          continue;
+        }
+        else
+        {
+          //this is a mov
+        }
+      }
+      break;
 
-      case 0x9: //b ls c clear or z set
-        DO_DISS(statusMsg << "bls 0x" << Base::HEX8 << (rb-3) << endl);
-        if((cpsr & CPSR_Z) || (!(cpsr & CPSR_C)))
-          write_register(15, rb);
-        return 0;
-
-      case 0xA: //b ge N == V
-        DO_DISS(statusMsg << "bge 0x" << Base::HEX8 << (rb-3) << endl);
-        ra = 0;
-        if(  (cpsr & CPSR_N)  &&   (cpsr & CPSR_V) ) ra++;
-        if((!(cpsr & CPSR_N)) && (!(cpsr & CPSR_V))) ra++;
-        if(ra)
-          write_register(15, rb);
-        return 0;
-
-      case 0xB: //b lt N != V
-        DO_DISS(statusMsg << "blt 0x" << Base::HEX8 << (rb-3) << endl);
-        ra = 0;
-        if((!(cpsr & CPSR_N)) && (cpsr & CPSR_V)) ra++;
-        if((!(cpsr & CPSR_V)) && (cpsr & CPSR_N)) ra++;
-        if(ra)
-          write_register(15, rb);
-        return 0;
-
-      case 0xC: //b gt Z==0 and N == V
-        DO_DISS(statusMsg << "bgt 0x" << Base::HEX8 << (rb-3) << endl);
-        ra = 0;
-        if(  (cpsr & CPSR_N)  &&   (cpsr & CPSR_V) ) ra++;
-        if((!(cpsr & CPSR_N)) && (!(cpsr & CPSR_V))) ra++;
-        if(cpsr & CPSR_Z) ra = 0;
-        if(ra)
-          write_register(15, rb);
-        return 0;
-
-      case 0xD: //b le Z==1 or N != V
-        DO_DISS(statusMsg << "ble 0x" << Base::HEX8 << (rb-3) << endl);
-        ra = 0;
-        if((!(cpsr & CPSR_N)) && (cpsr & CPSR_V)) ra++;
-        if((!(cpsr & CPSR_V)) && (cpsr & CPSR_N)) ra++;
-        if(cpsr & CPSR_Z) ra++;
-        if(ra)
-          write_register(15, rb);
-        return 0;
+      //ADD(2) big immediate one register
+      case Op::add2:
+      {
+        rb = (inst >> 0) & 0xFF;
+        rd = (inst >> 8) & 0x7;
+        DO_DISS(statusMsg << "adds r" << dec << rd << ",#0x" << Base::HEX2 << rb << endl);
+        ra = read_register(rd);
+        rc = ra + rb;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        do_cvflags(ra, rb, 0);
+        continue;
+      }
 
-      case 0xE:
-        //undefined instruction
-        break;
+      //ADD(3) three registers
+      case Op::add3:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rm = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "adds r" << dec << rd << ",r" << dec << rn << ",r" << rm << endl);
+        ra = read_register(rn);
+        rb = read_register(rm);
+        rc = ra + rb;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        do_cvflags(ra, rb, 0);
+        continue;
+      }
 
-      case 0xF:
-        //swi
-        break;
-    }
-  }
+      //ADD(4) two registers one or both high no flags
+      case Op::add4:
+      {
+        if((inst >> 6) & 3)
+        {
+          //UNPREDICTABLE
+        }
+        rd  = (inst >> 0) & 0x7;
+        rd |= (inst >> 4) & 0x8;
+        rm  = (inst >> 3) & 0xF;
+        DO_DISS(statusMsg << "add r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rd);
+        rb = read_register(rm);
+        rc = ra + rb;
+        if(rd == 15)
+        {
+          if((rc & 1) == 0)
+            fatalError("add pc", pc, rc, " produced an arm address");
 
-  //B(2) unconditional branch
-  if((inst & 0xF800) == 0xE000)
-  {
-    rb = (inst >> 0) & 0x7FF;
-    if(rb & (1 << 10))
-      rb |= (~0u) << 11;
-    rb <<= 1;
-    rb += pc;
-    rb += 2;
-    DO_DISS(statusMsg << "B 0x" << Base::HEX8 << (rb-3) << endl);
-    write_register(15, rb);
-    return 0;
-  }
+          rc &= ~1; //write_register may do this as well
+          rc += 2;  //The program counter is special
+        }
+        //fprintf(stderr,"0x%08X = 0x%08X + 0x%08X\n",rc,ra,rb);
+        write_register(rd, rc);
+        continue;
+      }
 
-  //BIC
-  if((inst & 0xFFC0) == 0x4380)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "bics r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rd);
-    rb = read_register(rm);
-    rc = ra & (~rb);
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+      //ADD(5) rd = pc plus immediate
+      case Op::add5:
+      {
+        rb = (inst >> 0) & 0xFF;
+        rd = (inst >> 8) & 0x7;
+        rb <<= 2;
+        DO_DISS(statusMsg << "add r" << dec << rd << ",PC,#0x" << Base::HEX2 << rb << endl);
+        ra = read_register(15);
+        rc = (ra & (~3u)) + rb;
+        write_register(rd, rc);
+        continue;
+      }
 
-  //BKPT
-  if((inst & 0xFF00) == 0xBE00)
-  {
-    rb = (inst >> 0) & 0xFF;
-    statusMsg << "bkpt 0x" << Base::HEX2 << rb << endl;
-    return 1;
-  }
+      //ADD(6) rd = sp plus immediate
+      case Op::add6:
+      {
+        rb = (inst >> 0) & 0xFF;
+        rd = (inst >> 8) & 0x7;
+        rb <<= 2;
+        DO_DISS(statusMsg << "add r" << dec << rd << ",SP,#0x" << Base::HEX2 << rb << endl);
+        ra = read_register(13);
+        rc = ra + rb;
+        write_register(rd, rc);
+        continue;
+      }
 
-  //BL/BLX(1)
-  if((inst & 0xE000) == 0xE000) //BL,BLX
-  {
-    if((inst & 0x1800) == 0x1000) //H=b10
-    {
-      DO_DISS(statusMsg << endl);
-      rb = inst & ((1 << 11) - 1);
-      if(rb & 1<<10) rb |= (~((1 << 11) - 1)); //sign extend
-      rb <<= 12;
-      rb += pc;
-      write_register(14, rb);
-      return 0;
-    }
-    else if((inst & 0x1800) == 0x1800) //H=b11
-    {
-      //branch to thumb
-      rb = read_register(14);
-      rb += (inst & ((1 << 11) - 1)) << 1;;
-      rb += 2;
-      DO_DISS(statusMsg << "bl 0x" << Base::HEX8 << (rb-3) << endl);
-      write_register(14, (pc-2) | 1);
-      write_register(15, rb);
-      return 0;
-    }
-    else if((inst & 0x1800) == 0x0800) //H=b01
-    {
-      //fprintf(stderr,"cannot branch to arm 0x%08X 0x%04X\n",pc,inst);
-      // fxq: this should exit the code without having to detect it
-      rb = read_register(14);
-      rb += (inst & ((1 << 11) - 1)) << 1;;
-      rb &= 0xFFFFFFFC;
-      rb += 2;
-      DO_DISS(statusMsg << "bl 0x" << Base::HEX8 << (rb-3) << endl);
-      write_register(14, (pc-2) | 1);
-      write_register(15, rb);
-      return 0;
-    }
-  }
+      //ADD(7) sp plus immediate
+      case Op::add7:
+      {
+        rb = (inst >> 0) & 0x7F;
+        rb <<= 2;
+        DO_DISS(statusMsg << "add SP,#0x" << Base::HEX2 << rb << endl);
+        ra = read_register(13);
+        rc = ra + rb;
+        write_register(13, rc);
+        continue;
+      }
 
-  //BLX(2)
-  if((inst & 0xFF87) == 0x4780)
-  {
-    rm = (inst >> 3) & 0xF;
-    DO_DISS(statusMsg << "blx r" << dec << rm << endl);
-    rc = read_register(rm);
-    //fprintf(stderr,"blx r%u 0x%X 0x%X\n",rm,rc,pc);
-    rc += 2;
-    if(rc & 1)
-    {
-      write_register(14, (pc-2) | 1);
-      rc &= ~1;
-      write_register(15, rc);
-      return 0;
-    }
-    else
-    {
-      //fprintf(stderr,"cannot branch to arm 0x%08X 0x%04X\n",pc,inst);
-      // fxq: this could serve as exit code
-      return 1;
-    }
-  }
+      //AND
+      case Op::and_:
+      {
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "ands r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rd);
+        rb = read_register(rm);
+        rc = ra & rb;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-  //BX
-  if((inst & 0xFF87) == 0x4700)
-  {
-    rm = (inst >> 3) & 0xF;
-    DO_DISS(statusMsg << "bx r" << dec << rm << endl);
-    rc = read_register(rm);
-    rc += 2;
-    //fprintf(stderr,"bx r%u 0x%X 0x%X\n",rm,rc,pc);
-    if(rc & 1)
-    {
-      // branch to odd address denotes 16 bit ARM code
-      rc &= ~1;
-      write_register(15, rc);
-      return 0;
-    }
-    else
-    {
-      // branch to even address denotes 32 bit ARM code, which the Thumbulator
-      // class does not support. So capture relavent information and hand it
-      // off to the Cartridge class for it to handle.
-
-      bool handled = false;
-
-      switch(configuration)
-      {
-        case ConfigureFor::BUS:
-          // this subroutine interface is used in the BUS driver,
-          // it starts at address 0x000006d8
-          // _SetNote:
-          //   ldr     r4, =NoteStore
-          //   bx      r4   // bx instruction at 0x000006da
-          // _ResetWave:
-          //   ldr     r4, =ResetWaveStore
-          //   bx      r4   // bx instruction at 0x000006de
-          // _GetWavePtr:
-          //   ldr     r4, =WavePtrFetch
-          //   bx      r4   // bx instruction at 0x000006e2
-          // _SetWaveSize:
-          //   ldr     r4, =WaveSizeStore
-          //   bx      r4   // bx instruction at 0x000006e6
-
-          // address to test for is + 4 due to pipelining
-
-#define BUS_SetNote     (0x000006da + 4)
-#define BUS_ResetWave   (0x000006de + 4)
-#define BUS_GetWavePtr  (0x000006e2 + 4)
-#define BUS_SetWaveSize (0x000006e6 + 4)
-
-          if      (pc == BUS_SetNote)
-          {
-            myCartridge->thumbCallback(0, read_register(2), read_register(3));
-            handled = true;
-          }
-          else if (pc == BUS_ResetWave)
-          {
-            myCartridge->thumbCallback(1, read_register(2), 0);
-            handled = true;
-          }
-          else if (pc == BUS_GetWavePtr)
-          {
-            write_register(2, myCartridge->thumbCallback(2, read_register(2), 0));
-            handled = true;
-          }
-          else if (pc == BUS_SetWaveSize)
-          {
-            myCartridge->thumbCallback(3, read_register(2), read_register(3));
-            handled = true;
-          }
-          else if (pc == 0x0000083a)
+      //ASR(1) two register immediate
+      case Op::asr1:
+      {
+        rd = (inst >> 0) & 0x07;
+        rm = (inst >> 3) & 0x07;
+        rb = (inst >> 6) & 0x1F;
+        DO_DISS(statusMsg << "asrs r" << dec << rd << ",r" << dec << rm << ",#0x" << Base::HEX2 << rb << endl);
+        rc = read_register(rm);
+        if(rb == 0)
+        {
+          if(rc & 0x80000000)
           {
-            // exiting Custom ARM code, returning to BUS Driver control
+            do_cflag_bit(1);
+            rc = ~0;
           }
           else
           {
-#if 0  // uncomment this for testing
-            uInt32 r0 = read_register(0);
-            uInt32 r1 = read_register(1);
-            uInt32 r2 = read_register(2);
-            uInt32 r3 = read_register(3);
-            uInt32 r4 = read_register(4);
-#endif
-            myCartridge->thumbCallback(255, 0, 0);
+            do_cflag_bit(0);
+            rc = 0;
           }
+        }
+        else
+        {
+          do_cflag_bit(rc & (1 << (rb-1)));
+          ra = rc & 0x80000000;
+          rc >>= rb;
+          if(ra) //asr, sign is shifted in
+            rc |= (~0u) << (32-rb);
+        }
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-          break;
-
-        case ConfigureFor::CDF:
-          // this subroutine interface is used in the CDF driver,
-          // it starts at address 0x000006e0
-          // _SetNote:
-          //   ldr     r4, =NoteStore
-          //   bx      r4   // bx instruction at 0x000006e2
-          // _ResetWave:
-          //   ldr     r4, =ResetWaveStore
-          //   bx      r4   // bx instruction at 0x000006e6
-          // _GetWavePtr:
-          //   ldr     r4, =WavePtrFetch
-          //   bx      r4   // bx instruction at 0x000006ea
-          // _SetWaveSize:
-          //   ldr     r4, =WaveSizeStore
-          //   bx      r4   // bx instruction at 0x000006ee
-
-          // address to test for is + 4 due to pipelining
-
-        #define CDF_SetNote     (0x000006e2 + 4)
-        #define CDF_ResetWave   (0x000006e6 + 4)
-        #define CDF_GetWavePtr  (0x000006ea + 4)
-        #define CDF_SetWaveSize (0x000006ee + 4)
-
-          if      (pc == CDF_SetNote)
-          {
-            myCartridge->thumbCallback(0, read_register(2), read_register(3));
-            handled = true;
-          }
-          else if (pc == CDF_ResetWave)
-          {
-            myCartridge->thumbCallback(1, read_register(2), 0);
-            handled = true;
-          }
-          else if (pc == CDF_GetWavePtr)
-          {
-            write_register(2, myCartridge->thumbCallback(2, read_register(2), 0));
-            handled = true;
-          }
-          else if (pc == CDF_SetWaveSize)
+      //ASR(2) two register
+      case Op::asr2:
+      {
+        rd = (inst >> 0) & 0x07;
+        rs = (inst >> 3) & 0x07;
+        DO_DISS(statusMsg << "asrs r" << dec << rd << ",r" << dec << rs << endl);
+        rc = read_register(rd);
+        rb = read_register(rs);
+        rb &= 0xFF;
+        if(rb == 0)
+        {
+        }
+        else if(rb < 32)
+        {
+          do_cflag_bit(rc & (1 << (rb-1)));
+          ra = rc & 0x80000000;
+          rc >>= rb;
+          if(ra) //asr, sign is shifted in
           {
-            myCartridge->thumbCallback(3, read_register(2), read_register(3));
-            handled = true;
+            rc |= (~0u) << (32-rb);
           }
-          else if (pc == 0x0000083a)
+        }
+        else
+        {
+          if(rc & 0x80000000)
           {
-            // exiting Custom ARM code, returning to BUS Driver control
+            do_cflag_bit(1);
+            rc = (~0u);
           }
           else
           {
-          #if 0  // uncomment this for testing
-            uInt32 r0 = read_register(0);
-            uInt32 r1 = read_register(1);
-            uInt32 r2 = read_register(2);
-            uInt32 r3 = read_register(3);
-            uInt32 r4 = read_register(4);
-          #endif
-            myCartridge->thumbCallback(255, 0, 0);
+            do_cflag_bit(0);
+            rc = 0;
           }
+        }
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-          break;
+      //B(1) conditional branch
+      case Op::b1:
+      {
+        rb = (inst >> 0) & 0xFF;
+        if(rb & 0x80)
+          rb |= (~0u) << 8;
+        op=(inst >> 8) & 0xF;
+        rb <<= 1;
+        rb += pc;
+        rb += 2;
+
+        // Only evaluate the flags tested by the condition (in upper nibble
+        // format, NZCV)
+        static constexpr uInt8 ourConditionFlags[16] = {
+          0x4, 0x4, 0x2, 0x2, 0x8, 0x8, 0x1, 0x1,
+          0x6, 0x6, 0x9, 0x9, 0xD, 0xD, 0x0, 0x0
+        };
+        updateFlags(uInt32(ourConditionFlags[op]) << 28);
+        switch(op)
+        {
+          case 0x0: //b eq  z set
+            DO_DISS(statusMsg << "beq 0x" << Base::HEX8 << (rb-3) << endl);
+            if(cpsr & CPSR_Z)
+              write_register(15, rb);
+            continue;
+
+          case 0x1: //b ne  z clear
+            DO_DISS(statusMsg << "bne 0x" << Base::HEX8 << (rb-3) << endl);
+            if(!(cpsr & CPSR_Z))
+              write_register(15, rb);
+            continue;
+
+          case 0x2: //b cs c set
+            DO_DISS(statusMsg << "bcs 0x" << Base::HEX8 << (rb-3) << endl);
+            if(cpsr & CPSR_C)
+              write_register(15, rb);
+            continue;
+
+          case 0x3: //b cc c clear
+            DO_DISS(statusMsg << "bcc 0x" << Base::HEX8 << (rb-3) << endl);
+            if(!(cpsr & CPSR_C))
+              write_register(15, rb);
+            continue;
+
+          case 0x4: //b mi n set
+            DO_DISS(statusMsg << "bmi 0x" << Base::HEX8 << (rb-3) << endl);
+            if(cpsr & CPSR_N)
+              write_register(15, rb);
+            continue;
+
+          case 0x5: //b pl n clear
+            DO_DISS(statusMsg << "bpl 0x" << Base::HEX8 << (rb-3) << endl);
+            if(!(cpsr & CPSR_N))
+              write_register(15, rb);
+            continue;
+
+          case 0x6: //b vs v set
+            DO_DISS(statusMsg << "bvs 0x" << Base::HEX8 << (rb-3) << endl);
+            if(cpsr & CPSR_V)
+              write_register(15,rb);
+            continue;
+
+          case 0x7: //b vc v clear
+            DO_DISS(statusMsg << "bvc 0x" << Base::HEX8 << (rb-3) << endl);
+            if(!(cpsr & CPSR_V))
+              write_register(15, rb);
+            continue;
+
+          case 0x8: //b hi c set z clear
+            DO_DISS(statusMsg << "bhi 0x" << Base::HEX8 << (rb-3) << endl);
+            if((cpsr & CPSR_C) && (!(cpsr & CPSR_Z)))
+              write_register(15, rb);
+            continue;
+
+          case 0x9: //b ls c clear or z set
+            DO_DISS(statusMsg << "bls 0x" << Base::HEX8 << (rb-3) << endl);
+            if((cpsr & CPSR_Z) || (!(cpsr & CPSR_C)))
+              write_register(15, rb);
+            continue;
+
+          case 0xA: //b ge N == V
+            DO_DISS(statusMsg << "bge 0x" << Base::HEX8 << (rb-3) << endl);
+            ra = 0;
+            if(  (cpsr & CPSR_N)  &&   (cpsr & CPSR_V) ) ra++;
+            if((!(cpsr & CPSR_N)) && (!(cpsr & CPSR_V))) ra++;
+            if(ra)
+              write_register(15, rb);
+            continue;
+
+          case 0xB: //b lt N != V
+            DO_DISS(statusMsg << "blt 0x" << Base::HEX8 << (rb-3) << endl);
+            ra = 0;
+            if((!(cpsr & CPSR_N)) && (cpsr & CPSR_V)) ra++;
+            if((!(cpsr & CPSR_V)) && (cpsr & CPSR_N)) ra++;
+            if(ra)
+              write_register(15, rb);
+            continue;
+
+          case 0xC: //b gt Z==0 and N == V
+            DO_DISS(statusMsg << "bgt 0x" << Base::HEX8 << (rb-3) << endl);
+            ra = 0;
+            if(  (cpsr & CPSR_N)  &&   (cpsr & CPSR_V) ) ra++;
+            if((!(cpsr & CPSR_N)) && (!(cpsr & CPSR_V))) ra++;
+            if(cpsr & CPSR_Z) ra = 0;
+            if(ra)
+              write_register(15, rb);
+            continue;
+
+          case 0xD: //b le Z==1 or N != V
+            DO_DISS(statusMsg << "ble 0x" << Base::HEX8 << (rb-3) << endl);
+            ra = 0;
+            if((!(cpsr & CPSR_N)) && (cpsr & CPSR_V)) ra++;
+            if((!(cpsr & CPSR_V)) && (cpsr & CPSR_N)) ra++;
+            if(cpsr & CPSR_Z) ra++;
+            if(ra)
+              write_register(15, rb);
+            continue;
+
+          case 0xE:
+            //undefined instruction
+            break;
+
+          case 0xF:
+            //swi
+            break;
+        }
+      }
+      break;
 
-        case ConfigureFor::CDF1:
-          // this subroutine interface is used in the CDF driver,
-          // it starts at address 0x00000750
-          // _SetNote:
-          //   ldr     r4, =NoteStore
-          //   bx      r4   // bx instruction at 0x000006e2
-          // _ResetWave:
-          //   ldr     r4, =ResetWaveStore
-          //   bx      r4   // bx instruction at 0x000006e6
-          // _GetWavePtr:
-          //   ldr     r4, =WavePtrFetch
-          //   bx      r4   // bx instruction at 0x000006ea
-          // _SetWaveSize:
-          //   ldr     r4, =WaveSizeStore
-          //   bx      r4   // bx instruction at 0x000006ee
-
-          // address to test for is + 4 due to pipelining
-
-#define CDF1_SetNote     (0x00000752 + 4)
-#define CDF1_ResetWave   (0x00000756 + 4)
-#define CDF1_GetWavePtr  (0x0000075a + 4)
-#define CDF1_SetWaveSize (0x0000075e + 4)
-
-          if      (pc == CDF1_SetNote)
-          {
-            myCartridge->thumbCallback(0, read_register(2), read_register(3));
-            handled = true;
-          }
-          else if (pc == CDF1_ResetWave)
-          {
-            myCartridge->thumbCallback(1, read_register(2), 0);
-            handled = true;
-          }
-          else if (pc == CDF1_GetWavePtr)
-          {
-            write_register(2, myCartridge->thumbCallback(2, read_register(2), 0));
-            handled = true;
-          }
-          else if (pc == CDF1_SetWaveSize)
-          {
-            myCartridge->thumbCallback(3, read_register(2), read_register(3));
-            handled = true;
-          }
-          else if (pc == 0x0000083a)
-          {
-            // exiting Custom ARM code, returning to BUS Driver control
-          }
-          else
-          {
-#if 0  // uncomment this for testing
-            uInt32 r0 = read_register(0);
-            uInt32 r1 = read_register(1);
-            uInt32 r2 = read_register(2);
-            uInt32 r3 = read_register(3);
-            uInt32 r4 = read_register(4);
-#endif
-            myCartridge->thumbCallback(255, 0, 0);
-          }
+      //B(2) unconditional branch
+      case Op::b2:
+      {
+        rb = (inst >> 0) & 0x7FF;
+        if(rb & (1 << 10))
+          rb |= (~0u) << 11;
+        rb <<= 1;
+        rb += pc;
+        rb += 2;
+        DO_DISS(statusMsg << "B 0x" << Base::HEX8 << (rb-3) << endl);
+        write_register(15, rb);
+        continue;
+      }
 
-          break;
+      //BIC
+      case Op::bic:
+      {
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "bics r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rd);
+        rb = read_register(rm);
+        rc = ra & (~rb);
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-        case ConfigureFor::DPCplus:
-          // no 32-bit subroutines in DPC+
-          break;
+      //BKPT
+      case Op::bkpt:
+      {
+        rb = (inst >> 0) & 0xFF;
+        statusMsg << "bkpt 0x" << Base::HEX2 << rb << endl;
+        return 1;
+      }
+
+      //BL/BLX(1)
+      case Op::bl:
+      {
+        if((inst & 0x1800) == 0x1000) //H=b10
+        {
+          DO_DISS(statusMsg << endl);
+          rb = inst & ((1 << 11) - 1);
+          if(rb & 1<<10) rb |= (~((1 << 11) - 1)); //sign extend
+          rb <<= 12;
+          rb += pc;
+          write_register(14, rb);
+          continue;
+        }
+        else if((inst & 0x1800) == 0x1800) //H=b11
+        {
+          //branch to thumb
+          rb = read_register(14);
+          rb += (inst & ((1 << 11) - 1)) << 1;;
+          rb += 2;
+          DO_DISS(statusMsg << "bl 0x" << Base::HEX8 << (rb-3) << endl);
+          write_register(14, (pc-2) | 1);
+          write_register(15, rb);
+          continue;
+        }
+        else if((inst & 0x1800) == 0x0800) //H=b01
+        {
+          //fprintf(stderr,"cannot branch to arm 0x%08X 0x%04X\n",pc,inst);
+          // fxq: this should exit the code without having to detect it
+          rb = read_register(14);
+          rb += (inst & ((1 << 11) - 1)) << 1;;
+          rb &= 0xFFFFFFFC;
+          rb += 2;
+          DO_DISS(statusMsg << "bl 0x" << Base::HEX8 << (rb-3) << endl);
+          write_register(14, (pc-2) | 1);
+          write_register(15, rb);
+          continue;
+        }
       }
+      break;
 
-      if (handled)
+      //BLX(2)
+      case Op::blx2:
       {
-        rc = read_register(14); // lr
+        rm = (inst >> 3) & 0xF;
+        DO_DISS(statusMsg << "blx r" << dec << rm << endl);
+        rc = read_register(rm);
+        //fprintf(stderr,"blx r%u 0x%X 0x%X\n",rm,rc,pc);
         rc += 2;
-        rc &= ~1;
-        write_register(15, rc);
-        return 0;
+        if(rc & 1)
+        {
+          write_register(14, (pc-2) | 1);
+          rc &= ~1;
+          write_register(15, rc);
+          continue;
+        }
+        else
+        {
+          //fprintf(stderr,"cannot branch to arm 0x%08X 0x%04X\n",pc,inst);
+          // fxq: this could serve as exit code
+          return 1;
+        }
       }
 
-      return 1;
-    }
-  }
+      //BX
+      case Op::bx:
+      {
+        rm = (inst >> 3) & 0xF;
+        DO_DISS(statusMsg << "bx r" << dec << rm << endl);
+        rc = read_register(rm);
+        rc += 2;
+        //fprintf(stderr,"bx r%u 0x%X 0x%X\n",rm,rc,pc);
+        if(rc & 1)
+        {
+          // branch to odd address denotes 16 bit ARM code
+          rc &= ~1;
+          write_register(15, rc);
+          continue;
+        }
+        else
+        {
+          // branch to even address denotes 32 bit ARM code, which the Thumbulator
+          // class does not support. So capture relavent information and hand it
+          // off to the Cartridge class for it to handle.
 
-  //CMN
-  if((inst & 0xFFC0) == 0x42C0)
-  {
-    rn = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "cmns r" << dec << rn << ",r" << dec << rm << endl);
-    ra = read_register(rn);
-    rb = read_register(rm);
-    rc = ra + rb;
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag(ra, rb, 0);
-    do_vflag(ra, rb, 0);
-    return 0;
-  }
+          bool handled = false;
 
-  //CMP(1) compare immediate
-  if((inst & 0xF800) == 0x2800)
-  {
-    rb = (inst >> 0) & 0xFF;
-    rn = (inst >> 8) & 0x07;
-    DO_DISS(statusMsg << "cmp r" << dec << rn << ",#0x" << Base::HEX2 << rb << endl);
-    ra = read_register(rn);
-    rc = ra - rb;
-    //fprintf(stderr,"0x%08X 0x%08X\n",ra,rb);
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag(ra, ~rb, 1);
-    do_vflag(ra, ~rb, 1);
-    return 0;
-  }
+          switch(configuration)
+          {
+            case ConfigureFor::BUS:
+              // this subroutine interface is used in the BUS driver,
+              // it starts at address 0x000006d8
+              // _SetNote:
+              //   ldr     r4, =NoteStore
+              //   bx      r4   // bx instruction at 0x000006da
+              // _ResetWave:
+              //   ldr     r4, =ResetWaveStore
+              //   bx      r4   // bx instruction at 0x000006de
+              // _GetWavePtr:
+              //   ldr     r4, =WavePtrFetch
+              //   bx      r4   // bx instruction at 0x000006e2
+              // _SetWaveSize:
+              //   ldr     r4, =WaveSizeStore
+              //   bx      r4   // bx instruction at 0x000006e6
+
+              // address to test for is + 4 due to pipelining
+
+    #define BUS_SetNote     (0x000006da + 4)
+    #define BUS_ResetWave   (0x000006de + 4)
+    #define BUS_GetWavePtr  (0x000006e2 + 4)
+    #define BUS_SetWaveSize (0x000006e6 + 4)
+
+              if      (pc == BUS_SetNote)
+              {
+                myCartridge->thumbCallback(0, read_register(2), read_register(3));
+                handled = true;
+              }
+              else if (pc == BUS_ResetWave)
+              {
+                myCartridge->thumbCallback(1, read_register(2), 0);
+                handled = true;
+              }
+              else if (pc == BUS_GetWavePtr)
+              {
+                write_register(2, myCartridge->thumbCallback(2, read_register(2), 0));
+                handled = true;
+              }
+              else if (pc == BUS_SetWaveSize)
+              {
+                myCartridge->thumbCallback(3, read_register(2), read_register(3));
+                handled = true;
+              }
+              else if (pc == 0x0000083a)
+              {
+                // exiting Custom ARM code, returning to BUS Driver control
+              }
+              else
+              {
+    #if 0  // uncomment this for testing
+                uInt32 r0 = read_register(0);
+                uInt32 r1 = read_register(1);
+                uInt32 r2 = read_register(2);
+                uInt32 r3 = read_register(3);
+                uInt32 r4 = read_register(4);
+    #endif
+                myCartridge->thumbCallback(255, 0, 0);
+              }
+
+              break;
+
+            case ConfigureFor::CDF:
+              // this subroutine interface is used in the CDF driver,
+              // it starts at address 0x000006e0
+              // _SetNote:
+              //   ldr     r4, =NoteStore
+              //   bx      r4   // bx instruction at 0x000006e2
+              // _ResetWave:
+              //   ldr     r4, =ResetWaveStore
+              //   bx      r4   // bx instruction at 0x000006e6
+              // _GetWavePtr:
+              //   ldr     r4, =WavePtrFetch
+              //   bx      r4   // bx instruction at 0x000006ea
+              // _SetWaveSize:
+              //   ldr     r4, =WaveSizeStore
+              //   bx      r4   // bx instruction at 0x000006ee
+
+              // address to test for is + 4 due to pipelining
+
+            #define CDF_SetNote     (0x000006e2 + 4)
+            #define CDF_ResetWave   (0x000006e6 + 4)
+            #define CDF_GetWavePtr  (0x000006ea + 4)
+            #define CDF_SetWaveSize (0x000006ee + 4)
+
+              if      (pc == CDF_SetNote)
+              {
+                myCartridge->thumbCallback(0, read_register(2), read_register(3));
+                handled = true;
+              }
+              else if (pc == CDF_ResetWave)
+              {
+                myCartridge->thumbCallback(1, read_register(2), 0);
+                handled = true;
+              }
+              else if (pc == CDF_GetWavePtr)
+              {
+                write_register(2, myCartridge->thumbCallback(2, read_register(2), 0));
+                handled = true;
+              }
+              else if (pc == CDF_SetWaveSize)
+              {
+                myCartridge->thumbCallback(3, read_register(2), read_register(3));
+                handled = true;
+              }
+              else if (pc == 0x0000083a)
+              {
+                // exiting Custom ARM code, returning to BUS Driver control
+              }
+              else
+              {
+              #if 0  // uncomment this for testing
+                uInt32 r0 = read_register(0);
+                uInt32 r1 = read_register(1);
+                uInt32 r2 = read_register(2);
+                uInt32 r3 = read_register(3);
+                uInt32 r4 = read_register(4);
+              #endif
+                myCartridge->thumbCallback(255, 0, 0);
+              }
+
+              break;
+
+            case ConfigureFor::CDF1:
+              // this subroutine interface is used in the CDF driver,
+              // it starts at address 0x00000750
+              // _SetNote:
+              //   ldr     r4, =NoteStore
+              //   bx      r4   // bx instruction at 0x000006e2
+              // _ResetWave:
+              //   ldr     r4, =ResetWaveStore
+              //   bx      r4   // bx instruction at 0x000006e6
+              // _GetWavePtr:
+              //   ldr     r4, =WavePtrFetch
+              //   bx      r4   // bx instruction at 0x000006ea
+              // _SetWaveSize:
+              //   ldr     r4, =WaveSizeStore
+              //   bx      r4   // bx instruction at 0x000006ee
+
+              // address to test for is + 4 due to pipelining
+
+    #define CDF1_SetNote     (0x00000752 + 4)
+    #define CDF1_ResetWave   (0x00000756 + 4)
+    #define CDF1_GetWavePtr  (0x0000075a + 4)
+    #define CDF1_SetWaveSize (0x0000075e + 4)
+
+              if      (pc == CDF1_SetNote)
+              {
+                myCartridge->thumbCallback(0, read_register(2), read_register(3));
+                handled = true;
+              }
+              else if (pc == CDF1_ResetWave)
+              {
+                myCartridge->thumbCallback(1, read_register(2), 0);
+                handled = true;
+              }
+              else if (pc == CDF1_GetWavePtr)
+              {
+                write_register(2, myCartridge->thumbCallback(2, read_register(2), 0));
+                handled = true;
+              }
+              else if (pc == CDF1_SetWaveSize)
+              {
+                myCartridge->thumbCallback(3, read_register(2), read_register(3));
+                handled = true;
+              }
+              else if (pc == 0x0000083a)
+              {
+                // exiting Custom ARM code, returning to BUS Driver control
+              }
+              else
+              {
+    #if 0  // uncomment this for testing
+                uInt32 r0 = read_register(0);
+                uInt32 r1 = read_register(1);
+                uInt32 r2 = read_register(2);
+                uInt32 r3 = read_register(3);
+                uInt32 r4 = read_register(4);
+    #endif
+                myCartridge->thumbCallback(255, 0, 0);
+              }
+
+              break;
+
+            case ConfigureFor::DPCplus:
+              // no 32-bit subroutines in DPC+
+              break;
+          }
 
-  //CMP(2) compare register
-  if((inst & 0xFFC0) == 0x4280)
-  {
-    rn = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "cmps r" << dec << rn << ",r" << dec << rm << endl);
-    ra = read_register(rn);
-    rb = read_register(rm);
-    rc = ra - rb;
-    //fprintf(stderr,"0x%08X 0x%08X\n",ra,rb);
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag(ra, ~rb, 1);
-    do_vflag(ra, ~rb, 1);
-    return 0;
-  }
+          if (handled)
+          {
+            rc = read_register(14); // lr
+            rc += 2;
+            rc &= ~1;
+            write_register(15, rc);
+            continue;
+          }
 
-  //CMP(3) compare high register
-  if((inst & 0xFF00) == 0x4500)
-  {
-    if(((inst >> 6) & 3) == 0x0)
-    {
-      //UNPREDICTABLE
-    }
-    rn = (inst >> 0) & 0x7;
-    rn |= (inst >> 4) & 0x8;
-    if(rn == 0xF)
-    {
-      //UNPREDICTABLE
-    }
-    rm = (inst >> 3) & 0xF;
-    DO_DISS(statusMsg << "cmps r" << dec << rn << ",r" << dec << rm << endl);
-    ra = read_register(rn);
-    rb = read_register(rm);
-    rc = ra - rb;
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag(ra, ~rb, 1);
-    do_vflag(ra, ~rb, 1);
-    return 0;
-  }
+          return 1;
+        }
+      }
 
-  //CPS
-  if((inst & 0xFFE8) == 0xB660)
-  {
-    DO_DISS(statusMsg << "cps TODO" << endl);
-    return 1;
-  }
+      //CMN
+      case Op::cmn:
+      {
+        rn = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "cmns r" << dec << rn << ",r" << dec << rm << endl);
+        ra = read_register(rn);
+        rb = read_register(rm);
+        rc = ra + rb;
+        do_nzflags(rc);
+        do_cvflags(ra, rb, 0);
+        continue;
+      }
 
-  //CPY copy high register
-  if((inst & 0xFFC0) == 0x4600)
-  {
-    //same as mov except you can use both low registers
-    //going to let mov handle high registers
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "cpy r" << dec << rd << ",r" << dec << rm << endl);
-    rc = read_register(rm);
-    write_register(rd, rc);
-    return 0;
-  }
+      //CMP(1) compare immediate
+      case Op::cmp1:
+      {
+        rb = (inst >> 0) & 0xFF;
+        rn = (inst >> 8) & 0x07;
+        DO_DISS(statusMsg << "cmp r" << dec << rn << ",#0x" << Base::HEX2 << rb << endl);
+        ra = read_register(rn);
+        rc = ra - rb;
+        //fprintf(stderr,"0x%08X 0x%08X\n",ra,rb);
+        do_nzflags(rc);
+        do_cvflags(ra, ~rb, 1);
+        continue;
+      }
 
-  //EOR
-  if((inst & 0xFFC0) == 0x4040)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "eors r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rd);
-    rb = read_register(rm);
-    rc = ra ^ rb;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+      //CMP(2) compare register
+      case Op::cmp2:
+      {
+        rn = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "cmps r" << dec << rn << ",r" << dec << rm << endl);
+        ra = read_register(rn);
+        rb = read_register(rm);
+        rc = ra - rb;
+        //fprintf(stderr,"0x%08X 0x%08X\n",ra,rb);
+        do_nzflags(rc);
+        do_cvflags(ra, ~rb, 1);
+        continue;
+      }
 
-  //LDMIA
-  if((inst & 0xF800) == 0xC800)
-  {
-    rn = (inst >> 8) & 0x7;
-  #if defined(THUMB_DISS)
-    statusMsg << "ldmia r" << dec << rn << "!,{";
-    for(ra=0,rb=0x01,rc=0;rb;rb=(rb<<1)&0xFF,ra++)
-    {
-      if(inst&rb)
+      //CMP(3) compare high register
+      case Op::cmp3:
       {
-        if(rc) statusMsg << ",";
-        statusMsg << "r" << dec << ra;
-        rc++;
+        if(((inst >> 6) & 3) == 0x0)
+        {
+          //UNPREDICTABLE
+        }
+        rn = (inst >> 0) & 0x7;
+        rn |= (inst >> 4) & 0x8;
+        if(rn == 0xF)
+        {
+          //UNPREDICTABLE
+        }
+        rm = (inst >> 3) & 0xF;
+        DO_DISS(statusMsg << "cmps r" << dec << rn << ",r" << dec << rm << endl);
+        ra = read_register(rn);
+        rb = read_register(rm);
+        rc = ra - rb;
+        do_nzflags(rc);
+        do_cvflags(ra, ~rb, 1);
+        continue;
       }
-    }
-    statusMsg << "}" << endl;
-  #endif
-    sp = read_register(rn);
-    for(ra = 0, rb = 0x01; rb; rb = (rb << 1) & 0xFF, ra++)
-    {
-      if(inst & rb)
+
+      //CPS
+      case Op::cps:
       {
-        write_register(ra, read32(sp));
-        sp += 4;
+        DO_DISS(statusMsg << "cps TODO" << endl);
+        return 1;
       }
-    }
-    //there is a write back exception.
-    if((inst & (1 << rn)) == 0)
-      write_register(rn, sp);
 
-    return 0;
-  }
+      //CPY copy high register
+      case Op::cpy:
+      {
+        //same as mov except you can use both low registers
+        //going to let mov handle high registers
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "cpy r" << dec << rd << ",r" << dec << rm << endl);
+        rc = read_register(rm);
+        write_register(rd, rc);
+        continue;
+      }
 
-  //LDR(1) two register immediate
-  if((inst & 0xF800) == 0x6800)
-  {
-    rd = (inst >> 0) & 0x07;
-    rn = (inst >> 3) & 0x07;
-    rb = (inst >> 6) & 0x1F;
-    rb <<= 2;
-    DO_DISS(statusMsg << "ldr r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX2 << rb << "]" << endl);
-    rb = read_register(rn) + rb;
-    rc = read32(rb);
-    write_register(rd, rc);
-    return 0;
-  }
+      //EOR
+      case Op::eor:
+      {
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "eors r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rd);
+        rb = read_register(rm);
+        rc = ra ^ rb;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-  //LDR(2) three register
-  if((inst & 0xFE00) == 0x5800)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rm = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "ldr r" << dec << rd << ",[r" << dec << rn << ",r" << dec << "]" << endl);
-    rb = read_register(rn) + read_register(rm);
-    rc = read32(rb);
-    write_register(rd, rc);
-    return 0;
-  }
+      //LDMIA
+      case Op::ldmia:
+      {
+        rn = (inst >> 8) & 0x7;
+      #if defined(THUMB_DISS)
+        statusMsg << "ldmia r" << dec << rn << "!,{";
+        for(ra=0,rb=0x01,rc=0;rb;rb=(rb<<1)&0xFF,ra++)
+        {
+          if(inst&rb)
+          {
+            if(rc) statusMsg << ",";
+            statusMsg << "r" << dec << ra;
+            rc++;
+          }
+        }
+        statusMsg << "}" << endl;
+      #endif
+        sp = read_register(rn);
+        for(ra = 0, rb = 0x01; rb; rb = (rb << 1) & 0xFF, ra++)
+        {
+          if(inst & rb)
+          {
+            write_register(ra, read32(sp));
+            sp += 4;
+          }
+        }
+        //there is a write back exception.
+        if((inst & (1 << rn)) == 0)
+          write_register(rn, sp);
 
-  //LDR(3)
-  if((inst & 0xF800) == 0x4800)
-  {
-    rb = (inst >> 0) & 0xFF;
-    rd = (inst >> 8) & 0x07;
-    rb <<= 2;
-    DO_DISS(statusMsg << "ldr r" << dec << rd << ",[PC+#0x" << Base::HEX2 << rb << "] ");
-    ra = read_register(15);
-    ra &= ~3;
-    rb += ra;
-    DO_DISS(statusMsg << ";@ 0x" << Base::HEX2 << rb << endl);
-    rc = read32(rb);
-    write_register(rd, rc);
-    return 0;
-  }
+        continue;
+      }
 
-  //LDR(4)
-  if((inst & 0xF800) == 0x9800)
-  {
-    rb = (inst >> 0) & 0xFF;
-    rd = (inst >> 8) & 0x07;
-    rb <<= 2;
-    DO_DISS(statusMsg << "ldr r" << dec << rd << ",[SP+#0x" << Base::HEX2 << rb << "]" << endl);
-    ra = read_register(13);
-    //ra&=~3;
-    rb += ra;
-    rc = read32(rb);
-    write_register(rd, rc);
-    return 0;
-  }
+      //LDR(1) two register immediate
+      case Op::ldr1:
+      {
+        rd = (inst >> 0) & 0x07;
+        rn = (inst >> 3) & 0x07;
+        rb = (inst >> 6) & 0x1F;
+        rb <<= 2;
+        DO_DISS(statusMsg << "ldr r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX2 << rb << "]" << endl);
+        rb = read_register(rn) + rb;
+        rc = read32(rb);
+        write_register(rd, rc);
+        continue;
+      }
 
-  //LDRB(1)
-  if((inst & 0xF800) == 0x7800)
-  {
-    rd = (inst >> 0) & 0x07;
-    rn = (inst >> 3) & 0x07;
-    rb = (inst >> 6) & 0x1F;
-    DO_DISS(statusMsg << "ldrb r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX2 << rb << "]" << endl);
-    rb = read_register(rn) + rb;
-    rc = read16(rb & (~1u));
-    if(rb & 1)
-    {
-      rc >>= 8;
-    }
-    else
-    {
-    }
-    write_register(rd, rc & 0xFF);
-    return 0;
-  }
+      //LDR(2) three register
+      case Op::ldr2:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rm = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "ldr r" << dec << rd << ",[r" << dec << rn << ",r" << dec << "]" << endl);
+        rb = read_register(rn) + read_register(rm);
+        rc = read32(rb);
+        write_register(rd, rc);
+        continue;
+      }
 
-  //LDRB(2)
-  if((inst & 0xFE00) == 0x5C00)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rm = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "ldrb r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
-    rb = read_register(rn) + read_register(rm);
-    rc = read16(rb & (~1u));
-    if(rb & 1)
-    {
-      rc >>= 8;
-    }
-    else
-    {
-    }
-    write_register(rd, rc & 0xFF);
-    return 0;
-  }
+      //LDR(3)
+      case Op::ldr3:
+      {
+        rb = (inst >> 0) & 0xFF;
+        rd = (inst >> 8) & 0x07;
+        rb <<= 2;
+        DO_DISS(statusMsg << "ldr r" << dec << rd << ",[PC+#0x" << Base::HEX2 << rb << "] ");
+        ra = read_register(15);
+        ra &= ~3;
+        rb += ra;
+        DO_DISS(statusMsg << ";@ 0x" << Base::HEX2 << rb << endl);
+        rc = read32(rb);
+        write_register(rd, rc);
+        continue;
+      }
 
-  //LDRH(1)
-  if((inst & 0xF800) == 0x8800)
-  {
-    rd = (inst >> 0) & 0x07;
-    rn = (inst >> 3) & 0x07;
-    rb = (inst >> 6) & 0x1F;
-    rb <<= 1;
-    DO_DISS(statusMsg << "ldrh r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX2 << rb << "]" << endl);
-    rb=read_register(rn) + rb;
-    rc = read16(rb);
-    write_register(rd, rc & 0xFFFF);
-    return 0;
-  }
+      //LDR(4)
+      case Op::ldr4:
+      {
+        rb = (inst >> 0) & 0xFF;
+        rd = (inst >> 8) & 0x07;
+        rb <<= 2;
+        DO_DISS(statusMsg << "ldr r" << dec << rd << ",[SP+#0x" << Base::HEX2 << rb << "]" << endl);
+        ra = read_register(13);
+        //ra&=~3;
+        rb += ra;
+        rc = read32(rb);
+        write_register(rd, rc);
+        continue;
+      }
 
-  //LDRH(2)
-  if((inst & 0xFE00) == 0x5A00)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rm = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "ldrh r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
-    rb = read_register(rn) + read_register(rm);
-    rc = read16(rb);
-    write_register(rd, rc & 0xFFFF);
-    return 0;
-  }
+      //LDRB(1)
+      case Op::ldrb1:
+      {
+        rd = (inst >> 0) & 0x07;
+        rn = (inst >> 3) & 0x07;
+        rb = (inst >> 6) & 0x1F;
+        DO_DISS(statusMsg << "ldrb r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX2 << rb << "]" << endl);
+        rb = read_register(rn) + rb;
+        rc = read16(rb & (~1u));
+        if(rb & 1)
+        {
+          rc >>= 8;
+        }
+        else
+        {
+        }
+        write_register(rd, rc & 0xFF);
+        continue;
+      }
 
-  //LDRSB
-  if((inst & 0xFE00) == 0x5600)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rm = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "ldrsb r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
-    rb = read_register(rn) + read_register(rm);
-    rc = read16(rb & (~1u));
-    if(rb & 1)
-    {
-      rc >>= 8;
-    }
-    else
-    {
-    }
-    rc &= 0xFF;
-    if(rc & 0x80)
-      rc |= ((~0u) << 8);
-    write_register(rd, rc);
-    return 0;
-  }
+      //LDRB(2)
+      case Op::ldrb2:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rm = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "ldrb r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
+        rb = read_register(rn) + read_register(rm);
+        rc = read16(rb & (~1u));
+        if(rb & 1)
+        {
+          rc >>= 8;
+        }
+        else
+        {
+        }
+        write_register(rd, rc & 0xFF);
+        continue;
+      }
 
-  //LDRSH
-  if((inst & 0xFE00) == 0x5E00)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rm = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "ldrsh r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
-    rb = read_register(rn) + read_register(rm);
-    rc = read16(rb);
-    rc &= 0xFFFF;
-    if(rc & 0x8000)
-      rc |= ((~0u) << 16);
-    write_register(rd, rc);
-    return 0;
-  }
+      //LDRH(1)
+      case Op::ldrh1:
+      {
+        rd = (inst >> 0) & 0x07;
+        rn = (inst >> 3) & 0x07;
+        rb = (inst >> 6) & 0x1F;
+        rb <<= 1;
+        DO_DISS(statusMsg << "ldrh r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX2 << rb << "]" << endl);
+        rb=read_register(rn) + rb;
+        rc = read16(rb);
+        write_register(rd, rc & 0xFFFF);
+        continue;
+      }
 
-  //LSL(1)
-  if((inst & 0xF800) == 0x0000)
-  {
-    rd = (inst >> 0) & 0x07;
-    rm = (inst >> 3) & 0x07;
-    rb = (inst >> 6) & 0x1F;
-    DO_DISS(statusMsg << "lsls r" << dec << rd << ",r" << dec << rm << ",#0x" << Base::HEX2 << rb << endl);
-    rc = read_register(rm);
-    if(rb == 0)
-    {
-      //if immed_5 == 0
-      //C unaffected
-      //result not shifted
-    }
-    else
-    {
-      //else immed_5 > 0
-      do_cflag_bit(rc & (1 << (32-rb)));
-      rc <<= rb;
-    }
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+      //LDRH(2)
+      case Op::ldrh2:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rm = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "ldrh r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
+        rb = read_register(rn) + read_register(rm);
+        rc = read16(rb);
+        write_register(rd, rc & 0xFFFF);
+        continue;
+      }
 
-  //LSL(2) two register
-  if((inst & 0xFFC0) == 0x4080)
-  {
-    rd = (inst >> 0) & 0x07;
-    rs = (inst >> 3) & 0x07;
-    DO_DISS(statusMsg << "lsls r" << dec << rd << ",r" << dec << rs << endl);
-    rc = read_register(rd);
-    rb = read_register(rs);
-    rb &= 0xFF;
-    if(rb == 0)
-    {
-    }
-    else if(rb < 32)
-    {
-      do_cflag_bit(rc & (1 << (32-rb)));
-      rc <<= rb;
-    }
-    else if(rb == 32)
-    {
-      do_cflag_bit(rc & 1);
-      rc = 0;
-    }
-    else
-    {
-      do_cflag_bit(0);
-      rc = 0;
-    }
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+      //LDRSB
+      case Op::ldrsb:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rm = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "ldrsb r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
+        rb = read_register(rn) + read_register(rm);
+        rc = read16(rb & (~1u));
+        if(rb & 1)
+        {
+          rc >>= 8;
+        }
+        else
+        {
+        }
+        rc &= 0xFF;
+        if(rc & 0x80)
+          rc |= ((~0u) << 8);
+        write_register(rd, rc);
+        continue;
+      }
 
-  //LSR(1) two register immediate
-  if((inst & 0xF800) == 0x0800)
-  {
-    rd = (inst >> 0) & 0x07;
-    rm = (inst >> 3) & 0x07;
-    rb = (inst >> 6) & 0x1F;
-    DO_DISS(statusMsg << "lsrs r" << dec << rd << ",r" << dec << rm << ",#0x" << Base::HEX2 << rb << endl);
-    rc = read_register(rm);
-    if(rb == 0)
-    {
-      do_cflag_bit(rc & 0x80000000);
-      rc = 0;
-    }
-    else
-    {
-      do_cflag_bit(rc & (1 << (rb-1)));
-      rc >>= rb;
-    }
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+      //LDRSH
+      case Op::ldrsh:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rm = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "ldrsh r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
+        rb = read_register(rn) + read_register(rm);
+        rc = read16(rb);
+        rc &= 0xFFFF;
+        if(rc & 0x8000)
+          rc |= ((~0u) << 16);
+        write_register(rd, rc);
+        continue;
+      }
 
-  //LSR(2) two register
-  if((inst & 0xFFC0) == 0x40C0)
-  {
-    rd = (inst >> 0) & 0x07;
-    rs = (inst >> 3) & 0x07;
-    DO_DISS(statusMsg << "lsrs r" << dec << rd << ",r" << dec << rs << endl);
-    rc = read_register(rd);
-    rb = read_register(rs);
-    rb &= 0xFF;
-    if(rb == 0)
-    {
-    }
-    else if(rb < 32)
-    {
-      do_cflag_bit(rc & (1 << (rb-1)));
-      rc >>= rb;
-    }
-    else if(rb == 32)
-    {
-      do_cflag_bit(rc & 0x80000000);
-      rc = 0;
-    }
-    else
-    {
-      do_cflag_bit(0);
-      rc = 0;
-    }
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+      //LSL(1)
+      case Op::lsl1:
+      {
+        rd = (inst >> 0) & 0x07;
+        rm = (inst >> 3) & 0x07;
+        rb = (inst >> 6) & 0x1F;
+        DO_DISS(statusMsg << "lsls r" << dec << rd << ",r" << dec << rm << ",#0x" << Base::HEX2 << rb << endl);
+        rc = read_register(rm);
+        if(rb == 0)
+        {
+          //if immed_5 == 0
+          //C unaffected
+          //result not shifted
+        }
+        else
+        {
+          //else immed_5 > 0
+          do_cflag_bit(rc & (1 << (32-rb)));
+          rc <<= rb;
+        }
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-  //MOV(1) immediate
-  if((inst & 0xF800) == 0x2000)
-  {
-    rb = (inst >> 0) & 0xFF;
-    rd = (inst >> 8) & 0x07;
-    DO_DISS(statusMsg << "movs r" << dec << rd << ",#0x" << Base::HEX2 << rb << endl);
-    write_register(rd, rb);
-    do_nflag(rb);
-    do_zflag(rb);
-    return 0;
-  }
+      //LSL(2) two register
+      case Op::lsl2:
+      {
+        rd = (inst >> 0) & 0x07;
+        rs = (inst >> 3) & 0x07;
+        DO_DISS(statusMsg << "lsls r" << dec << rd << ",r" << dec << rs << endl);
+        rc = read_register(rd);
+        rb = read_register(rs);
+        rb &= 0xFF;
+        if(rb == 0)
+        {
+        }
+        else if(rb < 32)
+        {
+          do_cflag_bit(rc & (1 << (32-rb)));
+          rc <<= rb;
+        }
+        else if(rb == 32)
+        {
+          do_cflag_bit(rc & 1);
+          rc = 0;
+        }
+        else
+        {
+          do_cflag_bit(0);
+          rc = 0;
+        }
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-  //MOV(2) two low registers
-  if((inst & 0xFFC0) == 0x1C00)
-  {
-    rd = (inst >> 0) & 7;
-    rn = (inst >> 3) & 7;
-    DO_DISS(statusMsg << "movs r" << dec << rd << ",r" << dec << rn << endl);
-    rc = read_register(rn);
-    //fprintf(stderr,"0x%08X\n",rc);
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag_bit(0);
-    do_vflag_bit(0);
-    return 0;
-  }
+      //LSR(1) two register immediate
+      case Op::lsr1:
+      {
+        rd = (inst >> 0) & 0x07;
+        rm = (inst >> 3) & 0x07;
+        rb = (inst >> 6) & 0x1F;
+        DO_DISS(statusMsg << "lsrs r" << dec << rd << ",r" << dec << rm << ",#0x" << Base::HEX2 << rb << endl);
+        rc = read_register(rm);
+        if(rb == 0)
+        {
+          do_cflag_bit(rc & 0x80000000);
+          rc = 0;
+        }
+        else
+        {
+          do_cflag_bit(rc & (1 << (rb-1)));
+          rc >>= rb;
+        }
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-  //MOV(3)
-  if((inst & 0xFF00) == 0x4600)
-  {
-    rd  = (inst >> 0) & 0x7;
-    rd |= (inst >> 4) & 0x8;
-    rm  = (inst >> 3) & 0xF;
-    DO_DISS(statusMsg << "mov r" << dec << rd << ",r" << dec << rm << endl);
-    rc = read_register(rm);
-    if((rd == 14) && (rm == 15))
-    {
-      //printf("mov lr,pc warning 0x%08X\n",pc-2);
-      //rc|=1;
-    }
-    if(rd == 15)
-    {
-      rc &= ~1; //write_register may do this as well
-      rc += 2;  //The program counter is special
-    }
-    write_register(rd, rc);
-    return 0;
-  }
+      //LSR(2) two register
+      case Op::lsr2:
+      {
+        rd = (inst >> 0) & 0x07;
+        rs = (inst >> 3) & 0x07;
+        DO_DISS(statusMsg << "lsrs r" << dec << rd << ",r" << dec << rs << endl);
+        rc = read_register(rd);
+        rb = read_register(rs);
+        rb &= 0xFF;
+        if(rb == 0)
+        {
+        }
+        else if(rb < 32)
+        {
+          do_cflag_bit(rc & (1 << (rb-1)));
+          rc >>= rb;
+        }
+        else if(rb == 32)
+        {
+          do_cflag_bit(rc & 0x80000000);
+          rc = 0;
+        }
+        else
+        {
+          do_cflag_bit(0);
+          rc = 0;
+        }
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-  //MUL
-  if((inst & 0xFFC0) == 0x4340)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "muls r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rd);
-    rb = read_register(rm);
-    rc = ra * rb;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+      //MOV(1) immediate
+      case Op::mov1:
+      {
+        rb = (inst >> 0) & 0xFF;
+        rd = (inst >> 8) & 0x07;
+        DO_DISS(statusMsg << "movs r" << dec << rd << ",#0x" << Base::HEX2 << rb << endl);
+        write_register(rd, rb);
+        do_nzflags(rb);
+        continue;
+      }
 
-  //MVN
-  if((inst & 0xFFC0) == 0x43C0)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "mvns r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rm);
-    rc = (~ra);
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+      //MOV(2) two low registers
+      case Op::mov2:
+      {
+        rd = (inst >> 0) & 7;
+        rn = (inst >> 3) & 7;
+        DO_DISS(statusMsg << "movs r" << dec << rd << ",r" << dec << rn << endl);
+        rc = read_register(rn);
+        //fprintf(stderr,"0x%08X\n",rc);
+        write_register(rd, rc);
+        do_nzflags(rc);
+        do_cflag_bit(0);
+        do_vflag_bit(0);
+        continue;
+      }
 
-  //NEG
-  if((inst & 0xFFC0) == 0x4240)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "negs r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rm);
-    rc = 0 - ra;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag(0, ~ra, 1);
-    do_vflag(0, ~ra, 1);
-    return 0;
-  }
+      //MOV(3)
+      case Op::mov3:
+      {
+        rd  = (inst >> 0) & 0x7;
+        rd |= (inst >> 4) & 0x8;
+        rm  = (inst >> 3) & 0xF;
+        DO_DISS(statusMsg << "mov r" << dec << rd << ",r" << dec << rm << endl);
+        rc = read_register(rm);
+        if((rd == 14) && (rm == 15))
+        {
+          //printf("mov lr,pc warning 0x%08X\n",pc-2);
+          //rc|=1;
+        }
+        if(rd == 15)
+        {
+          rc &= ~1; //write_register may do this as well
+          rc += 2;  //The program counter is special
+        }
+        write_register(rd, rc);
+        continue;
+      }
 
-  //ORR
-  if((inst & 0xFFC0) == 0x4300)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "orrs r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rd);
-    rb = read_register(rm);
-    rc = ra | rb;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+      //MUL
+      case Op::mul:
+      {
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "muls r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rd);
+        rb = read_register(rm);
+        rc = ra * rb;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-  //POP
-  if((inst & 0xFE00) == 0xBC00)
-  {
-  #if defined(THUMB_DISS)
-    statusMsg << "pop {";
-    for(ra=0,rb=0x01,rc=0;rb;rb=(rb<<1)&0xFF,ra++)
-    {
-      if(inst&rb)
+      //MVN
+      case Op::mvn:
       {
-        if(rc) statusMsg << ",";
-        statusMsg << "r" << dec << ra;
-        rc++;
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "mvns r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rm);
+        rc = (~ra);
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
       }
-    }
-    if(inst&0x100)
-    {
-      if(rc) statusMsg << ",";
-      statusMsg << "pc";
-    }
-    statusMsg << "}" << endl;
-  #endif
 
-    sp = read_register(13);
-    for(ra = 0, rb = 0x01; rb; rb = (rb << 1) & 0xFF, ra++)
-    {
-      if(inst & rb)
+      //NEG
+      case Op::neg:
       {
-        write_register(ra, read32(sp));
-        sp += 4;
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "negs r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rm);
+        rc = 0 - ra;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        do_cvflags(0, ~ra, 1);
+        continue;
       }
-    }
-    if(inst & 0x100)
-    {
-      rc = read32(sp);
-      rc += 2;
-      write_register(15, rc);
-      sp += 4;
-    }
-    write_register(13, sp);
-    return 0;
-  }
 
-  //PUSH
-  if((inst & 0xFE00) == 0xB400)
-  {
-  #if defined(THUMB_DISS)
-    statusMsg << "push {";
-    for(ra=0,rb=0x01,rc=0;rb;rb=(rb<<1)&0xFF,ra++)
-    {
-      if(inst&rb)
+      //ORR
+      case Op::orr:
       {
-        if(rc) statusMsg << ",";
-        statusMsg << "r" << dec << ra;
-        rc++;
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "orrs r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rd);
+        rb = read_register(rm);
+        rc = ra | rb;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
       }
-    }
-    if(inst&0x100)
-    {
-      if(rc) statusMsg << ",";
-      statusMsg << "lr";
-    }
-    statusMsg << "}" << endl;
-  #endif
 
-    sp = read_register(13);
-    //fprintf(stderr,"sp 0x%08X\n",sp);
-    for(ra = 0, rb = 0x01, rc = 0; rb; rb = (rb << 1) & 0xFF, ra++)
-    {
-      if(inst & rb)
+      //POP
+      case Op::pop:
       {
-        rc++;
+      #if defined(THUMB_DISS)
+        statusMsg << "pop {";
+        for(ra=0,rb=0x01,rc=0;rb;rb=(rb<<1)&0xFF,ra++)
+        {
+          if(inst&rb)
+          {
+            if(rc) statusMsg << ",";
+            statusMsg << "r" << dec << ra;
+            rc++;
+          }
+        }
+        if(inst&0x100)
+        {
+          if(rc) statusMsg << ",";
+          statusMsg << "pc";
+        }
+        statusMsg << "}" << endl;
+      #endif
+
+        sp = read_register(13);
+        for(ra = 0, rb = 0x01; rb; rb = (rb << 1) & 0xFF, ra++)
+        {
+          if(inst & rb)
+          {
+            write_register(ra, read32(sp));
+            sp += 4;
+          }
+        }
+        if(inst & 0x100)
+        {
+          rc = read32(sp);
+          rc += 2;
+          write_register(15, rc);
+          sp += 4;
+        }
+        write_register(13, sp);
+        continue;
       }
-    }
-    if(inst & 0x100) rc++;
-    rc <<= 2;
-    sp -= rc;
-    rd = sp;
-    for(ra = 0, rb = 0x01; rb; rb = (rb << 1) & 0xFF, ra++)
-    {
-      if(inst & rb)
+
+      //PUSH
+      case Op::push:
       {
-        write32(rd, read_register(ra));
-        rd += 4;
+      #if defined(THUMB_DISS)
+        statusMsg << "push {";
+        for(ra=0,rb=0x01,rc=0;rb;rb=(rb<<1)&0xFF,ra++)
+        {
+          if(inst&rb)
+          {
+            if(rc) statusMsg << ",";
+            statusMsg << "r" << dec << ra;
+            rc++;
+          }
+        }
+        if(inst&0x100)
+        {
+          if(rc) statusMsg << ",";
+          statusMsg << "lr";
+        }
+        statusMsg << "}" << endl;
+      #endif
+
+        sp = read_register(13);
+        //fprintf(stderr,"sp 0x%08X\n",sp);
+        for(ra = 0, rb = 0x01, rc = 0; rb; rb = (rb << 1) & 0xFF, ra++)
+        {
+          if(inst & rb)
+          {
+            rc++;
+          }
+        }
+        if(inst & 0x100) rc++;
+        rc <<= 2;
+        sp -= rc;
+        rd = sp;
+        for(ra = 0, rb = 0x01; rb; rb = (rb << 1) & 0xFF, ra++)
+        {
+          if(inst & rb)
+          {
+            write32(rd, read_register(ra));
+            rd += 4;
+          }
+        }
+        if(inst & 0x100)
+        {
+          rc = read_register(14);
+          write32(rd, rc);
+          if((rc & 1) == 0)
+          {
+            // FIXME fprintf(stderr,"push {lr} with an ARM address pc 0x%08X popped 0x%08X\n",pc,rc);
+          }
+        }
+        write_register(13, sp);
+        continue;
       }
-    }
-    if(inst & 0x100)
-    {
-      rc = read_register(14);
-      write32(rd, rc);
-      if((rc & 1) == 0)
+
+      //REV
+      case Op::rev:
       {
-        // FIXME fprintf(stderr,"push {lr} with an ARM address pc 0x%08X popped 0x%08X\n",pc,rc);
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "rev r" << dec << rd << ",r" << dec << rn << endl);
+        ra = read_register(rn);
+        rc  = ((ra >>  0) & 0xFF) << 24;
+        rc |= ((ra >>  8) & 0xFF) << 16;
+        rc |= ((ra >> 16) & 0xFF) <<  8;
+        rc |= ((ra >> 24) & 0xFF) <<  0;
+        write_register(rd, rc);
+        continue;
       }
-    }
-    write_register(13, sp);
-    return 0;
-  }
 
-  //REV
-  if((inst & 0xFFC0) == 0xBA00)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "rev r" << dec << rd << ",r" << dec << rn << endl);
-    ra = read_register(rn);
-    rc  = ((ra >>  0) & 0xFF) << 24;
-    rc |= ((ra >>  8) & 0xFF) << 16;
-    rc |= ((ra >> 16) & 0xFF) <<  8;
-    rc |= ((ra >> 24) & 0xFF) <<  0;
-    write_register(rd, rc);
-    return 0;
-  }
+      //REV16
+      case Op::rev16:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "rev16 r" << dec << rd << ",r" << dec << rn << endl);
+        ra = read_register(rn);
+        rc  = ((ra >>  0) & 0xFF) <<  8;
+        rc |= ((ra >>  8) & 0xFF) <<  0;
+        rc |= ((ra >> 16) & 0xFF) << 24;
+        rc |= ((ra >> 24) & 0xFF) << 16;
+        write_register(rd, rc);
+        continue;
+      }
 
-  //REV16
-  if((inst & 0xFFC0) == 0xBA40)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "rev16 r" << dec << rd << ",r" << dec << rn << endl);
-    ra = read_register(rn);
-    rc  = ((ra >>  0) & 0xFF) <<  8;
-    rc |= ((ra >>  8) & 0xFF) <<  0;
-    rc |= ((ra >> 16) & 0xFF) << 24;
-    rc |= ((ra >> 24) & 0xFF) << 16;
-    write_register(rd, rc);
-    return 0;
-  }
+      //REVSH
+      case Op::revsh:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "revsh r" << dec << rd << ",r" << dec << rn << endl);
+        ra = read_register(rn);
+        rc  = ((ra >> 0) & 0xFF) << 8;
+        rc |= ((ra >> 8) & 0xFF) << 0;
+        if(rc & 0x8000) rc |= 0xFFFF0000;
+        else            rc &= 0x0000FFFF;
+        write_register(rd, rc);
+        continue;
+      }
 
-  //REVSH
-  if((inst & 0xFFC0) == 0xBAC0)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "revsh r" << dec << rd << ",r" << dec << rn << endl);
-    ra = read_register(rn);
-    rc  = ((ra >> 0) & 0xFF) << 8;
-    rc |= ((ra >> 8) & 0xFF) << 0;
-    if(rc & 0x8000) rc |= 0xFFFF0000;
-    else            rc &= 0x0000FFFF;
-    write_register(rd, rc);
-    return 0;
-  }
+      //ROR
+      case Op::ror:
+      {
+        rd = (inst >> 0) & 0x7;
+        rs = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "rors r" << dec << rd << ",r" << dec << rs << endl);
+        rc = read_register(rd);
+        ra = read_register(rs);
+        ra &= 0xFF;
+        if(ra == 0)
+        {
+        }
+        else
+        {
+          ra &= 0x1F;
+          if(ra == 0)
+          {
+            do_cflag_bit(rc & 0x80000000);
+          }
+          else
+          {
+            do_cflag_bit(rc & (1 << (ra-1)));
+            rb = rc << (32-ra);
+            rc >>= ra;
+            rc |= rb;
+          }
+        }
+        write_register(rd, rc);
+        do_nzflags(rc);
+        continue;
+      }
 
-  //ROR
-  if((inst & 0xFFC0) == 0x41C0)
-  {
-    rd = (inst >> 0) & 0x7;
-    rs = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "rors r" << dec << rd << ",r" << dec << rs << endl);
-    rc = read_register(rd);
-    ra = read_register(rs);
-    ra &= 0xFF;
-    if(ra == 0)
-    {
-    }
-    else
-    {
-      ra &= 0x1F;
-      if(ra == 0)
+      //SBC
+      case Op::sbc:
       {
-        do_cflag_bit(rc & 0x80000000);
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "sbc r" << dec << rd << ",r" << dec << rm << endl);
+        updateFlags();
+        ra = read_register(rd);
+        rb = read_register(rm);
+        rc = ra - rb;
+        if(!(cpsr & CPSR_C)) rc--;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        if(cpsr & CPSR_C)
+          do_cvflags(ra, ~rb, 1);
+        else
+          do_cvflags(ra, ~rb, 0);
+        continue;
       }
-      else
+
+      //SETEND
+      case Op::setend:
       {
-        do_cflag_bit(rc & (1 << (ra-1)));
-        rb = rc << (32-ra);
-        rc >>= ra;
-        rc |= rb;
+        statusMsg << "setend not implemented" << endl;
+        return 1;
       }
-    }
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
 
-  //SBC
-  if((inst & 0xFFC0) == 0x4180)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "sbc r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rd);
-    rb = read_register(rm);
-    rc = ra - rb;
-    if(!(cpsr & CPSR_C)) rc--;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    if(cpsr & CPSR_C)
-    {
-      do_cflag(ra, ~rb, 1);
-      do_vflag(ra, ~rb, 1);
-    }
-    else
-    {
-      do_cflag(ra, ~rb, 0);
-      do_vflag(ra, ~rb, 0);
-    }
-    return 0;
-  }
+      //STMIA
+      case Op::stmia:
+      {
+        rn = (inst >> 8) & 0x7;
+      #if defined(THUMB_DISS)
+        statusMsg << "stmia r" << dec << rn << "!,{";
+        for(ra=0,rb=0x01,rc=0;rb;rb=(rb<<1)&0xFF,ra++)
+        {
+          if(inst & rb)
+          {
+            if(rc) statusMsg << ",";
+            statusMsg << "r" << dec << ra;
+            rc++;
+          }
+        }
+        statusMsg << "}" << endl;
+      #endif
 
-  //SETEND
-  if((inst & 0xFFF7) == 0xB650)
-  {
-    statusMsg << "setend not implemented" << endl;
-    return 1;
-  }
+        sp = read_register(rn);
+        for(ra = 0, rb = 0x01; rb; rb = (rb << 1) & 0xFF, ra++)
+        {
+          if(inst & rb)
+          {
+            write32(sp, read_register(ra));
+            sp += 4;
+          }
+        }
+        write_register(rn, sp);
+        continue;
+      }
 
-  //STMIA
-  if((inst & 0xF800) == 0xC000)
-  {
-    rn = (inst >> 8) & 0x7;
-  #if defined(THUMB_DISS)
-    statusMsg << "stmia r" << dec << rn << "!,{";
-    for(ra=0,rb=0x01,rc=0;rb;rb=(rb<<1)&0xFF,ra++)
-    {
-      if(inst & rb)
+      //STR(1)
+      case Op::str1:
       {
-        if(rc) statusMsg << ",";
-        statusMsg << "r" << dec << ra;
-        rc++;
+        rd = (inst >> 0) & 0x07;
+        rn = (inst >> 3) & 0x07;
+        rb = (inst >> 6) & 0x1F;
+        rb <<= 2;
+        DO_DISS(statusMsg << "str r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX2 << rb << "]" << endl);
+        rb = read_register(rn) + rb;
+        rc = read_register(rd);
+        write32(rb, rc);
+        continue;
       }
-    }
-    statusMsg << "}" << endl;
-  #endif
 
-    sp = read_register(rn);
-    for(ra = 0, rb = 0x01; rb; rb = (rb << 1) & 0xFF, ra++)
-    {
-      if(inst & rb)
+      //STR(2)
+      case Op::str2:
       {
-        write32(sp, read_register(ra));
-        sp += 4;
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rm = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "str r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
+        rb = read_register(rn) + read_register(rm);
+        rc = read_register(rd);
+        write32(rb, rc);
+        continue;
       }
-    }
-    write_register(rn, sp);
-    return 0;
-  }
 
-  //STR(1)
-  if((inst & 0xF800) == 0x6000)
-  {
-    rd = (inst >> 0) & 0x07;
-    rn = (inst >> 3) & 0x07;
-    rb = (inst >> 6) & 0x1F;
-    rb <<= 2;
-    DO_DISS(statusMsg << "str r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX2 << rb << "]" << endl);
-    rb = read_register(rn) + rb;
-    rc = read_register(rd);
-    write32(rb, rc);
-    return 0;
-  }
-
-  //STR(2)
-  if((inst & 0xFE00) == 0x5000)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rm = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "str r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
-    rb = read_register(rn) + read_register(rm);
-    rc = read_register(rd);
-    write32(rb, rc);
-    return 0;
-  }
+      //STR(3)
+      case Op::str3:
+      {
+        rb = (inst >> 0) & 0xFF;
+        rd = (inst >> 8) & 0x07;
+        rb <<= 2;
+        DO_DISS(statusMsg << "str r" << dec << rd << ",[SP,#0x" << Base::HEX2 << rb << "]" << endl);
+        rb = read_register(13) + rb;
+        //fprintf(stderr,"0x%08X\n",rb);
+        rc = read_register(rd);
+        write32(rb, rc);
+        continue;
+      }
 
-  //STR(3)
-  if((inst & 0xF800) == 0x9000)
-  {
-    rb = (inst >> 0) & 0xFF;
-    rd = (inst >> 8) & 0x07;
-    rb <<= 2;
-    DO_DISS(statusMsg << "str r" << dec << rd << ",[SP,#0x" << Base::HEX2 << rb << "]" << endl);
-    rb = read_register(13) + rb;
-    //fprintf(stderr,"0x%08X\n",rb);
-    rc = read_register(rd);
-    write32(rb, rc);
-    return 0;
-  }
+      //STRB(1)
+      case Op::strb1:
+      {
+        rd = (inst >> 0) & 0x07;
+        rn = (inst >> 3) & 0x07;
+        rb = (inst >> 6) & 0x1F;
+        DO_DISS(statusMsg << "strb r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX8 << rb << "]" << endl);
+        rb = read_register(rn) + rb;
+        rc = read_register(rd);
+        ra = read16(rb & (~1u));
+        if(rb & 1)
+        {
+          ra &= 0x00FF;
+          ra |= rc << 8;
+        }
+        else
+        {
+          ra &= 0xFF00;
+          ra |= rc & 0x00FF;
+        }
+        write16(rb & (~1u), ra & 0xFFFF);
+        continue;
+      }
 
-  //STRB(1)
-  if((inst & 0xF800) == 0x7000)
-  {
-    rd = (inst >> 0) & 0x07;
-    rn = (inst >> 3) & 0x07;
-    rb = (inst >> 6) & 0x1F;
-    DO_DISS(statusMsg << "strb r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX8 << rb << "]" << endl);
-    rb = read_register(rn) + rb;
-    rc = read_register(rd);
-    ra = read16(rb & (~1u));
-    if(rb & 1)
-    {
-      ra &= 0x00FF;
-      ra |= rc << 8;
-    }
-    else
-    {
-      ra &= 0xFF00;
-      ra |= rc & 0x00FF;
-    }
-    write16(rb & (~1u), ra & 0xFFFF);
-    return 0;
-  }
+      //STRB(2)
+      case Op::strb2:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rm = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "strb r" << dec << rd << ",[r" << dec << rn << ",r" << rm << "]" << endl);
+        rb = read_register(rn) + read_register(rm);
+        rc = read_register(rd);
+        ra = read16(rb & (~1u));
+        if(rb & 1)
+        {
+          ra &= 0x00FF;
+          ra |= rc << 8;
+        }
+        else
+        {
+          ra &= 0xFF00;
+          ra |= rc & 0x00FF;
+        }
+        write16(rb & (~1u), ra & 0xFFFF);
+        continue;
+      }
 
-  //STRB(2)
-  if((inst & 0xFE00) == 0x5400)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rm = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "strb r" << dec << rd << ",[r" << dec << rn << ",r" << rm << "]" << endl);
-    rb = read_register(rn) + read_register(rm);
-    rc = read_register(rd);
-    ra = read16(rb & (~1u));
-    if(rb & 1)
-    {
-      ra &= 0x00FF;
-      ra |= rc << 8;
-    }
-    else
-    {
-      ra &= 0xFF00;
-      ra |= rc & 0x00FF;
-    }
-    write16(rb & (~1u), ra & 0xFFFF);
-    return 0;
-  }
+      //STRH(1)
+      case Op::strh1:
+      {
+        rd = (inst >> 0) & 0x07;
+        rn = (inst >> 3) & 0x07;
+        rb = (inst >> 6) & 0x1F;
+        rb <<= 1;
+        DO_DISS(statusMsg << "strh r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX2 << rb << "]" << endl);
+        rb = read_register(rn) + rb;
+        rc=  read_register(rd);
+        write16(rb, rc & 0xFFFF);
+        continue;
+      }
 
-  //STRH(1)
-  if((inst & 0xF800) == 0x8000)
-  {
-    rd = (inst >> 0) & 0x07;
-    rn = (inst >> 3) & 0x07;
-    rb = (inst >> 6) & 0x1F;
-    rb <<= 1;
-    DO_DISS(statusMsg << "strh r" << dec << rd << ",[r" << dec << rn << ",#0x" << Base::HEX2 << rb << "]" << endl);
-    rb = read_register(rn) + rb;
-    rc=  read_register(rd);
-    write16(rb, rc & 0xFFFF);
-    return 0;
-  }
+      //STRH(2)
+      case Op::strh2:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rm = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "strh r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
+        rb = read_register(rn) + read_register(rm);
+        rc = read_register(rd);
+        write16(rb, rc & 0xFFFF);
+        continue;
+      }
 
-  //STRH(2)
-  if((inst & 0xFE00) == 0x5200)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rm = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "strh r" << dec << rd << ",[r" << dec << rn << ",r" << dec << rm << "]" << endl);
-    rb = read_register(rn) + read_register(rm);
-    rc = read_register(rd);
-    write16(rb, rc & 0xFFFF);
-    return 0;
-  }
+      //SUB(1)
+      case Op::sub1:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rb = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "subs r" << dec << rd << ",r" << dec << rn << ",#0x" << Base::HEX2 << rb << endl);
+        ra = read_register(rn);
+        rc = ra - rb;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        do_cvflags(ra, ~rb, 1);
+        continue;
+      }
 
-  //SUB(1)
-  if((inst & 0xFE00) == 0x1E00)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rb = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "subs r" << dec << rd << ",r" << dec << rn << ",#0x" << Base::HEX2 << rb << endl);
-    ra = read_register(rn);
-    rc = ra - rb;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag(ra, ~rb, 1);
-    do_vflag(ra, ~rb, 1);
-    return 0;
-  }
+      //SUB(2)
+      case Op::sub2:
+      {
+        rb = (inst >> 0) & 0xFF;
+        rd = (inst >> 8) & 0x07;
+        DO_DISS(statusMsg << "subs r" << dec << rd << ",#0x" << Base::HEX2 << rb << endl);
+        ra = read_register(rd);
+        rc = ra - rb;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        do_cvflags(ra, ~rb, 1);
+        continue;
+      }
 
-  //SUB(2)
-  if((inst & 0xF800) == 0x3800)
-  {
-    rb = (inst >> 0) & 0xFF;
-    rd = (inst >> 8) & 0x07;
-    DO_DISS(statusMsg << "subs r" << dec << rd << ",#0x" << Base::HEX2 << rb << endl);
-    ra = read_register(rd);
-    rc = ra - rb;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag(ra, ~rb, 1);
-    do_vflag(ra, ~rb, 1);
-    return 0;
-  }
+      //SUB(3)
+      case Op::sub3:
+      {
+        rd = (inst >> 0) & 0x7;
+        rn = (inst >> 3) & 0x7;
+        rm = (inst >> 6) & 0x7;
+        DO_DISS(statusMsg << "subs r" << dec << rd << ",r" << dec << rn << ",r" << dec << rm << endl);
+        ra = read_register(rn);
+        rb = read_register(rm);
+        rc = ra - rb;
+        write_register(rd, rc);
+        do_nzflags(rc);
+        do_cvflags(ra, ~rb, 1);
+        continue;
+      }
 
-  //SUB(3)
-  if((inst & 0xFE00) == 0x1A00)
-  {
-    rd = (inst >> 0) & 0x7;
-    rn = (inst >> 3) & 0x7;
-    rm = (inst >> 6) & 0x7;
-    DO_DISS(statusMsg << "subs r" << dec << rd << ",r" << dec << rn << ",r" << dec << rm << endl);
-    ra = read_register(rn);
-    rb = read_register(rm);
-    rc = ra - rb;
-    write_register(rd, rc);
-    do_nflag(rc);
-    do_zflag(rc);
-    do_cflag(ra, ~rb, 1);
-    do_vflag(ra, ~rb, 1);
-    return 0;
-  }
+      //SUB(4)
+      case Op::sub4:
+      {
+        rb = inst & 0x7F;
+        rb <<= 2;
+        DO_DISS(statusMsg << "sub SP,#0x" << Base::HEX2 << rb << endl);
+        ra = read_register(13);
+        ra -= rb;
+        write_register(13, ra);
+        continue;
+      }
 
-  //SUB(4)
-  if((inst & 0xFF80) == 0xB080)
-  {
-    rb = inst & 0x7F;
-    rb <<= 2;
-    DO_DISS(statusMsg << "sub SP,#0x" << Base::HEX2 << rb << endl);
-    ra = read_register(13);
-    ra -= rb;
-    write_register(13, ra);
-    return 0;
-  }
+      //SWI
+      case Op::swi:
+      {
+        rb = inst & 0xFF;
+        DO_DISS(statusMsg << "swi 0x" << Base::HEX2 << rb << endl);
 
-  //SWI
-  if((inst & 0xFF00) == 0xDF00)
-  {
-    rb = inst & 0xFF;
-    DO_DISS(statusMsg << "swi 0x" << Base::HEX2 << rb << endl);
+        if((inst & 0xFF) == 0xCC)
+        {
+          updateFlags();
+          write_register(0, cpsr);
+          continue;
+        }
+        else
+        {
+          statusMsg << endl << endl << "swi 0x" << Base::HEX2 << rb << endl;
+          return 1;
+        }
+      }
 
-    if((inst & 0xFF) == 0xCC)
-    {
-      write_register(0, cpsr);
-      return 0;
-    }
-    else
-    {
-      statusMsg << endl << endl << "swi 0x" << Base::HEX2 << rb << endl;
-      return 1;
-    }
-  }
+      //SXTB
+      case Op::sxtb:
+      {
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "sxtb r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rm);
+        rc = ra & 0xFF;
+        if(rc & 0x80)
+          rc |= (~0u) << 8;
+        write_register(rd, rc);
+        continue;
+      }
 
-  //SXTB
-  if((inst & 0xFFC0) == 0xB240)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "sxtb r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rm);
-    rc = ra & 0xFF;
-    if(rc & 0x80)
-      rc |= (~0u) << 8;
-    write_register(rd, rc);
-    return 0;
-  }
+      //SXTH
+      case Op::sxth:
+      {
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "sxth r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rm);
+        rc = ra & 0xFFFF;
+        if(rc & 0x8000)
+          rc |= (~0u) << 16;
+        write_register(rd, rc);
+        continue;
+      }
 
-  //SXTH
-  if((inst & 0xFFC0) == 0xB200)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "sxth r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rm);
-    rc = ra & 0xFFFF;
-    if(rc & 0x8000)
-      rc |= (~0u) << 16;
-    write_register(rd, rc);
-    return 0;
-  }
+      //TST
+      case Op::tst:
+      {
+        rn = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "tst r" << dec << rn << ",r" << dec << rm << endl);
+        ra = read_register(rn);
+        rb = read_register(rm);
+        rc = ra & rb;
+        do_nzflags(rc);
+        continue;
+      }
 
-  //TST
-  if((inst & 0xFFC0) == 0x4200)
-  {
-    rn = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "tst r" << dec << rn << ",r" << dec << rm << endl);
-    ra = read_register(rn);
-    rb = read_register(rm);
-    rc = ra & rb;
-    do_nflag(rc);
-    do_zflag(rc);
-    return 0;
-  }
+      //UXTB
+      case Op::uxtb:
+      {
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "uxtb r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rm);
+        rc = ra & 0xFF;
+        write_register(rd, rc);
+        continue;
+      }
 
-  //UXTB
-  if((inst & 0xFFC0) == 0xB2C0)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "uxtb r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rm);
-    rc = ra & 0xFF;
-    write_register(rd, rc);
-    return 0;
-  }
+      //UXTH
+      case Op::uxth:
+      {
+        rd = (inst >> 0) & 0x7;
+        rm = (inst >> 3) & 0x7;
+        DO_DISS(statusMsg << "uxth r" << dec << rd << ",r" << dec << rm << endl);
+        ra = read_register(rm);
+        rc = ra & 0xFFFF;
+        write_register(rd, rc);
+        continue;
+      }
 
-  //UXTH
-  if((inst & 0xFFC0) == 0xB280)
-  {
-    rd = (inst >> 0) & 0x7;
-    rm = (inst >> 3) & 0x7;
-    DO_DISS(statusMsg << "uxth r" << dec << rd << ",r" << dec << rm << endl);
-    ra = read_register(rm);
-    rc = ra & 0xFFFF;
-    write_register(rd, rc);
-    return 0;
+      case Op::invalid:
+      case Op::untranslated:
+        break;
+    }
+    break;
   }
 
   statusMsg << "invalid instruction " << Base::HEX8 << pc << " " << Base::HEX4 << inst << endl;
@@ -2341,7 +2616,7 @@ int Thumbulator::reset()
       break;
   }
 
-  cpsr = mamcr = 0;
+  cpsr = mamcr = lazyFlags = 0;
   handler_mode = false;
 
   systick_ctrl = 0x00000004;
@@ -2351,11 +2626,9 @@ int Thumbulator::reset()
 
   // fxq: don't care about below so much (maybe to guess timing???)
   instructions = fetches = reads = writes = systick_ints = 0;
+  flag_reads = flag_evals = 0;
 
   statusMsg.str("");
 
   return 0;
 }
-
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool Thumbulator::trapOnFatal = true;
@@ -86,7 +86,24 @@ class Thumbulator
 
       @param enable  Enable (the default) or disable exceptions on fatal errors
     */
-    static void trapFatalErrors(bool enable) { trapOnFatal = enable; }
+    void trapFatalErrors(bool enable) { trapOnFatal = enable; }
+
+    /**
+      Straight-line runs of instructions are normally translated once per
+      address, and executed from the translation cache afterwards.  This
+      method allows the cache to be bypassed, so that every instruction is
+      fetched and decoded as it executes (mostly useful for debugging).
+
+      @param enable  Enable (the default) or disable the translation cache
+    */
+    void cacheTranslations(bool enable);
+
+    /**
+      Discard all cached translations.  This must be called whenever the ROM
+      image is modified behind the back of the ARM (RAM is taken care of
+      internally).
+    */
+    void invalidateTranslations();
 
     /**
       Inform the Thumbulator class about the console currently in use,
@@ -96,6 +113,37 @@ class Thumbulator
     void setConsoleTiming(ConsoleTiming timing);
 
   private:
+    // One entry per instruction handler in execute(); every 16-bit
+    // instruction word is mapped to one of these once, through decodeTable
+    enum class Op : uInt8 {
+      adc, add1, add2, add3, add4, add5, add6, add7, and_, asr1, asr2, b1,
+      b2, bic, bkpt, bl, blx2, bx, cmn, cmp1, cmp2, cmp3, cps, cpy, eor,
+      ldmia, ldr1, ldr2, ldr3, ldr4, ldrb1, ldrb2, ldrh1, ldrh2, ldrsb,
+      ldrsh, lsl1, lsl2, lsr1, lsr2, mov1, mov2, mov3, mul, mvn, neg, orr,
+      pop, push, rev, rev16, revsh, ror, sbc, setend, stmia, str1, str2,
+      str3, strb1, strb2, strh1, strh2, sub1, sub2, sub3, sub4, swi, sxtb,
+      sxth, tst, uxtb, uxth, invalid, untranslated
+    };
+
+    // A pre-decoded instruction, along with the flags (CPSR >> 28) it must
+    // still produce; flags which the following instructions overwrite
+    // before reading them are dead, and aren't calculated at all
+    struct MicroOp {
+      uInt16 inst;
+      Op op;
+      uInt8 liveFlags;
+    };
+
+  private:
+    static Op decodeInstructionWord(uInt16 inst);
+    static const Op* buildDecodeTable();
+    static bool endsBlock(Op op, uInt16 inst);
+    static void flagUsage(Op op, uInt8& read, uInt8& written);
+
+    const MicroOp* translatedInstruction(uInt32 addr);
+    void translateBlock(MicroOp* code, const uInt16* mem, uInt32 index, uInt32 size);
+    void invalidateRamTranslations();
+
     uInt32 read_register(uInt32 reg);
     void write_register(uInt32 reg, uInt32 data);
     uInt32 fetch16(uInt32 addr);
@@ -107,10 +155,11 @@ class Thumbulator
     void write32(uInt32 addr, uInt32 data);
     void updateTimer(uInt32 cycles);
 
-    void do_zflag(uInt32 x);
-    void do_nflag(uInt32 x);
-    void do_cflag(uInt32 a, uInt32 b, uInt32 c);
-    void do_vflag(uInt32 a, uInt32 b, uInt32 c);
+    // N/Z/C/V are only recorded here, and evaluated into 'cpsr' by
+    // updateFlags() when an instruction actually reads them
+    void do_nzflags(uInt32 x);
+    void do_cvflags(uInt32 a, uInt32 b, uInt32 c);
+    void updateFlags(uInt32 flags = CPSR_N | CPSR_Z | CPSR_C | CPSR_V);
     void do_cflag_bit(uInt32 x);
     void do_vflag_bit(uInt32 x);
 
@@ -134,6 +183,7 @@ class Thumbulator
     bool handler_mode;
     uInt32 systick_ctrl, systick_reload, systick_count, systick_calibrate;
     uInt64 instructions, fetches, reads, writes, systick_ints;
+    uInt64 flag_reads, flag_evals;
 
     // For emulation of LPC2103's timer 1, used for NTSC/PAL/SECAM detection.
     // Register names from documentation:
@@ -144,12 +194,28 @@ class Thumbulator
 
     ostringstream statusMsg;
 
-    static bool trapOnFatal;
+    bool trapOnFatal;
 
     ConfigureFor configuration;
 
     Cartridge* myCartridge;
 
+    // Maps an instruction word to its handler (see decodeInstructionWord)
+    const Op* decodeTable;
+
+    // Translation cache, one entry per halfword of ROM and RAM
+    MicroOp romCode[ROMSIZE/2];
+    MicroOp ramCode[RAMSIZE/2];
+    bool useTranslations, ramTranslated;
+
+    // Flags (in CPSR format) still needed by the instruction being executed
+    uInt32 liveFlags;
+
+    // Flags (in CPSR format) not yet evaluated into 'cpsr', and the result
+    // and add-with-carry operands they are to be evaluated from
+    uInt32 lazyFlags;
+    uInt32 flagResult, flagA, flagB, flagCarry;
+
   private:
     // Following constructors and assignment operators not supported
     Thumbulator() = delete;
@@ -51,6 +51,7 @@ MODULE_OBJS := \
 	src/emucore/CompuMate.o \
 	src/emucore/Console.o \
 	src/emucore/Control.o \
+	src/emucore/DetectionCache.o \
 	src/emucore/Driving.o \
 	src/emucore/EventHandler.o \
 	src/emucore/FrameBuffer.o \
@@ -210,6 +210,31 @@ void Ball::tick(bool isReceivingMclock)
       myCounter = 0;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Ball::tickSpan(uInt32 clocks, uInt8* on)
+{
+  while (clocks > 0) {
+    // Until the counter hits the start position, an idle ball only counts
+    if (!myIsRendering && myCounter != 156) {
+      uInt32 idle = 0;
+
+      do {
+        if (++myCounter >= 160) myCounter = 0;
+      } while (++idle < clocks && myCounter != 156);
+
+      myIsVisible = false;
+      collision = myCollisionMaskDisabled;
+      memset(on, 0, idle);
+      on += idle;
+      clocks -= idle;
+    } else {
+      tick();
+      *on++ = isOn() ? 0xff : 0x00;
+      clocks--;
+    }
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Ball::nextLine()
 {
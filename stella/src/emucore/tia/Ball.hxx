@@ -62,9 +62,16 @@ class Ball : public Serializable
 
     void tick(bool isReceivingMclock = true);
 
+    // Same as calling tick() the given number of times, storing isOn() after
+    // each clock as 0xff / 0x00; only valid while not moving
+    void tickSpan(uInt32 clocks, uInt8* on);
+
     void nextLine();
 
     bool isOn() const { return (collision & 0x8000); }
+    uInt32 collisionMask(bool on) const {
+      return on ? myCollisionMaskEnabled : myCollisionMaskDisabled;
+    }
     uInt8 getColor() const { return myColor; }
 
     void shuffleStatus();
@@ -43,6 +43,18 @@ class DelayQueue : public Serializable
 
     template<class T> void execute(T executor);
 
+    /**
+      Answers how many of the upcoming calls to execute() would find no
+      writes to execute, up to the given maximum.
+    */
+    uInt32 idleClocks(uInt32 maxClocks) const;
+
+    /**
+      Advance the queue by the given number of clocks without executing
+      anything; only valid if idleClocks() has answered at least as much.
+    */
+    void skip(uInt32 clocks);
+
     /**
       Serializable methods (see that class for more information).
     */
@@ -120,6 +132,26 @@ void DelayQueue<length, capacity>::execute(T executor)
   myIndex = smartmod<length>(myIndex + 1);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+template<unsigned length, unsigned capacity>
+uInt32 DelayQueue<length, capacity>::idleClocks(uInt32 maxClocks) const
+{
+  // If none of the slots has an entry, the queue is idle indefinitely
+  const uInt32 slots = std::min(maxClocks, uInt32(length));
+
+  for (uInt32 i = 0; i < slots; i++)
+    if (myMembers[smartmod<length>(myIndex + i)].mySize > 0) return i;
+
+  return maxClocks;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+template<unsigned length, unsigned capacity>
+void DelayQueue<length, capacity>::skip(uInt32 clocks)
+{
+  myIndex = (myIndex + clocks) % length;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 template<unsigned length, unsigned capacity>
 bool DelayQueue<length, capacity>::save(Serializer& out) const
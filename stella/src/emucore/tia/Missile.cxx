@@ -215,6 +215,32 @@ void Missile::tick(uInt8 hclock, bool isReceivingMclock)
   if (++myCounter >= 160) myCounter = 0;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Missile::tickSpan(uInt8 hclock, uInt32 clocks, uInt8* on)
+{
+  while (clocks > 0) {
+    // Until the counter hits a start decode, an idle missile only counts
+    if (!myIsRendering && (myResmp || !myDecodes[myCounter])) {
+      uInt32 idle = 0;
+
+      do {
+        if (++myCounter >= 160) myCounter = 0;
+      } while (++idle < clocks && (myResmp || !myDecodes[myCounter]));
+
+      myIsVisible = false;
+      collision = myCollisionMaskDisabled;
+      memset(on, 0, idle);
+      on += idle;
+      hclock += idle;
+      clocks -= idle;
+    } else {
+      tick(hclock++);
+      *on++ = isOn() ? 0xff : 0x00;
+      clocks--;
+    }
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Missile::nextLine()
 {
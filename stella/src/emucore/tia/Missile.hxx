@@ -52,6 +52,10 @@ class Missile : public Serializable
 
     void tick(uInt8 hclock, bool isReceivingMclock = true);
 
+    // Same as calling tick() the given number of times, storing isOn() after
+    // each clock as 0xff / 0x00; only valid while not moving
+    void tickSpan(uInt8 hclock, uInt32 clocks, uInt8* on);
+
     void nextLine();
 
     void setColor(uInt8 color);
@@ -66,6 +70,9 @@ class Missile : public Serializable
     void toggleEnabled(bool enabled);
 
     bool isOn() const { return (collision & 0x8000); }
+    uInt32 collisionMask(bool on) const {
+      return on ? myCollisionMaskEnabled : myCollisionMaskDisabled;
+    }
     uInt8 getColor() const { return myColor; }
 
     uInt8 getPosition() const;
@@ -310,6 +310,30 @@ void Player::tick()
   if (++myCounter >= 160) myCounter = 0;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Player::tickSpan(uInt32 clocks, uInt8* on)
+{
+  while (clocks > 0) {
+    // Until the counter hits a start decode, an idle player only counts
+    if (!myIsRendering && !myDecodes[myCounter]) {
+      uInt32 idle = 0;
+
+      do {
+        if (++myCounter >= 160) myCounter = 0;
+      } while (++idle < clocks && !myDecodes[myCounter]);
+
+      collision = myCollisionMaskDisabled;
+      memset(on, 0, idle);
+      on += idle;
+      clocks -= idle;
+    } else {
+      tick();
+      *on++ = isOn() ? 0xff : 0x00;
+      clocks--;
+    }
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Player::nextLine()
 {
@@ -63,11 +63,18 @@ class Player : public Serializable
 
     void tick();
 
+    // Same as calling tick() the given number of times, storing isOn() after
+    // each clock as 0xff / 0x00; only valid while not moving
+    void tickSpan(uInt32 clocks, uInt8* on);
+
     void nextLine();
 
     uInt8 getClock() const { return myCounter; }
 
     bool isOn() const { return (collision & 0x8000); }
+    uInt32 collisionMask(bool on) const {
+      return on ? myCollisionMaskEnabled : myCollisionMaskDisabled;
+    }
     uInt8 getColor() const { return myColor; }
 
     void shufflePatterns();
@@ -207,6 +207,15 @@ void Playfield::tick(uInt32 x)
   collision = currentPixel ? myCollisionMaskEnabled : myCollisionMaskDisabled;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Playfield::tickSpan(uInt32 x, uInt32 clocks, uInt8* on)
+{
+  for (uInt32 i = 0; i < clocks; i++) {
+    tick(x + i);
+    on[i] = isOn() ? 0xff : 0x00;
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Playfield::nextLine()
 {
@@ -246,40 +255,35 @@ void Playfield::applyColors()
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8 Playfield::getColor() const
+uInt8 Playfield::getDebugColor(uInt32 x) const
 {
-  if (!myDebugEnabled)
-    return myX < 80 ? myColorLeft : myColorRight;
+  if (x < 80)
+  {
+    // left side:
+    if(x < 16)
+      return myDebugColor - 2;    // PF0
+    if(x < 48)
+      return myDebugColor;        // PF1
+  }
   else
   {
-    if (myX < 80)
+    // right side:
+    if(!myReflected)
     {
-      // left side:
-      if(myX < 16)
-        return myDebugColor - 2;    // PF0
-      if(myX < 48)
-        return myDebugColor;        // PF1
+      if(x < 80 + 16)
+        return myDebugColor - 2;  // PF0
+      if(x < 80 + 48)
+        return myDebugColor;      // PF1
     }
     else
     {
-      // right side:
-      if(!myReflected)
-      {
-        if(myX < 80 + 16)
-          return myDebugColor - 2;  // PF0
-        if(myX < 80 + 48)
-          return myDebugColor;      // PF1
-      }
-      else
-      {
-        if(myX >= 160 - 16)
-          return myDebugColor - 2;  // PF0
-        if(myX >= 160 - 48)
-          return myDebugColor;      // PF1
-      }
+      if(x >= 160 - 16)
+        return myDebugColor - 2;  // PF0
+      if(x >= 160 - 48)
+        return myDebugColor;      // PF1
     }
-    return myDebugColor + 2;        // PF2
   }
+  return myDebugColor + 2;        // PF2
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -59,10 +59,20 @@ class Playfield : public Serializable
 
     void tick(uInt32 x);
 
+    // Same as calling tick() for the given number of clocks starting at x,
+    // storing isOn() after each clock as 0xff / 0x00
+    void tickSpan(uInt32 x, uInt32 clocks, uInt8* on);
+
     void nextLine();
 
     bool isOn() const { return (collision & 0x8000); }
-    uInt8 getColor() const;
+    uInt32 collisionMask(bool on) const {
+      return on ? myCollisionMaskEnabled : myCollisionMaskDisabled;
+    }
+    uInt8 getColor() const { return getColor(myX); }
+    uInt8 getColor(uInt32 x) const {
+      return myDebugEnabled ? getDebugColor(x) : x < 80 ? myColorLeft : myColorRight;
+    }
 
     /**
       Serializable methods (see that class for more information).
@@ -83,6 +93,7 @@ class Playfield : public Serializable
 
     void applyColors();
     void updatePattern();
+    uInt8 getDebugColor(uInt32 x) const;
 
   private:
 
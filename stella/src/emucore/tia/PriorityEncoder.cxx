@@ -0,0 +1,193 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#elif defined(__SSSE3__)
+  #include <tmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  #include <arm_neon.h>
+#endif
+
+#include "TIAConstants.hxx"
+#include "PriorityEncoder.hxx"
+
+namespace {
+  // The object shown for each TIABit combination in each priority mode
+  struct PriorityTable {
+    uInt8 object[3][64];
+
+    constexpr PriorityTable() : object{}
+    {
+      using Object = PriorityEncoder::Object;
+
+      constexpr uInt8 bits[Object::numObjects] = {
+        0, P0Bit, M0Bit, P1Bit, M1Bit, BLBit, PFBit
+      };
+      // Objects from highest to lowest priority
+      constexpr uInt8 order[3][6] = {
+        { Object::PF, Object::BL, Object::P0, Object::M0, Object::P1, Object::M1 },  // pfp
+        { Object::P0, Object::M0, Object::PF, Object::P1, Object::M1, Object::BL },  // score
+        { Object::P0, Object::M0, Object::P1, Object::M1, Object::PF, Object::BL }   // normal
+      };
+
+      for (uInt32 mode = 0; mode < 3; mode++)
+        for (uInt32 combo = 0; combo < 64; combo++) {
+          object[mode][combo] = Object::BK;
+
+          for (uInt32 i = 0; i < 6; i++)
+            if (combo & bits[order[mode][i]]) {
+              object[mode][combo] = order[mode][i];
+              break;
+            }
+        }
+    }
+  };
+
+  constexpr PriorityTable ourPriorityTable;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt64 PriorityEncoder::combine(const uInt8* p0, const uInt8* m0,
+                                const uInt8* p1, const uInt8* m1,
+                                const uInt8* bl, const uInt8* pf,
+                                uInt8* bits, uInt32 clocks)
+{
+  uInt32 i = 0;
+
+#if defined(__AVX2__)
+  for (; i + 32 <= clocks; i += 32) {
+    #define BIT(obj, bit) _mm256_and_si256( \
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(obj + i)), _mm256_set1_epi8(bit))
+
+    const __m256i b = _mm256_or_si256(
+      _mm256_or_si256(BIT(p0, P0Bit), BIT(m0, M0Bit)),
+      _mm256_or_si256(_mm256_or_si256(BIT(p1, P1Bit), BIT(m1, M1Bit)),
+                      _mm256_or_si256(BIT(bl, BLBit), BIT(pf, PFBit))));
+
+    #undef BIT
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(bits + i), b);
+  }
+#elif defined(__SSE2__) || defined(_M_X64)
+  for (; i + 16 <= clocks; i += 16) {
+    #define BIT(obj, bit) _mm_and_si128( \
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(obj + i)), _mm_set1_epi8(bit))
+
+    const __m128i b = _mm_or_si128(
+      _mm_or_si128(BIT(p0, P0Bit), BIT(m0, M0Bit)),
+      _mm_or_si128(_mm_or_si128(BIT(p1, P1Bit), BIT(m1, M1Bit)),
+                   _mm_or_si128(BIT(bl, BLBit), BIT(pf, PFBit))));
+
+    #undef BIT
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bits + i), b);
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 16 <= clocks; i += 16) {
+    #define BIT(obj, bit) vandq_u8(vld1q_u8(obj + i), vdupq_n_u8(bit))
+
+    const uint8x16_t b = vorrq_u8(
+      vorrq_u8(BIT(p0, P0Bit), BIT(m0, M0Bit)),
+      vorrq_u8(vorrq_u8(BIT(p1, P1Bit), BIT(m1, M1Bit)),
+               vorrq_u8(BIT(bl, BLBit), BIT(pf, PFBit))));
+
+    #undef BIT
+    vst1q_u8(bits + i, b);
+  }
+#endif
+
+  for (; i < clocks; i++)
+    bits[i] =
+      (p0[i] & P0Bit) | (m0[i] & M0Bit) | (p1[i] & P1Bit) |
+      (m1[i] & M1Bit) | (bl[i] & BLBit) | (pf[i] & PFBit);
+
+  uInt64 combos = 0;
+  for (i = 0; i < clocks; i++)
+    combos |= uInt64(1) << bits[i];
+
+  return combos;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PriorityEncoder::buildLookup(uInt32 mode, const uInt8* colors,
+                                  uInt8* lookup)
+{
+  const uInt8* object = ourPriorityTable.object[mode];
+
+  for (uInt32 combo = 0; combo < 64; combo++)
+    lookup[combo] = colors[object[combo]];
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PriorityEncoder::resolve(const uInt8* lookup, const uInt8* bits,
+                              uInt8* out, uInt32 clocks)
+{
+  uInt32 i = 0;
+
+  // A shuffle looks up 16 entries, so the table is split into four quarters
+  // that are selected by the upper two bits of the combination
+#if defined(__AVX2__)
+  __m256i table[4];
+  for (uInt32 q = 0; q < 4; q++)
+    table[q] = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(lookup + 16 * q)));
+
+  for (; i + 32 <= clocks; i += 32) {
+    const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + i));
+    const __m256i quarter = _mm256_and_si256(_mm256_srli_epi16(b, 4), _mm256_set1_epi8(0x03));
+    __m256i color = _mm256_setzero_si256();
+
+    for (uInt32 q = 0; q < 4; q++)
+      color = _mm256_or_si256(color, _mm256_and_si256(
+        _mm256_cmpeq_epi8(quarter, _mm256_set1_epi8(char(q))),
+        _mm256_shuffle_epi8(table[q], b)));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), color);
+  }
+#elif defined(__SSSE3__)
+  __m128i table[4];
+  for (uInt32 q = 0; q < 4; q++)
+    table[q] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lookup + 16 * q));
+
+  for (; i + 16 <= clocks; i += 16) {
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bits + i));
+    const __m128i quarter = _mm_and_si128(_mm_srli_epi16(b, 4), _mm_set1_epi8(0x03));
+    __m128i color = _mm_setzero_si128();
+
+    for (uInt32 q = 0; q < 4; q++)
+      color = _mm_or_si128(color, _mm_and_si128(
+        _mm_cmpeq_epi8(quarter, _mm_set1_epi8(char(q))),
+        _mm_shuffle_epi8(table[q], b)));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), color);
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  uint8x16x4_t table;
+  table.val[0] = vld1q_u8(lookup);
+  table.val[1] = vld1q_u8(lookup + 16);
+  table.val[2] = vld1q_u8(lookup + 32);
+  table.val[3] = vld1q_u8(lookup + 48);
+
+  for (; i + 16 <= clocks; i += 16)
+    vst1q_u8(out + i, vqtbl4q_u8(table, vld1q_u8(bits + i)));
+#endif
+
+  for (; i < clocks; i++)
+    out[i] = lookup[bits[i]];
+}
@@ -0,0 +1,75 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#ifndef TIA_PRIORITY_ENCODER
+#define TIA_PRIORITY_ENCODER
+
+#include "bspf.hxx"
+
+/**
+  The priority encoder for a span of pixels. The per-pixel state of the six
+  objects is combined into TIABit combinations, which are then mapped to
+  colors through a 64 entry lookup table. Depending on the target, the
+  kernels use SSE2 / SSSE3 / AVX2 or NEON; the scalar fallback produces
+  identical output.
+*/
+class PriorityEncoder
+{
+  public:
+    /**
+      The objects that can provide the color of a pixel.
+    */
+    enum Object: uInt8 { BK, P0, M0, P1, M1, BL, PF, numObjects };
+
+  public:
+    /**
+      Combine the object states (0xff or 0x00 per pixel) into TIABit
+      combinations.
+
+      @return  A bitfield with bit n set if combination n occurred
+    */
+    static uInt64 combine(const uInt8* p0, const uInt8* m0, const uInt8* p1,
+                          const uInt8* m1, const uInt8* bl, const uInt8* pf,
+                          uInt8* bits, uInt32 clocks);
+
+    /**
+      Build the lookup table from TIABit combinations to colors for the
+      given priority mode (pfp, score, normal; see TIA::renderPixel).
+
+      @param mode    The priority mode
+      @param colors  The object colors, indexed by Object
+      @param lookup  The 64 entry table to fill
+    */
+    static void buildLookup(uInt32 mode, const uInt8* colors, uInt8* lookup);
+
+    /**
+      Map TIABit combinations to colors.
+    */
+    static void resolve(const uInt8* lookup, const uInt8* bits, uInt8* out,
+                        uInt32 clocks);
+
+  private:
+    // Following constructors and assignment operators not supported
+    PriorityEncoder() = delete;
+    PriorityEncoder(const PriorityEncoder&) = delete;
+    PriorityEncoder(PriorityEncoder&&) = delete;
+    PriorityEncoder& operator=(const PriorityEncoder&) = delete;
+    PriorityEncoder& operator=(PriorityEncoder&&) = delete;
+};
+
+#endif // TIA_PRIORITY_ENCODER
@@ -22,6 +22,7 @@
 #include "Paddles.hxx"
 #include "DelayQueueIteratorImpl.hxx"
 #include "TIAConstants.hxx"
+#include "PriorityEncoder.hxx"
 #include "frame-manager/FrameManager.hxx"
 
 #ifdef DEBUGGER_SUPPORT
@@ -77,10 +78,11 @@ TIA::TIA(Console& console, Sound& sound, Settings& settings)
     myPlayer1(~CollisionMask::player1 & 0x7FFF),
     myBall(~CollisionMask::ball & 0x7FFF),
     mySpriteEnabledBits(0xFF),
-    myCollisionsEnabledBits(0xFF)
+    myCollisionsEnabledBits(0xFF),
+    myRenderingEnabled(true),
+    myAudioEnabled(true)
 {
-  bool devSettings = mySettings.getBool("dev.settings");
-  myTIAPinsDriven = mySettings.getBool(devSettings ? "dev.tiadriven" : "plr.tiadriven");
+  myTIAPinsDriven = mySettings.getBool(mySettings.activeId(Settings::PlrTIADriven));
 
   myBackground.setTIA(this);
   myPlayfield.setTIA(this);
@@ -90,8 +92,8 @@ TIA::TIA(Console& console, Sound& sound, Settings& settings)
   myMissile1.setTIA(this);
   myBall.setTIA(this);
 
-  myEnableJitter = mySettings.getBool(devSettings ? "dev.tv.jitter" : "plr.tv.jitter");
-  myJitterFactor = mySettings.getInt(devSettings ? "dev.tv.jitter_recovery" : "plr.tv.jitter_recovery");
+  myEnableJitter = mySettings.getBool(mySettings.activeId(Settings::PlrTVJitter));
+  myJitterFactor = mySettings.getInt(mySettings.activeId(Settings::PlrTVJitterRecovery));
 
   reset();
 }
@@ -134,6 +136,7 @@ void TIA::reset()
   myExtendedHblank = false;
   myMovementClock = 0;
   myPriority = Priority::normal;
+  mySpanRendering = mySettings.getBool(Settings::TIASpans);
   myHstate = HState::blank;
   myCollisionMask = 0;
   myLinesSinceChange = 0;
@@ -175,8 +178,8 @@ void TIA::reset()
   }
 
   // Must be done last, after all other items have reset
-  enableFixedColors(mySettings.getBool(mySettings.getBool("dev.settings") ? "dev.debugcolors" : "plr.debugcolors"));
-  setFixedColorPalette(mySettings.getString("tia.dbgcolors"));
+  enableFixedColors(mySettings.getBool(mySettings.activeId(Settings::PlrDebugColors)));
+  setFixedColorPalette(mySettings.getString(Settings::TIADbgColors));
 
 #ifdef DEBUGGER_SUPPORT
   createAccessBase();
@@ -187,8 +190,8 @@ void TIA::reset()
 void TIA::frameReset()
 {
   memset(myFramebuffer, 0, 160 * TIAConstants::frameBufferHeight);
-  myAutoFrameEnabled = mySettings.getInt("framerate") <= 0;
-  enableColorLoss(mySettings.getBool("dev.settings") ? "dev.colorloss" : "plr.colorloss");
+  myAutoFrameEnabled = mySettings.getInt(Settings::FrameRate) <= 0;
+  enableColorLoss(mySettings.getBool(mySettings.activeId(Settings::PlrColorLoss)));
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -227,7 +230,7 @@ bool TIA::save(Serializer& out) const
   {
     out.putString(name());
 
-    if(!mySound.save(out)) return false;
+    if(!out.isTransient() && !mySound.save(out)) return false;
 
     if(!myDelayQueue.save(out))   return false;
     if(!myFrameManager->save(out)) return false;
@@ -298,7 +301,7 @@ bool TIA::load(Serializer& in)
     if(in.getString() != name())
       return false;
 
-    if(!mySound.load(in)) return false;
+    if(!in.isTransient() && !mySound.load(in)) return false;
 
     if(!myDelayQueue.load(in))   return false;
     if(!myFrameManager->load(in)) return false;
@@ -524,27 +527,27 @@ bool TIA::poke(uInt16 address, uInt8 value)
     ////////////////////////////////////////////////////////////
     // FIXME - rework this when we add the new sound core
     case AUDV0:
-      mySound.set(address, value, mySystem->cycles());
+      if(myAudioEnabled) mySound.set(address, value, mySystem->cycles());
       myShadowRegisters[address] = value;
       break;
     case AUDV1:
-      mySound.set(address, value, mySystem->cycles());
+      if(myAudioEnabled) mySound.set(address, value, mySystem->cycles());
       myShadowRegisters[address] = value;
       break;
     case AUDF0:
-      mySound.set(address, value, mySystem->cycles());
+      if(myAudioEnabled) mySound.set(address, value, mySystem->cycles());
       myShadowRegisters[address] = value;
       break;
     case AUDF1:
-      mySound.set(address, value, mySystem->cycles());
+      if(myAudioEnabled) mySound.set(address, value, mySystem->cycles());
       myShadowRegisters[address] = value;
       break;
     case AUDC0:
-      mySound.set(address, value, mySystem->cycles());
+      if(myAudioEnabled) mySound.set(address, value, mySystem->cycles());
       myShadowRegisters[address] = value;
       break;
     case AUDC1:
-      mySound.set(address, value, mySystem->cycles());
+      if(myAudioEnabled) mySound.set(address, value, mySystem->cycles());
       myShadowRegisters[address] = value;
       break;
     ////////////////////////////////////////////////////////////
@@ -1014,7 +1017,7 @@ bool TIA::driveUnusedPinsRandom(uInt8 mode)
   if (mode == 0 || mode == 1)
   {
     myTIAPinsDriven = bool(mode);
-    mySettings.setValue(mySettings.getBool("dev.settings") ? "dev.tiadriven" : "plr.tiadriven", myTIAPinsDriven);
+    mySettings.setValue(mySettings.activeId(Settings::PlrTIADriven), myTIAPinsDriven);
   }
   return myTIAPinsDriven;
 }
@@ -1142,12 +1145,12 @@ void TIA::onFrameComplete()
   mySystem->m6502().stop();
   myCyclesAtFrameStart = mySystem->cycles();
 
-  if (myXAtRenderingStart > 0)
+  if (myXAtRenderingStart > 0 && myRenderingEnabled)
     memset(myFramebuffer, 0, myXAtRenderingStart);
 
   // Blank out any extra lines not drawn this frame
   const Int32 missingScanlines = myFrameManager->missingScanlines();
-  if (missingScanlines > 0)
+  if (missingScanlines > 0 && myRenderingEnabled)
     memset(myFramebuffer + 160 * myFrameManager->getY(), 0, missingScanlines * 160);
 
   // Recalculate framerate, attempting to auto-correct for scanline 'jumps'
@@ -1168,6 +1171,15 @@ void TIA::cycle(uInt32 colorClocks)
 {
   for (uInt32 i = 0; i < colorClocks; i++)
   {
+    const uInt32 span = spanClocks(colorClocks - i);
+
+    if (span > 1) {
+      cycleSpan(span);
+      i += span - 1;
+
+      continue;
+    }
+
     myDelayQueue.execute(
       [this] (uInt8 address, uInt8 value) {delayedWrite(address, value);}
     );
@@ -1192,6 +1204,116 @@ void TIA::cycle(uInt32 colorClocks)
   }
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 TIA::spanClocks(uInt32 maxClocks) const
+{
+  if (!mySpanRendering || myMovementInProgress) return 1;
+
+  uInt32 clocks = std::min(maxClocks, 228u - myHctr);
+
+  // While the line cache is active, nothing but the counters change
+  if (myLinesSinceChange < 2) {
+    if (myHstate == HState::blank) {
+      // Only the part of hblank without state transitions is skipped
+      if (myHctr == 0 || myHctr >= 67) return 1;
+
+      clocks = std::min(clocks, 67u - myHctr);
+    }
+    // RSYNC shifts pixels out of the visible area; also, the playfield
+    // collision is only valid once it has been ticked
+    else if (myHctrDelta != 0 || myPlayfield.collision == 0) return 1;
+  }
+
+  return myDelayQueue.idleClocks(clocks);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void TIA::cycleSpan(uInt32 clocks)
+{
+  myDelayQueue.skip(clocks);
+
+  myCollisionUpdateRequired = false;
+
+  if (myLinesSinceChange < 2 && myHstate == HState::frame)
+    renderSpan(clocks);
+
+  myHctr += clocks;
+  if (myHctr >= 228)
+    nextLine();
+
+  myTimestamp += clocks;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void TIA::renderSpan(uInt32 clocks)
+{
+  const uInt32 x = myHctr - 68;
+  uInt8 pf[160], m0[160], m1[160], p0[160], p1[160], bl[160];
+
+  myCollisionUpdateRequired = true;
+
+  // The objects don't influence each other, so they can be ticked one after
+  // another instead of clock by clock
+  myPlayfield.tickSpan(x, clocks, pf);
+  myMissile0.tickSpan(myHctr, clocks, m0);
+  myMissile1.tickSpan(myHctr, clocks, m1);
+  myPlayer0.tickSpan(clocks, p0);
+  myPlayer1.tickSpan(clocks, p1);
+  myBall.tickSpan(clocks, bl);
+
+  const bool vblank = myFrameManager->vblank();
+  uInt8* buffer = myFramebuffer + myFrameManager->getY() * 160 + x;
+  uInt8 bits[160];
+
+  const uInt64 combos =
+    PriorityEncoder::combine(p0, m0, p1, m1, bl, pf, bits, clocks);
+
+  if (drawsFramebuffer()) {
+    if (vblank)
+      memset(buffer, 0, clocks);
+    else {
+      uInt8 colors[PriorityEncoder::numObjects] = {
+        myBackground.getColor(),
+        myPlayer0.getColor(), myMissile0.getColor(),
+        myPlayer1.getColor(), myMissile1.getColor(),
+        myBall.getColor(), myPlayfield.getColor(x)
+      };
+      uInt8 lookup[64];
+      uInt32 start = 0;
+
+      PriorityEncoder::buildLookup(myPriority, colors, lookup);
+
+      // The playfield color is constant within each 16 pixel block (even
+      // with debug colors), so the lookup only changes on block boundaries
+      for (uInt32 i = 16 - (x & 15); i < clocks; i += 16) {
+        const uInt8 color = myPlayfield.getColor(x + i);
+
+        if (color == colors[PriorityEncoder::PF]) continue;
+
+        PriorityEncoder::resolve(lookup, bits + start, buffer + start, i - start);
+
+        start = i;
+        colors[PriorityEncoder::PF] = color;
+        PriorityEncoder::buildLookup(myPriority, colors, lookup);
+      }
+
+      PriorityEncoder::resolve(lookup, bits + start, buffer + start, clocks - start);
+    }
+  }
+
+  // Every combination of objects that occurred latches its collisions
+  if (!vblank)
+    for (uInt32 combo = 0; combo < 64; combo++)
+      if (combos & (uInt64(1) << combo))
+        myCollisionMask |=
+          myPlayer0.collisionMask(combo & P0Bit) &
+          myPlayer1.collisionMask(combo & P1Bit) &
+          myMissile0.collisionMask(combo & M0Bit) &
+          myMissile1.collisionMask(combo & M1Bit) &
+          myBall.collisionMask(combo & BLBit) &
+          myPlayfield.collisionMask(combo & PFBit);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void TIA::tickMovement()
 {
@@ -1250,7 +1372,7 @@ void TIA::tickHframe()
   myPlayer1.tick();
   myBall.tick();
 
-  if (myFrameManager->isRendering())
+  if (drawsFramebuffer())
     renderPixel(x, y);
 }
 
@@ -1260,7 +1382,7 @@ void TIA::applyRsync()
   const uInt32 x = myHctr > 68 ? myHctr - 68 : 0;
 
   myHctrDelta = 225 - myHctr;
-  if (myFrameManager->isRendering())
+  if (drawsFramebuffer())
     memset(myFramebuffer + myFrameManager->getY() * 160 + x, 0, 160 - x);
 
   myHctr = 225;
@@ -1298,7 +1420,7 @@ void TIA::cloneLastLine()
 {
   const auto y = myFrameManager->getY();
 
-  if (!myFrameManager->isRendering() || y == 0) return;
+  if (!drawsFramebuffer() || y == 0) return;
 
   uInt8* buffer = myFramebuffer;
 
@@ -1398,7 +1520,7 @@ void TIA::flushLineCache()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void TIA::clearHmoveComb()
 {
-  if (myFrameManager->isRendering() && myHstate == HState::blank)
+  if (drawsFramebuffer() && myHstate == HState::blank)
     memset(myFramebuffer + myFrameManager->getY() * 160, myColorHBlank, 8);
 }
 
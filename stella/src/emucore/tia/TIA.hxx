@@ -237,6 +237,25 @@ class TIA : public Device
     */
     bool enableColorLoss(bool enabled);
 
+    /**
+      Enables/disables drawing into the framebuffer.  Everything else
+      (ie, collisions) is still emulated; meant for frames which are
+      never shown.
+
+      @param enabled  Whether to draw the frames
+    */
+    void enableRendering(bool enabled) { myRenderingEnabled = enabled; }
+
+    /**
+      Enables/disables passing the audio register writes on to the sound
+      device, so that emulating frames which are thrown away again leaves
+      the sound output untouched.  This doesn't affect the state format;
+      see Serializer::setTransient() for skipping the sound device there.
+
+      @param enabled  Whether to generate sound
+    */
+    void enableAudio(bool enabled) { myAudioEnabled = enabled; }
+
     /**
       Answers whether color-loss is enabled.
 
@@ -495,6 +514,25 @@ class TIA : public Device
      */
     void cycle(uInt32 colorClocks);
 
+    /**
+     * Determine how many of the next (at most maxClocks) clocks can be
+     * processed as a single span by cycleSpan(). Spans never contain a
+     * delayed register write, a line wrap or HMOVE movement.
+     */
+    uInt32 spanClocks(uInt32 maxClocks) const;
+
+    /**
+     * Execute a span of clocks determined by spanClocks(). The result is
+     * identical to executing the clocks one by one.
+     */
+    void cycleSpan(uInt32 clocks);
+
+    /**
+     * Tick all objects and render the pixels for a span of clocks during the
+     * visible part of the scanline.
+     */
+    void renderSpan(uInt32 clocks);
+
     /**
      * Advance the movement logic by a single clock.
      */
@@ -520,6 +558,13 @@ class TIA : public Device
      */
     void renderPixel(uInt32 x, uInt32 y);
 
+    /**
+     * Is the current frame drawn into the framebuffer?
+     */
+    bool drawsFramebuffer() const {
+      return myRenderingEnabled && myFrameManager->isRendering();
+    }
+
     /**
      * Clear the first 8 pixels of a scanline with black if we are in hblank
      * (called during HMOVE).
@@ -718,6 +763,12 @@ class TIA : public Device
      */
     Priority myPriority;
 
+    /**
+     * Process runs of clocks without register writes as spans instead of
+     * clock by clock?
+     */
+    bool mySpanRendering;
+
     /**
      * The index of the last CPU cycle that was included in the simulation.
      */
@@ -757,6 +808,13 @@ class TIA : public Device
      */
     bool myAutoFrameEnabled;
 
+    /**
+     * Host-side switches for skipping the framebuffer and sound output (see
+     * enableRendering() and enableAudio()); not part of the state.
+     */
+    bool myRenderingEnabled;
+    bool myAudioEnabled;
+
     /**
      * Indicates if color loss should be enabled or disabled.  Color loss
      * occurs on PAL-like systems when the previous frame contains an odd
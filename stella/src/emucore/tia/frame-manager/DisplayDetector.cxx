@@ -0,0 +1,133 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "DisplayDetector.hxx"
+
+/**
+ * Misc. numeric constants used in the algorithm.
+ */
+enum Metrics: uInt32 {
+  // the length of a full layout detection run; this decides when the majority is final
+  layoutDetectionFrames     = 60,
+
+  // ystart is final after being locked to the same value for this number of frames
+  stableYStartFrames        = 20
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+DisplayDetector::DisplayDetector()
+  : myLayoutFixed(false),
+    myStableYStartFrames(0),
+    myLastYStart(0)
+{
+  myYStartDetectorNTSC.setLayout(FrameLayout::ntsc);
+  myYStartDetectorPAL.setLayout(FrameLayout::pal);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+FrameLayout DisplayDetector::detectedLayout() const
+{
+  return myLayoutFixed ? layout() : myLayoutDetector.detectedLayout();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 DisplayDetector::detectedYStart() const
+{
+  return ystartDetector().detectedYStart();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool DisplayDetector::layoutDetected() const
+{
+  return myLayoutFixed || myLayoutDetector.isFinal(Metrics::layoutDetectionFrames);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool DisplayDetector::ystartDetected() const
+{
+  return myStableYStartFrames >= Metrics::stableYStartFrames;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void DisplayDetector::setLayout(FrameLayout layout)
+{
+  myLayoutFixed = true;
+  this->layout(layout);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void DisplayDetector::onReset()
+{
+  myLayoutDetector.reset();
+  myYStartDetectorNTSC.reset();
+  myYStartDetectorPAL.reset();
+
+  myStableYStartFrames = 0;
+  myLastYStart = 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void DisplayDetector::onSetVsync()
+{
+  myLayoutDetector.setVsync(myVsync);
+  myYStartDetectorNTSC.setVsync(myVsync);
+  myYStartDetectorPAL.setVsync(myVsync);
+
+  updateFrame();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void DisplayDetector::onSetVblank()
+{
+  myLayoutDetector.setVblank(myVblank);
+  myYStartDetectorNTSC.setVblank(myVblank);
+  myYStartDetectorPAL.setVblank(myVblank);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void DisplayDetector::onNextLine()
+{
+  myLayoutDetector.nextLine();
+  myYStartDetectorNTSC.nextLine();
+  myYStartDetectorPAL.nextLine();
+
+  updateFrame();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void DisplayDetector::updateFrame()
+{
+  if (myLayoutDetector.frameCount() == myTotalFrames) return;
+
+  const YStartDetector& detector = ystartDetector();
+
+  if (detector.isLocked() && detector.detectedYStart() == myLastYStart)
+    myStableYStartFrames++;
+  else
+    myStableYStartFrames = 0;
+
+  myLastYStart = detector.detectedYStart();
+
+  notifyFrameComplete();
+  notifyFrameStart();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const YStartDetector& DisplayDetector::ystartDetector() const
+{
+  return detectedLayout() == FrameLayout::pal ? myYStartDetectorPAL : myYStartDetectorNTSC;
+}
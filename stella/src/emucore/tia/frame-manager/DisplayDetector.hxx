@@ -0,0 +1,130 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef TIA_DISPLAY_DETECTOR
+#define TIA_DISPLAY_DETECTOR
+
+#include "AbstractFrameManager.hxx"
+#include "FrameLayoutDetector.hxx"
+#include "YStartDetector.hxx"
+
+/**
+ * This frame manager detects both the frame layout and ystart in a single pass. It
+ * feeds the same scanlines to a layout detector and to one ystart detector per
+ * layout, so the ystart for whichever layout is detected is available at the end.
+ *
+ * Frames follow the layout detector. Detection can stop as soon as the results are
+ * known not to change anymore (see layoutDetected() and ystartDetected()).
+ */
+class DisplayDetector: public AbstractFrameManager {
+  public:
+
+    DisplayDetector();
+
+  public:
+
+    /**
+     * The detected frame layout (or the one configured via setLayout()).
+     */
+    FrameLayout detectedLayout() const;
+
+    /**
+     * The detected ystart value for detectedLayout().
+     */
+    uInt32 detectedYStart() const;
+
+    /**
+     * Is the detected layout final? This is the case once the remaining frames of
+     * a full detection run can't change the majority anymore.
+     */
+    bool layoutDetected() const;
+
+    /**
+     * Is the detected ystart final? This is the case once it has been locked for
+     * a number of frames.
+     */
+    bool ystartDetected() const;
+
+    /**
+     * Configure a known frame layout; only ystart is detected then.
+     */
+    void setLayout(FrameLayout layout) override;
+
+  protected:
+
+    /**
+     * Hook into vsync changes.
+     */
+    void onSetVsync() override;
+
+    /**
+     * Hook into vblank changes.
+     */
+    void onSetVblank() override;
+
+    /**
+     * Hook into reset.
+     */
+    void onReset() override;
+
+    /**
+     * Hook into line changes.
+     */
+    void onNextLine() override;
+
+  private:
+
+    /**
+     * Finish our frame if the layout detector finished its frame.
+     */
+    void updateFrame();
+
+    /**
+     * The ystart detector for the detected layout.
+     */
+    const YStartDetector& ystartDetector() const;
+
+  private:
+
+    /**
+     * The detectors all this is delegated to.
+     */
+    FrameLayoutDetector myLayoutDetector;
+    YStartDetector myYStartDetectorNTSC, myYStartDetectorPAL;
+
+    /**
+     * Was the layout configured from outside?
+     */
+    bool myLayoutFixed;
+
+    /**
+     * The number of consecutive frames for which ystart has been locked to the
+     * same value.
+     */
+    uInt32 myStableYStartFrames;
+    uInt32 myLastYStart;
+
+  private:
+
+    DisplayDetector(const DisplayDetector&) = delete;
+    DisplayDetector(DisplayDetector&&) = delete;
+    DisplayDetector& operator=(const DisplayDetector&) = delete;
+    DisplayDetector& operator=(DisplayDetector&&) = delete;
+
+};
+
+#endif // TIA_DISPLAY_DETECTOR
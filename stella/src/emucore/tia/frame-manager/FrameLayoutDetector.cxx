@@ -42,6 +42,17 @@ FrameLayout FrameLayoutDetector::detectedLayout() const{
   return myPalFrames > myNtscFrames ? FrameLayout::pal : FrameLayout::ntsc;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool FrameLayoutDetector::isFinal(uInt32 totalFrames) const
+{
+  // Each of the remaining frames adds (at most) one vote
+  const uInt32 remaining = totalFrames > myTotalFrames ? totalFrames - myTotalFrames : 0;
+
+  return myPalFrames > myNtscFrames ?
+    myPalFrames > myNtscFrames + remaining :
+    myNtscFrames >= myPalFrames + remaining;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void FrameLayoutDetector::onReset()
 {
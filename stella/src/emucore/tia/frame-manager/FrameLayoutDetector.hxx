@@ -37,6 +37,12 @@ class FrameLayoutDetector: public AbstractFrameManager {
      */
     FrameLayout detectedLayout() const;
 
+    /**
+     * Can the detected frame layout still change if detection runs until the given
+     * total number of frames?
+     */
+    bool isFinal(uInt32 totalFrames) const;
+
   protected:
 
     /**
@@ -52,6 +52,12 @@ uInt32 YStartDetector::detectedYStart() const
   return myLastVblankLines;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool YStartDetector::isLocked() const
+{
+  return myVblankMode == VblankMode::locked;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void YStartDetector::onReset()
 {
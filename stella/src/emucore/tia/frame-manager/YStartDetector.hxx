@@ -37,6 +37,11 @@ class YStartDetector: public AbstractFrameManager {
      */
     uInt32 detectedYStart() const;
 
+    /**
+     * Has the detector settled on a ystart value (locked mode)?
+     */
+    bool isLocked() const;
+
     /**
      * We require frame layout to be set from outside.
      */
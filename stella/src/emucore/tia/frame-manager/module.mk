@@ -5,6 +5,7 @@ MODULE_OBJS := \
 	src/emucore/tia/frame-manager/AbstractFrameManager.o \
 	src/emucore/tia/frame-manager/FrameLayoutDetector.o \
 	src/emucore/tia/frame-manager/YStartDetector.o \
+	src/emucore/tia/frame-manager/DisplayDetector.o \
 	src/emucore/tia/frame-manager/JitterEmulation.o
 
 MODULE_DIRS += \
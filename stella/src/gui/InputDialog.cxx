@@ -315,15 +315,27 @@ void InputDialog::saveConfig()
   Joystick::setDeadZone(deadzone);
 
   // Paddle speed (digital and mouse)
-  int sensitivity = myDPaddleSpeed->getValue();
-  instance().settings().setValue("dsense", sensitivity);
-  Paddles::setDigitalSensitivity(sensitivity);
-  sensitivity = myMPaddleSpeed->getValue();
-  instance().settings().setValue("msense", sensitivity);
-  Paddles::setMouseSensitivity(sensitivity);
+  // Paddles created later pick these up from the settings
+  int dsensitivity = myDPaddleSpeed->getValue();
+  instance().settings().setValue("dsense", dsensitivity);
+  int msensitivity = myMPaddleSpeed->getValue();
+  instance().settings().setValue("msense", msensitivity);
+  if(instance().hasConsole())
+  {
+    Console& console = instance().console();
+    for(Controller* controller: { &console.leftController(), &console.rightController() })
+    {
+      if(controller->type() == Controller::Paddles)
+      {
+        Paddles* paddles = static_cast<Paddles*>(controller);
+        paddles->setDigitalSensitivity(dsensitivity);
+        paddles->setMouseSensitivity(msensitivity);
+      }
+    }
+  }
 
   // Trackball speed
-  sensitivity = myTrackBallSpeed->getValue();
+  int sensitivity = myTrackBallSpeed->getValue();
   instance().settings().setValue("tsense", sensitivity);
   PointingDevice::setSensitivity(sensitivity);
 
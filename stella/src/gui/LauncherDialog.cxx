@@ -34,6 +34,7 @@
 #include "StellaKeys.hxx"
 #include "Props.hxx"
 #include "PropsSet.hxx"
+#include "RomIndex.hxx"
 #include "RomInfoWidget.hxx"
 #include "Settings.hxx"
 #include "StringListWidget.hxx"
@@ -206,7 +207,11 @@ const string& LauncherDialog::selectedRomMD5()
 
   // Make sure we have a valid md5 for this ROM
   if(myGameList->md5(item) == "")
-    myGameList->setMd5(item, MD5::hash(node));
+  {
+    RomIndex::Entry entry;
+    myGameList->setMd5(item, instance().romIndex().get(node, entry) ?
+                             entry.md5 : MD5::hash(node));
+  }
 
   return myGameList->md5(item);
 }
@@ -304,10 +309,16 @@ void LauncherDialog::loadDirListing()
     myGameList->appendGame(" [..]", "", "", true);
 
   // Now add the directory entries
+  FSList roms;
   bool domatch = myPattern && myPattern->getText() != "";
   for(const auto& f: files)
   {
     bool isDir = f.isDirectory();
+
+    // All ROMs are indexed, whether they're currently shown or not
+    string extension;
+    if(!isDir && LauncherFilterDialog::isValidRomName(f, extension))
+      roms.push_back(f);
     const string& name = isDir ? (" [" + f.getName() + "]") : f.getName();
 
     // Honour the filtering settings
@@ -328,6 +339,10 @@ void LauncherDialog::loadDirListing()
     myGameList->appendGame(name, f.getPath(), "", isDir);
   }
 
+  // New and changed ROMs are hashed in the background, so that their
+  // information is ready by the time they're selected
+  instance().romIndex().update(myCurrentNode, roms);
+
   // Sort the list by rom name (since that's what we see in the listview)
   myGameList->sortByName();
 }
@@ -345,7 +360,11 @@ void LauncherDialog::loadRomInfo()
   {
     // Make sure we have a valid md5 for this ROM
     if(myGameList->md5(item) == "")
-      myGameList->setMd5(item, MD5::hash(node));
+    {
+      RomIndex::Entry entry;
+      myGameList->setMd5(item, instance().romIndex().get(node, entry) ?
+                               entry.md5 : MD5::hash(node));
+    }
 
     // Get the properties for this entry
     Properties props;
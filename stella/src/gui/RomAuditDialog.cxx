@@ -26,9 +26,7 @@
 #include "Font.hxx"
 #include "MessageBox.hxx"
 #include "FrameBuffer.hxx"
-#include "MD5.hxx"
-#include "Props.hxx"
-#include "PropsSet.hxx"
+#include "RomIndex.hxx"
 #include "Settings.hxx"
 #include "RomAuditDialog.hxx"
 
@@ -123,45 +121,56 @@ void RomAuditDialog::auditRoms()
   files.reserve(2048);
   node.getChildren(files, FilesystemNode::kListFilesOnly);
 
+  FSList roms;
+  StringList extensions;
+  for(const auto& f: files)
+  {
+    string extension;
+    if(f.isFile() && LauncherFilterDialog::isValidRomName(f, extension))
+    {
+      roms.push_back(f);
+      extensions.push_back(extension);
+    }
+  }
+
+  // The ROM index calculates the MD5 (and gets the rest of the info from
+  // the PropertiesSet) for each new or changed file, using all cores
+  RomIndex& index = instance().romIndex();
+  index.update(node, roms);
+
   // Create a progress dialog box to show the progress of processing
   // the ROMs, since this is usually a time-consuming operation
   ProgressDialog progress(this, instance().frameBuffer().font(),
                           "Auditing ROM files ...");
-  progress.setRange(0, int(files.size()) - 1, 5);
+  progress.setRange(0, int(roms.size()) - 1, 5);
+
+  // Update the progress bar while the index catches up
+  uInt32 pending;
+  while((pending = index.wait(50)) > 0)
+    progress.setProgress(std::max(int(roms.size()) - int(pending), 0));
 
-  // Create a entry for the GameList for each file
-  Properties props;
   int renamed = 0, notfound = 0;
-  for(uInt32 idx = 0; idx < files.size(); idx++)
+  for(uInt32 idx = 0; idx < roms.size(); idx++)
   {
     bool renameSucceeded = false;
-    string extension;
-    if(files[idx].isFile() &&
-       LauncherFilterDialog::isValidRomName(files[idx], extension))
+    RomIndex::Entry entry;
+
+    // Only rename the file if we found a valid properties entry
+    if(index.get(roms[idx], entry) &&
+       entry.name != "" && entry.name != roms[idx].getName())
     {
-      // Calculate the MD5 so we can get the rest of the info
-      // from the PropertiesSet (stella.pro)
-      const string& md5 = MD5::hash(files[idx]);
-      if(instance().propSet().getMD5(md5, props))
+      const string oldfile = roms[idx].getPath();
+      const string& newfile = node.getPath() + entry.name + "." + extensions[idx];
+      if(oldfile != newfile && roms[idx].rename(newfile))
       {
-        const string& name = props.get(Cartridge_Name);
-
-        // Only rename the file if we found a valid properties entry
-        if(name != "" && name != files[idx].getName())
-        {
-          const string& newfile = node.getPath() + name + "." + extension;
-          if(files[idx].getPath() != newfile && files[idx].rename(newfile))
-            renameSucceeded = true;
-        }
+        index.rename(oldfile, newfile);
+        renameSucceeded = true;
       }
-      if(renameSucceeded)
-        ++renamed;
-      else
-        ++notfound;
     }
-
-    // Update the progress bar, indicating one more ROM has been processed
-    progress.setProgress(idx);
+    if(renameSucceeded)
+      ++renamed;
+    else
+      ++notfound;
   }
   progress.close();
 
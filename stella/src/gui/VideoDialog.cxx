@@ -436,7 +436,8 @@ void VideoDialog::saveConfig()
   // Multi-threaded rendering
   instance().settings().setValue("threads", myUseThreads->getState());
   if(instance().hasConsole())
-    instance().frameBuffer().tiaSurface().ntsc().enableThreading(myUseThreads->getState());
+    instance().frameBuffer().tiaSurface().ntsc().enableThreading(myUseThreads->getState(),
+        instance().settings().getInt("threadcount"));
 
   // TV Mode
   instance().settings().setValue("tv.filter",
@@ -0,0 +1,93 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#ifndef FRAMEBUFFER_HEADLESS_HXX
+#define FRAMEBUFFER_HEADLESS_HXX
+
+class OSystem;
+
+#include "bspf.hxx"
+#include "FrameBuffer.hxx"
+#include "FBSurface.hxx"
+
+/**
+  This class implements a framebuffer that never opens a window.  It is
+  used when the emulation core is driven directly (see StellaCore), where
+  the TIA framebuffer is read by the caller instead of being presented.
+*/
+class FrameBufferHEADLESS : public FrameBuffer
+{
+  public:
+    /**
+      Creates a new headless framebuffer
+    */
+    FrameBufferHEADLESS(OSystem& osystem) : FrameBuffer(osystem) { }
+    virtual ~FrameBufferHEADLESS() = default;
+
+    //////////////////////////////////////////////////////////////////////
+    // The following are derived from public methods in FrameBuffer.hxx
+    //////////////////////////////////////////////////////////////////////
+    void setTitle(const string& title) override { }
+    void showCursor(bool show) override { }
+    bool fullScreen() const override { return false; }
+
+    /**
+      Pixels are stored as plain 0x00RRGGBB values.
+    */
+    void getRGB(uInt32 pixel, uInt8* r, uInt8* g, uInt8* b) const override
+    {
+      *r = (pixel >> 16) & 0xff;
+      *g = (pixel >> 8) & 0xff;
+      *b = pixel & 0xff;
+    }
+    uInt32 mapRGB(uInt8 r, uInt8 g, uInt8 b) const override
+      { return (uInt32(r) << 16) | (uInt32(g) << 8) | uInt32(b); }
+
+    void readPixels(uInt8* buffer, uInt32 pitch, const GUI::Rect& rect) const override { }
+    void clear() override { }
+
+  protected:
+    //////////////////////////////////////////////////////////////////////
+    // The following are derived from protected methods in FrameBuffer.hxx
+    //////////////////////////////////////////////////////////////////////
+    void queryHardware(vector<GUI::Size>& displays, VariantList& renderers) override
+    {
+      displays.emplace_back(uInt32(kFBMinW), uInt32(kFBMinH));
+      VarList::push_back(renderers, "Headless", "headless");
+    }
+    Int32 getCurrentDisplayIndex() override { return -1; }
+    bool setVideoMode(const string& title, const VideoMode& mode) override { return true; }
+    void invalidate() override { }
+    unique_ptr<FBSurface> createSurface(uInt32 w, uInt32 h,
+                                        const uInt32* data) const override
+      { return nullptr; }
+    void grabMouse(bool grab) override { }
+    void setWindowIcon() override { }
+    void postFrameUpdate() override { }
+    string about() const override { return "Video system: headless\n"; }
+
+  private:
+    // Following constructors and assignment operators not supported
+    FrameBufferHEADLESS() = delete;
+    FrameBufferHEADLESS(const FrameBufferHEADLESS&) = delete;
+    FrameBufferHEADLESS(FrameBufferHEADLESS&&) = delete;
+    FrameBufferHEADLESS& operator=(const FrameBufferHEADLESS&) = delete;
+    FrameBufferHEADLESS& operator=(FrameBufferHEADLESS&&) = delete;
+};
+
+#endif
@@ -0,0 +1,130 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#include "MediaFactory.hxx"
+#include "Cart.hxx"
+#include "CartDetector.hxx"
+#include "Console.hxx"
+#include "DetectionCache.hxx"
+#include "EventHandler.hxx"
+#include "FrameBuffer.hxx"
+#include "MD5.hxx"
+#include "M6532.hxx"
+#include "Props.hxx"
+#include "PropsSet.hxx"
+#include "Random.hxx"
+#include "SerialPort.hxx"
+#include "Settings.hxx"
+#include "Sound.hxx"
+#include "StateManager.hxx"
+#include "EmulationWorker.hxx"
+#include "TIA.hxx"
+
+#include "OSystemHEADLESS.hxx"
+
+/**
+  Unlike the other ports, setBaseDir() and setConfigFile() are never called,
+  since a headless system must not create any directories or files.
+*/
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+OSystemHEADLESS::OSystemHEADLESS()
+  : OSystem()
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool OSystemHEADLESS::create()
+{
+  // The framebuffer is never initialized, since nothing is ever drawn;
+  // the Console only needs it to exist
+  myFrameBuffer = MediaFactory::createVideo(*this);
+  myEventHandler = MediaFactory::createEventHandler(*this);
+  mySound = MediaFactory::createAudio(*this);
+  mySerialPort = MediaFactory::createSerialPort();
+
+  // Only the built-in properties are used, and nothing is cached on disk
+  myPropSet = make_unique<PropertiesSet>(EmptyString);
+  myDetectionCache = make_unique<DetectionCache>(EmptyString);
+
+  myStateManager = make_unique<StateManager>(*this);
+  myEmulationWorker = make_unique<EmulationWorker>(*this);
+
+  myRandom->initSeed();
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string OSystemHEADLESS::createConsole(const uInt8* image, uInt32 size,
+                                      const string& type)
+{
+  if(image == nullptr || size == 0)
+    return "ERROR: Couldn't create console (empty ROM image)";
+
+  myConsole.reset();
+  mySettings->setValue("romloadcount", 0);
+
+  BytePtr rom = make_unique<uInt8[]>(size);
+  memcpy(rom.get(), image, size);
+
+  try
+  {
+    string md5 = MD5::hash(rom, size);
+
+    Properties props;
+    if(!myPropSet->getMD5(md5, props))
+      props.set(Cartridge_MD5, md5);
+    if(type != "AUTO")
+      props.set(Cartridge_Type, type);
+
+    // It's possible that the cart created was from a piece of the image,
+    // and that the md5 (and hence the cart) has changed
+    string cartmd5 = md5;
+    unique_ptr<Cartridge> cart =
+      CartDetector::create(rom, size, cartmd5, props.get(Cartridge_Type), *this);
+    if(cartmd5 != md5 && !myPropSet->getMD5(cartmd5, props))
+      props.set(Cartridge_MD5, cartmd5);
+
+    if(cart)
+      myConsole = make_unique<Console>(*this, cart, props);
+  }
+  catch(const runtime_error& e)
+  {
+    ostringstream buf;
+    buf << "ERROR: Couldn't create console (" << e.what() << ")";
+    return buf.str();
+  }
+
+  if(!myConsole)
+    return "ERROR: Couldn't create console (unknown cartridge type)";
+
+  myEventHandler->setState(EventHandlerState::EMULATION);
+
+  return EmptyString;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void OSystemHEADLESS::mainLoop()
+{
+  while(!myQuitLoop && myConsole)
+  {
+    myConsole->riot().update();
+    myConsole->tia().update();
+  }
+}
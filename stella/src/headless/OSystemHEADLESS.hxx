@@ -0,0 +1,74 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#ifndef OSYSTEM_HEADLESS_HXX
+#define OSYSTEM_HEADLESS_HXX
+
+#include "bspf.hxx"
+#include "OSystem.hxx"
+
+/**
+  This class defines an OSystem without any display, audio device or
+  user interface.  Only the objects needed to create and run a Console
+  are instantiated, and nothing is read from or written to the config
+  directories.
+
+  ROM images are passed in directly from memory rather than from a file.
+*/
+class OSystemHEADLESS : public OSystem
+{
+  public:
+    /**
+      Create a new headless operating system object
+    */
+    OSystemHEADLESS();
+    virtual ~OSystemHEADLESS() = default;
+
+    /**
+      Create only those child objects needed for emulation.
+    */
+    bool create() override;
+
+    /**
+      Creates a new game console from the given ROM image.
+
+      @param image  The ROM image data
+      @param size   The size of the ROM image, in bytes
+      @param type   The bankswitch type, or "AUTO" to autodetect it
+
+      @return  String indicating any error message (EmptyString for no errors)
+    */
+    using OSystem::createConsole;
+    string createConsole(const uInt8* image, uInt32 size,
+                         const string& type = "AUTO");
+
+    /**
+      Runs the console at full speed until quit() is called.  There is
+      no presentation, so frames are never throttled to the framerate.
+    */
+    void mainLoop() override;
+
+  private:
+    // Following constructors and assignment operators not supported
+    OSystemHEADLESS(const OSystemHEADLESS&) = delete;
+    OSystemHEADLESS(OSystemHEADLESS&&) = delete;
+    OSystemHEADLESS& operator=(const OSystemHEADLESS&) = delete;
+    OSystemHEADLESS& operator=(OSystemHEADLESS&&) = delete;
+};
+
+#endif
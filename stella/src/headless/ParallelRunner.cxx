@@ -0,0 +1,128 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#include <thread>
+
+#include "StellaCore.hxx"
+
+#include "ParallelRunner.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ParallelRunner::ParallelRunner(uInt32 workers)
+{
+  if(workers == 0)
+    workers = std::max(std::thread::hardware_concurrency(), 1u);
+
+  for(uInt32 i = 0; i < workers; ++i)
+  {
+    myCores.emplace_back(make_unique<StellaCore>());
+    myQueues.emplace_back(make_unique<WorkQueue>());
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ParallelRunner::~ParallelRunner()
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+vector<ParallelRunner::Result> ParallelRunner::run(const vector<Job>& jobs)
+{
+  vector<Result> results(jobs.size());
+
+  // Jobs are handed out round-robin; stealing takes care of the imbalance
+  for(uInt32 i = 0; i < jobs.size(); ++i)
+    myQueues[i % myQueues.size()]->jobs.push_back(i);
+
+  auto worker = [&](uInt32 id)
+  {
+    uInt32 job;
+    while(nextJob(id, job))
+    {
+      results[job].worker = id;
+      runJob(*myCores[id], jobs[job], results[job]);
+    }
+  };
+
+  // The calling thread is the last worker
+  vector<std::thread> threads;
+  for(uInt32 id = 0; id < myCores.size() - 1; ++id)
+    threads.emplace_back(worker, id);
+  worker(uInt32(myCores.size() - 1));
+
+  for(auto& thread: threads)
+    thread.join();
+
+  return results;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool ParallelRunner::nextJob(uInt32 worker, uInt32& job)
+{
+  // Own queue first, from the back
+  {
+    WorkQueue& queue = *myQueues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if(!queue.jobs.empty())
+    {
+      job = queue.jobs.back();
+      queue.jobs.pop_back();
+      return true;
+    }
+  }
+
+  // Then steal from the front of the others, starting with the next worker
+  // No jobs are ever added while running, so once every queue has been
+  // found empty, there's nothing left to do
+  for(uInt32 i = 1; i < myQueues.size(); ++i)
+  {
+    WorkQueue& queue = *myQueues[(worker + i) % myQueues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if(!queue.jobs.empty())
+    {
+      job = queue.jobs.front();
+      queue.jobs.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ParallelRunner::runJob(StellaCore& core, const Job& job, Result& result)
+{
+  result.frames = 0;
+  memset(result.ram, 0, sizeof(result.ram));
+
+  result.error = core.createConsole(job.image, job.size, job.type);
+  if(result.error != EmptyString)
+    return;
+
+  // Only the RAM is returned, so none of the frames has to be drawn
+  core.setInputs(0);
+  for(uInt32 frame = 0; frame < job.frames; ++frame)
+  {
+    if(frame < job.inputs.size())
+      core.setInputs(job.inputs[frame]);
+    core.skipFrames(1);
+  }
+
+  result.frames = job.frames;
+  memcpy(result.ram, core.ram(), sizeof(result.ram));
+}
@@ -0,0 +1,119 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#ifndef PARALLEL_RUNNER_HXX
+#define PARALLEL_RUNNER_HXX
+
+class StellaCore;
+
+#include <deque>
+#include <mutex>
+
+#include "bspf.hxx"
+
+/**
+  This class runs batches of independent emulation jobs on all available
+  cores.  Each worker thread hosts its own StellaCore, and hence its own
+  OSystem, Console and System; nothing is shared between workers except
+  the (read-only) ROM images and input scripts.
+
+  Jobs are spread round-robin over one queue per worker.  Workers take
+  jobs from the back of their own queue, and when it runs dry, steal from
+  the front of the other queues, so that a batch with jobs of very
+  different lengths still keeps all workers busy until the end.
+*/
+class ParallelRunner
+{
+  public:
+    /**
+      A single emulation run: create a console from the given ROM image,
+      and emulate the given number of frames.  The image and the input
+      script must stay valid until run() returns.
+    */
+    struct Job {
+      const uInt8* image;
+      uInt32 size;
+      string type;            // bankswitch type, or "AUTO" to autodetect
+      vector<uInt32> inputs;  // StellaCore::Input bitmask for each frame;
+                              // the last entry is held for all remaining frames
+      uInt32 frames;
+    };
+
+    /**
+      The outcome of a job, in the same order as the jobs passed to run().
+    */
+    struct Result {
+      string error;      // EmptyString if the console could be created
+      uInt32 frames;     // frames actually emulated
+      uInt8 ram[128];    // RIOT RAM after the last frame
+      uInt32 worker;     // the worker which ran the job
+    };
+
+  public:
+    /**
+      Create a runner with the given number of workers.
+
+      @param workers  The number of worker threads, or 0 to use one
+                      per hardware thread
+    */
+    ParallelRunner(uInt32 workers = 0);
+    ~ParallelRunner();
+
+    /**
+      Run all given jobs, and wait until they're complete.
+
+      @param jobs  The jobs to run
+      @return  The result of each job, in the same order as the jobs
+    */
+    vector<Result> run(const vector<Job>& jobs);
+
+    /**
+      Answers the number of worker threads used by run().
+    */
+    uInt32 workers() const { return uInt32(myCores.size()); }
+
+  private:
+    // A queue of indices into the job list; one per worker
+    struct WorkQueue {
+      std::mutex mutex;
+      std::deque<uInt32> jobs;
+    };
+
+    // Take the next job for the given worker, either from its own queue
+    // or from another worker's queue; returns false when all are empty
+    bool nextJob(uInt32 worker, uInt32& job);
+
+    // Run a single job on the given core
+    static void runJob(StellaCore& core, const Job& job, Result& result);
+
+  private:
+    // One emulation core per worker; they're kept between calls to run()
+    vector<unique_ptr<StellaCore>> myCores;
+
+    // One work queue per worker
+    vector<unique_ptr<WorkQueue>> myQueues;
+
+  private:
+    // Following constructors and assignment operators not supported
+    ParallelRunner(const ParallelRunner&) = delete;
+    ParallelRunner(ParallelRunner&&) = delete;
+    ParallelRunner& operator=(const ParallelRunner&) = delete;
+    ParallelRunner& operator=(ParallelRunner&&) = delete;
+};
+
+#endif
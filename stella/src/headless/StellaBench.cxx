@@ -0,0 +1,422 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "bspf.hxx"
+#include "BSType.hxx"
+#include "CartDetector.hxx"
+#include "FSNode.hxx"
+#include "MovieManager.hxx"
+#include "ParallelRunner.hxx"
+#include "Settings.hxx"
+#include "StateManager.hxx"
+#include "StellaCore.hxx"
+
+namespace {
+  // Return a hash of the framebuffer and RAM of the last frame
+  uInt64 hashFrame(const StellaCore& core)
+  {
+    // FNV-1a
+    uInt64 hash = 14695981039346656037ULL;
+    const uInt8* pixels = core.framebuffer();
+    for(uInt32 i = 0; i < core.width() * core.height(); ++i)
+      hash = (hash ^ pixels[i]) * 1099511628211ULL;
+    for(uInt32 i = 0; i < 128; ++i)
+      hash = (hash ^ core.ram()[i]) * 1099511628211ULL;
+
+    return hash;
+  }
+
+  // Run the ROM with the given seed and a fixed input script, and return
+  // a hash of the framebuffer and RAM after every frame
+  vector<uInt64> hashFrames(const vector<uInt8>& image, uInt32 frames,
+                            uInt32 seed, string& error, bool spans = true)
+  {
+    StellaCore core;
+    core.settings().setValue("seed", seed);
+    core.settings().setValue("tia.spans", spans);
+    error = core.createConsole(image.data(), uInt32(image.size()));
+
+    vector<uInt64> hashes;
+    for(uInt32 frame = 0; frame < frames && error == EmptyString; ++frame)
+    {
+      if(frame % 8 == 0)
+        core.setInputs(((frame + 1) * 2654435761u) >> 17);
+      core.stepFrames(1);
+      hashes.push_back(hashFrame(core));
+    }
+    return hashes;
+  }
+
+  // Run the ROM twice with the same seed and inputs, and compare the
+  // results frame by frame
+  int verifyDeterminism(const vector<uInt8>& image, uInt32 frames, uInt32 seed)
+  {
+    string error;
+    vector<uInt64> first = hashFrames(image, frames, seed, error);
+    vector<uInt64> second = hashFrames(image, frames, seed, error);
+    if(error != EmptyString)
+    {
+      cerr << error << endl;
+      return 1;
+    }
+
+    for(uInt32 frame = 0; frame < frames; ++frame)
+    {
+      if(first[frame] != second[frame])
+      {
+        cout << "Runs differ, starting at frame " << frame << endl;
+        return 1;
+      }
+    }
+    cout << "Runs are identical for " << frames << " frames (seed "
+         << seed << ")" << endl;
+    return 0;
+  }
+
+  // Record a movie of the ROM with a fixed input script, then play it back
+  // from the start and from a frame between two keyframes, and compare the
+  // frames with the recorded ones
+  int verifyMovie(const vector<uInt8>& image, uInt32 frames)
+  {
+    StellaCore core;
+    core.settings().setValue("seed", 1);
+    string error = core.createConsole(image.data(), uInt32(image.size()));
+    if(error != EmptyString)
+    {
+      cerr << error << endl;
+      return 1;
+    }
+
+    StateManager& state = core.state();
+    const string filename = "stella-bench.inp";
+    vector<uInt64> recorded;
+    if(!state.startMovieRecord())
+    {
+      cerr << "ERROR: Couldn't start recording" << endl;
+      return 1;
+    }
+    for(uInt32 frame = 0; frame < frames; ++frame)
+    {
+      if(frame % 8 == 0)
+        core.setInputs(((frame + 1) * 2654435761u) >> 17);
+      core.stepFrames(1);
+      recorded.push_back(hashFrame(core));
+    }
+    if(!state.stopMovieRecord(filename))
+    {
+      cerr << "ERROR: Couldn't save " << filename << endl;
+      return 1;
+    }
+
+    // All inputs have to come from the movie now
+    core.setInputs(0);
+    const uInt32 middle = frames / 2 + 1;
+    int result = 0;
+    for(uInt32 start: { 0u, middle })
+    {
+      if(!state.startMoviePlayback(filename) || !state.movieManager().seek(start))
+      {
+        cerr << "ERROR: Couldn't play back " << filename << endl;
+        result = 1;
+        break;
+      }
+      for(uInt32 frame = start; frame < frames && result == 0; ++frame)
+      {
+        core.stepFrames(1);
+        if(hashFrame(core) != recorded[frame])
+        {
+          cout << "Playback from frame " << start
+               << " differs from the recording, starting at frame " << frame
+               << endl;
+          result = 1;
+        }
+      }
+      state.stopMoviePlayback();
+    }
+    std::remove(filename.c_str());
+
+    if(result == 0)
+      cout << "Playback is identical to the recording for " << frames
+           << " frames (also when starting at frame " << middle << ")" << endl;
+    return result;
+  }
+
+  // Collect all files below the given directory
+  void listFiles(const FilesystemNode& dir, vector<FilesystemNode>& files)
+  {
+    FSList children;
+    dir.getChildren(children, FilesystemNode::kListAll);
+    for(const auto& child: children)
+    {
+      if(child.isDirectory())
+        listFiles(child, files);
+      else
+        files.push_back(child);
+    }
+  }
+
+  // Run every ROM in the directory (and below), or the given ROM, with
+  // span rendering on and off, and compare the frames of both runs
+  int verifySpans(const string& path, uInt32 frames)
+  {
+    FilesystemNode node(path);
+    vector<FilesystemNode> files;
+    if(node.isDirectory())
+      listFiles(node, files);
+    else
+      files.push_back(node);
+
+    uInt32 roms = 0, mismatches = 0;
+    for(const auto& file: files)
+    {
+      BytePtr data;
+      uInt32 size = 0;
+      try { size = file.read(data); }
+      catch(...) { }
+      if(size == 0)
+        continue;
+      vector<uInt8> image(data.get(), data.get() + size);
+
+      string error;
+      vector<uInt64> spans = hashFrames(image, frames, 1, error, true);
+      vector<uInt64> clocks = hashFrames(image, frames, 1, error, false);
+      if(error != EmptyString)
+      {
+        cout << file.getPath() << ": " << error << endl;
+        continue;
+      }
+      ++roms;
+
+      for(uInt32 frame = 0; frame < frames; ++frame)
+      {
+        if(spans[frame] != clocks[frame])
+        {
+          cout << file.getPath() << ": frames differ, starting at frame "
+               << frame << endl;
+          ++mismatches;
+          break;
+        }
+      }
+    }
+    if(roms == 0)
+    {
+      cerr << "ERROR: No ROMs found in " << path << endl;
+      return 1;
+    }
+
+    cout << roms << " ROMs, " << mismatches << " mismatches between span and "
+         << "per-clock rendering over " << frames << " frames" << endl;
+    return mismatches ? 1 : 0;
+  }
+
+  // Detect the bankswitch type of every ROM in the directory (and below)
+  // with both the single-pass and the original signature search, and
+  // compare the results
+  int verifyDetector(const string& path)
+  {
+    vector<FilesystemNode> files;
+    listFiles(FilesystemNode(path), files);
+
+    uInt32 roms = 0, mismatches = 0;
+    double fast = 0, reference = 0;
+    for(const auto& file: files)
+    {
+      BytePtr image;
+      uInt32 size = 0;
+      try { size = file.read(image); }
+      catch(...) { }
+      if(size == 0)
+        continue;
+      ++roms;
+
+      auto start = std::chrono::steady_clock::now();
+      BSType type = CartDetector::autodetectType(image, size);
+      auto middle = std::chrono::steady_clock::now();
+      BSType expected = CartDetector::autodetectTypeReference(image, size);
+      auto end = std::chrono::steady_clock::now();
+
+      fast += std::chrono::duration<double>(middle - start).count();
+      reference += std::chrono::duration<double>(end - middle).count();
+
+      if(type != expected)
+      {
+        cout << file.getPath() << ": " << Bankswitch::typeToName(type)
+             << ", expected " << Bankswitch::typeToName(expected) << endl;
+        ++mismatches;
+      }
+    }
+    if(roms == 0)
+    {
+      cerr << "ERROR: No ROMs found in " << path << endl;
+      return 1;
+    }
+
+    cout << roms << " ROMs, " << mismatches << " mismatches; detection took "
+         << std::fixed << std::setprecision(1) << fast * 1000 << " ms ("
+         << reference * 1000 << " ms with the original search)" << endl;
+    return mismatches ? 1 : 0;
+  }
+}
+
+/**
+  Throughput benchmark for ParallelRunner.  The same batch of jobs is run
+  with 1, 2, 4, ... workers, up to the given maximum, and the emulated
+  frames per second are reported along with the speedup over one worker.
+
+  With --verify-determinism, the ROM is instead run twice with the same
+  seed and inputs, and the frames of both runs are compared.
+
+  With --verify-movie, a movie of the ROM is recorded and played back, and
+  the frames of both are compared.
+
+  With --verify-spans, every ROM in a directory (or a single ROM) is run
+  with span rendering on and off, and the frames of both runs are compared.
+
+  With --verify-detector, the bankswitch type of every ROM in a directory
+  is detected both with the single-pass signature matcher and with the
+  original per-signature search, and the results are compared.
+
+  Usage: stella-bench <rom> [frames per job] [jobs] [max workers]
+         stella-bench --verify-determinism <rom> [frames] [seed]
+         stella-bench --verify-movie <rom> [frames]
+         stella-bench --verify-spans <rom|directory> [frames]
+         stella-bench --verify-detector <directory>
+*/
+int main(int ac, char* av[])
+{
+  if(ac > 2 && string(av[1]) == "--verify-detector")
+    return verifyDetector(av[2]);
+  if(ac > 2 && string(av[1]) == "--verify-spans")
+  {
+    uInt32 frames = ac > 3 ? atoi(av[3]) : 0;
+    return verifySpans(av[2], frames ? frames : 600);
+  }
+
+  const bool verify = ac > 1 && string(av[1]) == "--verify-determinism";
+  const bool movie = ac > 1 && string(av[1]) == "--verify-movie";
+  if(verify || movie)
+  {
+    --ac;  ++av;
+  }
+  if(ac < 2)
+  {
+    cerr << "Usage: stella-bench <rom> [frames per job] [jobs] [max workers]\n"
+         << "       stella-bench --verify-determinism <rom> [frames] [seed]\n"
+         << "       stella-bench --verify-movie <rom> [frames]\n"
+         << "       stella-bench --verify-spans <rom|directory> [frames]\n"
+         << "       stella-bench --verify-detector <directory>\n";
+    return 1;
+  }
+
+  ifstream in(av[1], std::ios::binary);
+  if(!in)
+  {
+    cerr << "ERROR: Couldn't open " << av[1] << endl;
+    return 1;
+  }
+  vector<uInt8> image((std::istreambuf_iterator<char>(in)),
+                      std::istreambuf_iterator<char>());
+
+  if(verify)
+  {
+    uInt32 frames = ac > 2 ? atoi(av[2]) : 0;
+    uInt32 seed = ac > 3 ? atoi(av[3]) : 0;
+    return verifyDeterminism(image, frames ? frames : 3600, seed ? seed : 1);
+  }
+  if(movie)
+  {
+    uInt32 frames = ac > 2 ? atoi(av[2]) : 0;
+    return verifyMovie(image, frames ? frames : 1200);
+  }
+
+  // Missing or zero arguments select the defaults
+  uInt32 frames = ac > 2 ? atoi(av[2]) : 0;
+  uInt32 numJobs = ac > 3 ? atoi(av[3]) : 0;
+  uInt32 maxWorkers = ac > 4 ? atoi(av[4]) : 0;
+  if(maxWorkers == 0)
+    maxWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+  if(frames == 0)
+    frames = 600;
+  if(numJobs == 0)
+    numJobs = maxWorkers * 4;
+
+  // Every job gets a different input script, so no two runs are identical;
+  // each input is held for 8 frames, like a player pressing a direction
+  vector<ParallelRunner::Job> jobs(numJobs);
+  for(uInt32 i = 0; i < numJobs; ++i)
+  {
+    jobs[i] = { image.data(), uInt32(image.size()), "AUTO", { }, frames };
+    for(uInt32 f = 0; f < frames; ++f)
+      jobs[i].inputs.push_back(((i + 1) * ((f & ~7u) + 1) * 2654435761u) >> 17);
+  }
+
+  cout << "ROM: " << av[1] << ", " << numJobs << " jobs of "
+       << frames << " frames" << endl
+       << "workers      frames/s   speedup" << endl;
+
+  // The results of the single worker run are the reference for all others;
+  // any difference means that state is leaking between instances
+  vector<ParallelRunner::Result> reference;
+  double single = 0;
+  for(uInt32 workers = 1; ; workers = std::min(workers * 2, maxWorkers))
+  {
+    ParallelRunner runner(workers);
+
+    auto start = std::chrono::steady_clock::now();
+    vector<ParallelRunner::Result> results = runner.run(jobs);
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+    uInt64 total = 0;
+    for(const auto& result: results)
+    {
+      if(result.error != EmptyString)
+      {
+        cerr << result.error << endl;
+        return 1;
+      }
+      total += result.frames;
+    }
+    if(workers == 1)
+      reference = results;
+
+    uInt32 mismatches = 0;
+    for(uInt32 i = 0; i < numJobs; ++i)
+      if(memcmp(results[i].ram, reference[i].ram, sizeof(results[i].ram)))
+        ++mismatches;
+
+    double fps = total / elapsed.count();
+    if(workers == 1)
+      single = fps;
+    cout << std::setw(7) << workers << std::setw(14) << uInt64(fps)
+         << std::setw(9) << std::fixed << std::setprecision(2)
+         << fps / single << "x";
+    if(mismatches)
+      cout << "   (" << mismatches << " jobs differ from 1 worker)";
+    cout << endl;
+
+    if(workers == maxWorkers)
+      break;
+  }
+
+  return 0;
+}
@@ -0,0 +1,177 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#include "Console.hxx"
+#include "EventHandler.hxx"
+#include "M6532.hxx"
+#include "OSystemHEADLESS.hxx"
+#include "Settings.hxx"
+#include "StateManager.hxx"
+#include "TIA.hxx"
+
+#include "StellaCore.hxx"
+
+namespace {
+  // Maps each bit of StellaCore::Input to the events it sets and clears
+  struct InputMap {
+    uInt32 bit;
+    Event::Type set, clear;
+  };
+
+  constexpr InputMap ourInputMap[] = {
+    { StellaCore::P0Up,       Event::JoystickZeroUp,     Event::NoType },
+    { StellaCore::P0Down,     Event::JoystickZeroDown,   Event::NoType },
+    { StellaCore::P0Left,     Event::JoystickZeroLeft,   Event::NoType },
+    { StellaCore::P0Right,    Event::JoystickZeroRight,  Event::NoType },
+    { StellaCore::P0Fire,     Event::JoystickZeroFire,   Event::NoType },
+    { StellaCore::P1Up,       Event::JoystickOneUp,      Event::NoType },
+    { StellaCore::P1Down,     Event::JoystickOneDown,    Event::NoType },
+    { StellaCore::P1Left,     Event::JoystickOneLeft,    Event::NoType },
+    { StellaCore::P1Right,    Event::JoystickOneRight,   Event::NoType },
+    { StellaCore::P1Fire,     Event::JoystickOneFire,    Event::NoType },
+    { StellaCore::Reset,      Event::ConsoleReset,       Event::NoType },
+    { StellaCore::Select,     Event::ConsoleSelect,      Event::NoType },
+    { StellaCore::LeftDiffA,  Event::ConsoleLeftDiffA,   Event::ConsoleLeftDiffB  },
+    { StellaCore::RightDiffA, Event::ConsoleRightDiffA,  Event::ConsoleRightDiffB },
+    { StellaCore::BlackWhite, Event::ConsoleBlackWhite,  Event::ConsoleColor      }
+  };
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+StellaCore::StellaCore()
+  : myOSystem(make_unique<OSystemHEADLESS>())
+{
+  myOSystem->create();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+StellaCore::~StellaCore()
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string StellaCore::createConsole(const uInt8* image, uInt32 size,
+                                 const string& type)
+{
+  return myOSystem->createConsole(image, size, type);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool StellaCore::hasConsole() const
+{
+  return myOSystem->hasConsole();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void StellaCore::stepFrames(uInt32 frames)
+{
+  Console& c = console();
+  StateManager& s = state();
+  EventHandler& handler = myOSystem->eventHandler();
+
+  // This is what EventHandler::poll() and FrameBuffer::update() do for
+  // each frame, minus everything related to presentation (and rewind)
+  handler.publishInput();
+  while(frames--)
+  {
+    handler.applyInput();
+    if(s.movieActive())
+      s.update();
+    c.riot().update();
+    c.tia().update();
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void StellaCore::skipFrames(uInt32 frames)
+{
+  TIA& tia = console().tia();
+
+  tia.enableRendering(false);
+  stepFrames(frames);
+  tia.enableRendering(true);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const uInt8* StellaCore::framebuffer() const
+{
+  return console().tia().frameBuffer();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 StellaCore::width() const
+{
+  return console().tia().width();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 StellaCore::height() const
+{
+  return console().tia().height();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const uInt8* StellaCore::ram() const
+{
+  return console().riot().getRAM();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void StellaCore::setInputs(uInt32 inputs)
+{
+  EventHandler& handler = myOSystem->eventHandler();
+
+  for(const auto& input: ourInputMap)
+  {
+    bool active = inputs & input.bit;
+
+    handler.handleEvent(input.set, active);
+    if(input.clear != Event::NoType)
+      handler.handleEvent(input.clear, !active);
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void StellaCore::setInput(Event::Type type, Int32 value)
+{
+  myOSystem->eventHandler().handleEvent(type, value);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 StellaCore::frameCount() const
+{
+  return console().tia().frameCount();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Console& StellaCore::console() const
+{
+  return myOSystem->console();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Settings& StellaCore::settings() const
+{
+  return myOSystem->settings();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+StateManager& StellaCore::state() const
+{
+  return myOSystem->state();
+}
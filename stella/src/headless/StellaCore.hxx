@@ -0,0 +1,171 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2018 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+
+#ifndef STELLA_CORE_HXX
+#define STELLA_CORE_HXX
+
+class Console;
+class OSystemHEADLESS;
+class Settings;
+class StateManager;
+
+#include "bspf.hxx"
+#include "Event.hxx"
+
+/**
+  This class is the entry point of libstella-core, the emulation core
+  without SDL, GUI presentation or sound output.  It is meant to be
+  linked into batch tools (regression runs, training harnesses) which
+  need to step many frames as fast as the host allows.
+
+  A typical session looks like:
+
+    StellaCore core;
+    if(core.createConsole(image, size) == EmptyString)
+    {
+      core.setInputs(StellaCore::P0Fire);
+      core.stepFrames(60);
+      const uInt8* pixels = core.framebuffer();
+      const uInt8* ram = core.ram();
+    }
+
+  Each StellaCore owns its own system; nothing is throttled to the
+  framerate, and no window or audio device is ever opened.
+
+  Movies started with state().startMovieRecord() or startMoviePlayback()
+  are recorded/played back by stepFrames(), so recorded sessions can be
+  replayed as fast as the host allows.
+*/
+class StellaCore
+{
+  public:
+    /**
+      The inputs which can be set with setInputs(), as a bitmask.
+      Difficulty and TV type bits select 'A' and 'B/W' when set.
+    */
+    enum Input: uInt32 {
+      P0Up        = 1 << 0,
+      P0Down      = 1 << 1,
+      P0Left      = 1 << 2,
+      P0Right     = 1 << 3,
+      P0Fire      = 1 << 4,
+      P1Up        = 1 << 5,
+      P1Down      = 1 << 6,
+      P1Left      = 1 << 7,
+      P1Right     = 1 << 8,
+      P1Fire      = 1 << 9,
+      Reset       = 1 << 10,
+      Select      = 1 << 11,
+      LeftDiffA   = 1 << 12,
+      RightDiffA  = 1 << 13,
+      BlackWhite  = 1 << 14
+    };
+
+  public:
+    StellaCore();
+    ~StellaCore();
+
+    /**
+      Creates a new console from the given ROM image, replacing any
+      console created previously.
+
+      @param image  The ROM image data
+      @param size   The size of the ROM image, in bytes
+      @param type   The bankswitch type, or "AUTO" to autodetect it
+
+      @return  String indicating any error message (EmptyString for no errors)
+    */
+    string createConsole(const uInt8* image, uInt32 size,
+                         const string& type = "AUTO");
+
+    /**
+      Answers whether a console has been successfully created.
+    */
+    bool hasConsole() const;
+
+    /**
+      Emulate the given number of frames, using the inputs currently set.
+
+      @param frames  The number of frames to emulate
+    */
+    void stepFrames(uInt32 frames);
+
+    /**
+      Emulate the given number of frames like stepFrames(), but without
+      drawing them (ie, to get through intros quickly).  The framebuffer
+      keeps the last frame which was drawn.
+
+      @param frames  The number of frames to emulate
+    */
+    void skipFrames(uInt32 frames);
+
+    /**
+      Returns the TIA framebuffer of the last completed frame.  Each byte
+      is a palette index; the image is width() x height() pixels, with
+      the first line being the current 'YStart' scanline.
+    */
+    const uInt8* framebuffer() const;
+    uInt32 width() const;
+    uInt32 height() const;
+
+    /**
+      Returns the 128 bytes of RIOT RAM.
+    */
+    const uInt8* ram() const;
+
+    /**
+      Sets the state of the joysticks and console switches, as a bitmask
+      of Input values.  The state is kept until the next call.
+
+      @param inputs  The inputs which are currently active
+    */
+    void setInputs(uInt32 inputs);
+
+    /**
+      Sets a single event, for controllers not covered by setInputs()
+      (paddles, keyboards, etc).
+
+      @param type   The event to set
+      @param value  The value of the event
+    */
+    void setInput(Event::Type type, Int32 value);
+
+    /**
+      Answers the number of frames emulated since the console was created.
+    */
+    uInt32 frameCount() const;
+
+    /**
+      Access to the underlying objects, for anything not covered above.
+    */
+    Console& console() const;
+    Settings& settings() const;
+    StateManager& state() const;
+
+  private:
+    unique_ptr<OSystemHEADLESS> myOSystem;
+
+  private:
+    // Following constructors and assignment operators not supported
+    StellaCore(const StellaCore&) = delete;
+    StellaCore(StellaCore&&) = delete;
+    StellaCore& operator=(const StellaCore&) = delete;
+    StellaCore& operator=(StellaCore&&) = delete;
+};
+
+#endif
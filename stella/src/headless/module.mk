@@ -0,0 +1,26 @@
+MODULE := src/headless
+
+MODULE_OBJS := \
+	src/headless/OSystemHEADLESS.o \
+	src/headless/ParallelRunner.o \
+	src/headless/StellaCore.o
+
+MODULE_DIRS += \
+	src/headless
+
+# The parallel runner benchmark isn't part of the library
+BENCH := stella-bench$(EXEEXT)
+
+bench: $(BENCH)
+
+$(BENCH): src/headless/StellaBench.o $(EXECUTABLE)
+	$(LD) $(LDFLAGS) $+ $(LIBS) -o $@
+
+clean: clean-bench
+clean-bench:
+	-$(RM) src/headless/StellaBench.o $(BENCH)
+
+.PHONY: bench clean-bench
+
+# Include common rules
+include $(srcdir)/common.rules
@@ -36,9 +36,12 @@ void SettingsMACOSX::loadConfig()
   char cvalue[4096];
 
   // Read key/value pairs from the plist file
-  const SettingsArray& settings = getInternalSettings();
+  const SettingsArray& settings = getSettings();
   for(uInt32 i = 0; i < settings.size(); ++i)
   {
+    if(!settings[i].internal)
+      continue;
+
     prefsGetString(settings[i].key.c_str(), cvalue, 4090);
     if(cvalue[0] != 0)
       setInternal(settings[i].key, cvalue, i, true);
@@ -49,8 +52,9 @@ void SettingsMACOSX::loadConfig()
 void SettingsMACOSX::saveConfig()
 {
   // Write out each of the key and value pairs
-  for(const auto& s: getInternalSettings())
-    prefsSetString(s.key.c_str(), s.value.toCString());
+  for(const auto& s: getSettings())
+    if(s.internal)
+      prefsSetString(s.key.c_str(), s.value.toCString());
 
   prefsSave();
 }
@@ -75,6 +75,24 @@ for my $key ( sort keys %propset )
   $idx++;
 }
 
+print OUTFILE "};\n";
+print OUTFILE "\n";
+
+# Build a perfect hash over the md5sums, so that an entry can be found
+# without searching; see build_perfect_hash() for the hash function
+my @md5s = sort keys %propset;
+my ($bucketbits, $slotbits, $displace, $slots) = build_perfect_hash(@md5s);
+
+print OUTFILE "// Perfect hash of the md5sums; see PropertiesSet::findDefault()\n";
+print OUTFILE "#define DEF_PROPS_BUCKET_BITS " . $bucketbits . "\n";
+print OUTFILE "#define DEF_PROPS_SLOT_BITS " . $slotbits . "\n";
+print OUTFILE "\n";
+print OUTFILE "static const uInt16 DefPropsDisplace[1 << DEF_PROPS_BUCKET_BITS] = {";
+print_table(@$displace);
+print OUTFILE "};\n";
+print OUTFILE "\n";
+print OUTFILE "static const uInt16 DefPropsSlots[1 << DEF_PROPS_SLOT_BITS] = {";
+print_table(@$slots);
 print OUTFILE "};\n";
 print OUTFILE "\n";
 print OUTFILE "#endif\n";
@@ -82,6 +100,76 @@ print OUTFILE "#endif\n";
 close(OUTFILE);
 
 
+# The first 64 bits of the md5sum are used as two 32-bit words; the
+# first selects a bucket, and the second (xor'ed with the displacement of
+# its bucket, and multiplied by a constant) the slot holding the row
+sub build_perfect_hash {
+  my @keys = @_;
+
+  my $slotbits = 0;
+  $slotbits++ while (1 << $slotbits) < @keys;
+  my $bucketbits = $slotbits - 2;
+
+  # Sort the keys into buckets
+  my @buckets;
+  for my $row (0 .. $#keys)
+  {
+    my $lo = hex(substr($keys[$row], 0, 8));
+    my $hi = hex(substr($keys[$row], 8, 8));
+    push @{ $buckets[$lo & ((1 << $bucketbits) - 1)] }, [ $hi, $row ];
+  }
+
+  # Place the largest buckets first, each at the first displacement
+  # where all its keys land in free slots
+  my @displace = (0) x (1 << $bucketbits);
+  my @slots = (0xffff) x (1 << $slotbits);
+  my @order = sort { scalar(@{ $buckets[$b] || [] }) <=> scalar(@{ $buckets[$a] || [] }) }
+                (0 .. (1 << $bucketbits) - 1);
+  for my $bucket (@order)
+  {
+    my $entries = $buckets[$bucket] || [];
+    last if !@$entries;
+
+    my $found = 0;
+    for my $d (0 .. 0xffff)
+    {
+      my %used;
+      my $ok = 1;
+      for my $e (@$entries)
+      {
+        my $slot = hash_slot($e->[0] ^ $d, $slotbits);
+        if ($slots[$slot] != 0xffff || $used{$slot}) { $ok = 0; last; }
+        $used{$slot} = 1;
+      }
+      next if !$ok;
+
+      $slots[hash_slot($_->[0] ^ $d, $slotbits)] = $_->[1] for @$entries;
+      $displace[$bucket] = $d;
+      $found = 1;
+      last;
+    }
+    die "Couldn't build perfect hash\n" if !$found;
+  }
+
+  return ($bucketbits, $slotbits, \@displace, \@slots);
+}
+
+# Top bits of (x * 0x9e3779b1) mod 2^32, computed in two halves so that
+# no intermediate result loses precision
+sub hash_slot {
+  my ($x, $bits) = @_;
+  my $product = ($x * 0x79b1 + ((($x * 0x9e37) & 0xffff) << 16)) & 0xffffffff;
+  return $product >> (32 - $bits);
+}
+
+sub print_table {
+  my @values = @_;
+  for my $i (0 .. $#values)
+  {
+    print OUTFILE ($i % 12 == 0 ? "\n  " : " ") . $values[$i] . ($i < $#values ? "," : "\n");
+  }
+}
+
 sub usage {
   print "create_props.pl <INPUT properties file> <OUTPUT C++ header>\n";
   print "\n";
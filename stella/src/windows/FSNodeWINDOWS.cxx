@@ -25,6 +25,8 @@
 
 #include <io.h>
 #include <stdio.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include <windows.h>
 // winnt.h defines ARRAYSIZE, but we want our own one...
 #undef ARRAYSIZE
@@ -83,6 +85,19 @@ bool FilesystemNodeWINDOWS::isReadable() const
   return _access(_path.c_str(), R_OK) == 0;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool FilesystemNodeWINDOWS::getStats(uInt64& size, uInt64& modtime) const
+{
+  struct _stat64 st;
+
+  if(_stat64(_path.c_str(), &st) != 0)
+    return false;
+
+  size = uInt64(st.st_size);
+  modtime = uInt64(st.st_mtime);
+  return true;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool FilesystemNodeWINDOWS::isWritable() const
 {
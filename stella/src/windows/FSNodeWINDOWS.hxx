@@ -67,6 +67,7 @@ class FilesystemNodeWINDOWS : public AbstractFSNode
     bool isWritable() const override;
     bool makeDir() override;
     bool rename(const string& newfile) override;
+    bool getStats(uInt64& size, uInt64& modtime) const override;
 
     bool getChildren(AbstractFSList& list, ListMode mode, bool hidden) const override;
     AbstractFSNode* getParent() const override;